@@ -6,6 +6,7 @@
 #include "lawn/LawnCommon.h"
 
 #include "lawn/Board.h"
+#include "lawn/BoardBenchmark.h"
 #include "lawn/Challenge.h"
 #include "lawn/Cutscene.h"
 #include "lawn/Plant.h"
@@ -13,6 +14,7 @@
 #include "lawn/Zombie.h"
 
 #include "todlib/Attachment.h"
+#include "todlib/Definition.h"
 #include "todlib/TodDebug.h"
 #include "todlib/TodFoley.h"
 #include "todlib/Trail.h"
@@ -51,8 +53,11 @@
 #include "todlib/TodStringFile.h"
 
 #include "framework/graphics/Graphics.h"
+#include "framework/graphics/UpscaleCache.h"
 #include "framework/graphics/WindowInterface.h"
+#include "framework/imagelib/ImageLib.h"
 #include "framework/misc/ResourceManager.h"
+#include "framework/paklib/PakInterface.h"
 
 bool gIsPartnerBuild = false; // GOTY @Patoke: 0x729659
 bool gSlowMo = false;         // 0x6A9EAA
@@ -139,6 +144,19 @@ LawnApp::LawnApp() {
     mProfileMgr = new ProfileMgr();
     mRegisterResourcesLoaded = false;
     mTodCheatKeys = false;
+    mBenchmarkXML = false;
+    mBenchmarkSpawning = false;
+    mCheckGridIndex = false;
+    mBenchmarkCountdowns = false;
+    mBenchmarkTargeting = false;
+    mBenchmarkProjectiles = false;
+    mTestAliasTable = false;
+    mAliasPicks = false;
+    mTimerWheelMode = false;
+    mStartupStats = false;
+    mBenchmarkPak = false;
+    mTestImageLib = false;
+    mSerialLoad = false;
     mCrazyDaveReanimID = ReanimationID::REANIMATIONID_NULL;
     mCrazyDaveState = CrazyDaveState::CRAZY_DAVE_OFF;
     mCrazyDaveBlinkCounter = 0;
@@ -207,6 +225,7 @@ LawnApp::~LawnApp() {
     delete mProfileMgr;
     delete mLastLevelStats;
 
+    if (mResourceManager->GetImageBudget() != 0) fmt::println("{}", mResourceManager->GetImageBudgetStatsString());
     mResourceManager->DeleteResources("");
     /*
 #ifdef _DEBUG
@@ -1090,6 +1109,7 @@ void LawnApp::Init() {
     TodLog("session id: {:}", mSessionID);
     // #endif
 
+    mResourceManager->SetResourceHandles(gResourceStringIds, static_cast<int>(ResourceId::RESOURCE_ID_MAX));
     if (!mResourceManager->ParseResourcesFile("properties/resources.xml")) {
         ShowResourceError(true);
         return;
@@ -1177,6 +1197,32 @@ void LawnApp::HandleCmdLineParam(const std::string &theParamName, const std::str
         mTodCheatKeys = true;
         mDebugKeysEnabled = true;
         // #endif
+    } else if (theParamName == "-xmlbench") {
+        mBenchmarkXML = true;
+    } else if (theParamName == "-spawnbench") {
+        mBenchmarkSpawning = true;
+    } else if (theParamName == "-gridindexcheck") {
+        mCheckGridIndex = true;
+    } else if (theParamName == "-countdownbench") {
+        mBenchmarkCountdowns = true;
+    } else if (theParamName == "-targetbench") {
+        mBenchmarkTargeting = true;
+    } else if (theParamName == "-projectilebench") {
+        mBenchmarkProjectiles = true;
+    } else if (theParamName == "-aliastest") {
+        mTestAliasTable = true;
+    } else if (theParamName == "-aliaspicks") {
+        mAliasPicks = true;
+    } else if (theParamName == "-timerwheel") {
+        mTimerWheelMode = true;
+    } else if (theParamName == "-startupstats") {
+        mStartupStats = true;
+    } else if (theParamName == "-pakbench") {
+        mBenchmarkPak = true;
+    } else if (theParamName == "-imagelibselftest") {
+        mTestImageLib = true;
+    } else if (theParamName == "-serialload") {
+        mSerialLoad = true;
     } else {
         SexyApp::HandleCmdLineParam(theParamName, theParamValue);
     }
@@ -1420,6 +1466,7 @@ void LawnApp::ToggleFastMo() {
 // 0x452740
 void LawnApp::LoadGroup(const char *theGroupName, int theGroupAveMsToLoad) {
     // auto aTimer = std::chrono::high_resolution_clock::now();
+    TodHesitationBracket<0> aHesitationGroup("loading group {}", theGroupName);
 
     mResourceManager->StartLoadResources(theGroupName);
     while (!mShutdown && !mCloseRequest && !mLoadingFailed && TodLoadNextResource()) {
@@ -1440,6 +1487,7 @@ void LawnApp::LoadGroup(const char *theGroupName, int theGroupAveMsToLoad) {
 
 // 0x4528E0
 void LawnApp::LoadingThreadProc() {
+    if (mSerialLoad) mResourceManager->SetPrepareAhead(false);
     if (!TodLoadResources("LoaderBar")) return;
 
     TodStringListLoad("Properties/LawnStrings.txt");
@@ -1466,11 +1514,27 @@ void LawnApp::LoadingThreadProc() {
 
     {
         TodHesitationBracket<0> aHesitationResources("loading group resources");
-        for (const auto &[group, ms] : groups) {
+        for (size_t i = 0; i < std::size(groups); i++) {
+            const auto &[group, ms] = groups[i];
+            const auto aStart = std::chrono::high_resolution_clock::now();
+            // The next group is prepared on the pool while this one finishes loading on this thread.
+            if (i + 1 < std::size(groups)) mResourceManager->PrepareNextGroup(std::get<0>(groups[i + 1]));
             LoadGroup(group, ms);
+            if (mStartupStats) {
+                fmt::println(
+                    "startupstats: {} loaded in {:.0f} ms", group,
+                    std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - aStart)
+                        .count()
+                );
+            }
         }
     }
 
+    if (mStartupStats) {
+        fmt::println("{}", Vk::getUpscaleCacheStatsString());
+        fmt::println("{}", ImageLib::GetImageLoadStatsString());
+    }
+
     if (mLoadingFailed || mShutdown || mCloseRequest) return;
 
     {
@@ -1498,6 +1562,11 @@ void LawnApp::LoadingThreadProc() {
         TodParticleLoadDefinitions(gLawnParticleArray, std::size(gLawnParticleArray));
     }
 
+    if (mBenchmarkXML) DefinitionBenchmarkXMLParser();
+    if (mTestAliasTable) TodAliasTableSelfTest();
+    if (mBenchmarkPak) PakBenchmarkFOpen();
+    if (mTestImageLib) ImageLib::ImageLibSelfTest();
+
     PreloadForUser();
     if (mLoadingFailed || mShutdown || mCloseRequest) return;
 }
@@ -1524,6 +1593,28 @@ void LawnApp::LoadingCompleted() {
 
     mResourceManager->DeleteImage("IMAGE_TITLESCREEN");
 
+    if (mStartupStats) {
+        size_t aResident = 0;
+        size_t aPeak = 0;
+        const double aMs =
+            std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - mTimeLoaded).count();
+        if (Sexy::GetProcessMemory(&aResident, &aPeak)) {
+            fmt::println(
+                "startupstats: main menu after {:.0f} ms, {:.1f} MiB resident, {:.1f} MiB peak", aMs,
+                aResident / (1024.0 * 1024.0), aPeak / (1024.0 * 1024.0)
+            );
+        } else {
+            fmt::println("startupstats: main menu after {:.0f} ms", aMs);
+        }
+        PakBenchmarkAddPakFile("main.pak");
+    }
+
+    if (mBenchmarkSpawning) BoardBenchmarkZombieSpawning(this);
+    if (mCheckGridIndex) BoardCheckGridIndex(this);
+    if (mBenchmarkCountdowns) BoardBenchmarkCountdowns(this);
+    if (mBenchmarkTargeting) BoardBenchmarkTargeting(this);
+    if (mBenchmarkProjectiles) BoardBenchmarkProjectiles(this);
+
     ShowGameSelector();
 }
 
@@ -121,6 +121,19 @@ public:
     TrialType mTrialType;                                                  //+0x8C0
     bool mDebugTrialLocked;                                                //+0x8C4
     bool mMuteSoundsForCutscene;                                           //+0x8C5
+    bool mBenchmarkXML;                                                    // -xmlbench
+    bool mBenchmarkSpawning;                                               // -spawnbench
+    bool mCheckGridIndex;                                                  // -gridindexcheck
+    bool mBenchmarkCountdowns;                                             // -countdownbench
+    bool mBenchmarkTargeting;                                              // -targetbench
+    bool mBenchmarkProjectiles;                                            // -projectilebench
+    bool mTestAliasTable;                                                  // -aliastest
+    bool mAliasPicks;                                                      // -aliaspicks
+    bool mTimerWheelMode;                                                  // -timerwheel
+    bool mStartupStats;                                                    // -startupstats
+    bool mBenchmarkPak;                                                    // -pakbench
+    bool mTestImageLib;                                                    // -imagelibselftest
+    bool mSerialLoad;                                                      // -serialload
 
 public:
     LawnApp();
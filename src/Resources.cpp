@@ -77,24 +77,24 @@ bool Sexy::ExtractDelayLoad_AlmanacResources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_ALMANAC_CLOSEBUTTON = aMgr.GetImageThrow("IMAGE_ALMANAC_CLOSEBUTTON");
-        IMAGE_ALMANAC_CLOSEBUTTONHIGHLIGHT = aMgr.GetImageThrow("IMAGE_ALMANAC_CLOSEBUTTONHIGHLIGHT");
-        IMAGE_ALMANAC_GROUNDDAY = aMgr.GetImageThrow("IMAGE_ALMANAC_GROUNDDAY");
-        IMAGE_ALMANAC_GROUNDICE = aMgr.GetImageThrow("IMAGE_ALMANAC_GROUNDICE");
-        IMAGE_ALMANAC_GROUNDNIGHT = aMgr.GetImageThrow("IMAGE_ALMANAC_GROUNDNIGHT");
-        IMAGE_ALMANAC_GROUNDNIGHTPOOL = aMgr.GetImageThrow("IMAGE_ALMANAC_GROUNDNIGHTPOOL");
-        IMAGE_ALMANAC_GROUNDPOOL = aMgr.GetImageThrow("IMAGE_ALMANAC_GROUNDPOOL");
-        IMAGE_ALMANAC_GROUNDROOF = aMgr.GetImageThrow("IMAGE_ALMANAC_GROUNDROOF");
-        IMAGE_ALMANAC_INDEXBACK = aMgr.GetImageThrow("IMAGE_ALMANAC_INDEXBACK");
-        IMAGE_ALMANAC_INDEXBUTTON = aMgr.GetImageThrow("IMAGE_ALMANAC_INDEXBUTTON");
-        IMAGE_ALMANAC_INDEXBUTTONHIGHLIGHT = aMgr.GetImageThrow("IMAGE_ALMANAC_INDEXBUTTONHIGHLIGHT");
-        IMAGE_ALMANAC_PLANTBACK = aMgr.GetImageThrow("IMAGE_ALMANAC_PLANTBACK");
-        IMAGE_ALMANAC_PLANTCARD = aMgr.GetImageThrow("IMAGE_ALMANAC_PLANTCARD");
-        IMAGE_ALMANAC_ZOMBIEBACK = aMgr.GetImageThrow("IMAGE_ALMANAC_ZOMBIEBACK");
-        IMAGE_ALMANAC_ZOMBIEBLANK = aMgr.GetImageThrow("IMAGE_ALMANAC_ZOMBIEBLANK");
-        IMAGE_ALMANAC_ZOMBIECARD = aMgr.GetImageThrow("IMAGE_ALMANAC_ZOMBIECARD");
-        IMAGE_ALMANAC_ZOMBIEWINDOW = aMgr.GetImageThrow("IMAGE_ALMANAC_ZOMBIEWINDOW");
-        IMAGE_ALMANAC_ZOMBIEWINDOW2 = aMgr.GetImageThrow("IMAGE_ALMANAC_ZOMBIEWINDOW2");
+        IMAGE_ALMANAC_CLOSEBUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_CLOSEBUTTON_ID);
+        IMAGE_ALMANAC_CLOSEBUTTONHIGHLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_CLOSEBUTTONHIGHLIGHT_ID);
+        IMAGE_ALMANAC_GROUNDDAY = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_GROUNDDAY_ID);
+        IMAGE_ALMANAC_GROUNDICE = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_GROUNDICE_ID);
+        IMAGE_ALMANAC_GROUNDNIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_GROUNDNIGHT_ID);
+        IMAGE_ALMANAC_GROUNDNIGHTPOOL = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_GROUNDNIGHTPOOL_ID);
+        IMAGE_ALMANAC_GROUNDPOOL = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_GROUNDPOOL_ID);
+        IMAGE_ALMANAC_GROUNDROOF = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_GROUNDROOF_ID);
+        IMAGE_ALMANAC_INDEXBACK = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_INDEXBACK_ID);
+        IMAGE_ALMANAC_INDEXBUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_INDEXBUTTON_ID);
+        IMAGE_ALMANAC_INDEXBUTTONHIGHLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_INDEXBUTTONHIGHLIGHT_ID);
+        IMAGE_ALMANAC_PLANTBACK = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_PLANTBACK_ID);
+        IMAGE_ALMANAC_PLANTCARD = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_PLANTCARD_ID);
+        IMAGE_ALMANAC_ZOMBIEBACK = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_ZOMBIEBACK_ID);
+        IMAGE_ALMANAC_ZOMBIEBLANK = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_ZOMBIEBLANK_ID);
+        IMAGE_ALMANAC_ZOMBIECARD = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_ZOMBIECARD_ID);
+        IMAGE_ALMANAC_ZOMBIEWINDOW = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_ZOMBIEWINDOW_ID);
+        IMAGE_ALMANAC_ZOMBIEWINDOW2 = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_ZOMBIEWINDOW2_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -109,7 +109,7 @@ bool Sexy::ExtractDelayLoad_AwardScreenResources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_AWARDSCREEN_BACK = aMgr.GetImageThrow("IMAGE_AWARDSCREEN_BACK");
+        IMAGE_AWARDSCREEN_BACK = aMgr.GetImageThrow(ResourceId::IMAGE_AWARDSCREEN_BACK_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -126,9 +126,10 @@ bool Sexy::ExtractDelayLoad_Background1Resources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_BACKGROUND1 = aMgr.GetImageThrow("IMAGE_BACKGROUND1");
-        IMAGE_BACKGROUND1_GAMEOVER_INTERIOR_OVERLAY = aMgr.GetImageThrow("IMAGE_BACKGROUND1_GAMEOVER_INTERIOR_OVERLAY");
-        IMAGE_BACKGROUND1_GAMEOVER_MASK = aMgr.GetImageThrow("IMAGE_BACKGROUND1_GAMEOVER_MASK");
+        IMAGE_BACKGROUND1 = aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND1_ID);
+        IMAGE_BACKGROUND1_GAMEOVER_INTERIOR_OVERLAY =
+            aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND1_GAMEOVER_INTERIOR_OVERLAY_ID);
+        IMAGE_BACKGROUND1_GAMEOVER_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND1_GAMEOVER_MASK_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -145,9 +146,10 @@ bool Sexy::ExtractDelayLoad_Background2Resources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_BACKGROUND2 = aMgr.GetImageThrow("IMAGE_BACKGROUND2");
-        IMAGE_BACKGROUND2_GAMEOVER_INTERIOR_OVERLAY = aMgr.GetImageThrow("IMAGE_BACKGROUND2_GAMEOVER_INTERIOR_OVERLAY");
-        IMAGE_BACKGROUND2_GAMEOVER_MASK = aMgr.GetImageThrow("IMAGE_BACKGROUND2_GAMEOVER_MASK");
+        IMAGE_BACKGROUND2 = aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND2_ID);
+        IMAGE_BACKGROUND2_GAMEOVER_INTERIOR_OVERLAY =
+            aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND2_GAMEOVER_INTERIOR_OVERLAY_ID);
+        IMAGE_BACKGROUND2_GAMEOVER_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND2_GAMEOVER_MASK_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -164,9 +166,10 @@ bool Sexy::ExtractDelayLoad_Background3Resources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_BACKGROUND3 = aMgr.GetImageThrow("IMAGE_BACKGROUND3");
-        IMAGE_BACKGROUND3_GAMEOVER_INTERIOR_OVERLAY = aMgr.GetImageThrow("IMAGE_BACKGROUND3_GAMEOVER_INTERIOR_OVERLAY");
-        IMAGE_BACKGROUND3_GAMEOVER_MASK = aMgr.GetImageThrow("IMAGE_BACKGROUND3_GAMEOVER_MASK");
+        IMAGE_BACKGROUND3 = aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND3_ID);
+        IMAGE_BACKGROUND3_GAMEOVER_INTERIOR_OVERLAY =
+            aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND3_GAMEOVER_INTERIOR_OVERLAY_ID);
+        IMAGE_BACKGROUND3_GAMEOVER_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND3_GAMEOVER_MASK_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -185,11 +188,12 @@ bool Sexy::ExtractDelayLoad_Background4Resources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_BACKGROUND4 = aMgr.GetImageThrow("IMAGE_BACKGROUND4");
-        IMAGE_BACKGROUND4_GAMEOVER_INTERIOR_OVERLAY = aMgr.GetImageThrow("IMAGE_BACKGROUND4_GAMEOVER_INTERIOR_OVERLAY");
-        IMAGE_BACKGROUND4_GAMEOVER_MASK = aMgr.GetImageThrow("IMAGE_BACKGROUND4_GAMEOVER_MASK");
-        IMAGE_FOG = aMgr.GetImageThrow("IMAGE_FOG");
-        IMAGE_FOG_SOFTWARE = aMgr.GetImageThrow("IMAGE_FOG_SOFTWARE");
+        IMAGE_BACKGROUND4 = aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND4_ID);
+        IMAGE_BACKGROUND4_GAMEOVER_INTERIOR_OVERLAY =
+            aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND4_GAMEOVER_INTERIOR_OVERLAY_ID);
+        IMAGE_BACKGROUND4_GAMEOVER_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND4_GAMEOVER_MASK_ID);
+        IMAGE_FOG = aMgr.GetImageThrow(ResourceId::IMAGE_FOG_ID);
+        IMAGE_FOG_SOFTWARE = aMgr.GetImageThrow(ResourceId::IMAGE_FOG_SOFTWARE_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -205,8 +209,8 @@ bool Sexy::ExtractDelayLoad_Background5Resources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_BACKGROUND5 = aMgr.GetImageThrow("IMAGE_BACKGROUND5");
-        IMAGE_BACKGROUND5_GAMEOVER_MASK = aMgr.GetImageThrow("IMAGE_BACKGROUND5_GAMEOVER_MASK");
+        IMAGE_BACKGROUND5 = aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND5_ID);
+        IMAGE_BACKGROUND5_GAMEOVER_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND5_GAMEOVER_MASK_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -222,8 +226,8 @@ bool Sexy::ExtractDelayLoad_Background6Resources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_BACKGROUND6BOSS = aMgr.GetImageThrow("IMAGE_BACKGROUND6BOSS");
-        IMAGE_BACKGROUND6_GAMEOVER_MASK = aMgr.GetImageThrow("IMAGE_BACKGROUND6_GAMEOVER_MASK");
+        IMAGE_BACKGROUND6BOSS = aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND6BOSS_ID);
+        IMAGE_BACKGROUND6_GAMEOVER_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND6_GAMEOVER_MASK_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -240,9 +244,9 @@ bool Sexy::ExtractDelayLoad_BackgroundUnsoddedResources(ResourceManager *theMana
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_BACKGROUND1UNSODDED = aMgr.GetImageThrow("IMAGE_BACKGROUND1UNSODDED");
-        IMAGE_SOD1ROW = aMgr.GetImageThrow("IMAGE_SOD1ROW");
-        IMAGE_SOD3ROW = aMgr.GetImageThrow("IMAGE_SOD3ROW");
+        IMAGE_BACKGROUND1UNSODDED = aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND1UNSODDED_ID);
+        IMAGE_SOD1ROW = aMgr.GetImageThrow(ResourceId::IMAGE_SOD1ROW_ID);
+        IMAGE_SOD3ROW = aMgr.GetImageThrow(ResourceId::IMAGE_SOD3ROW_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -264,14 +268,14 @@ bool Sexy::ExtractDelayLoad_ChallengeScreenResources(ResourceManager *theManager
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_CHALLENGE_BACKGROUND = aMgr.GetImageThrow("IMAGE_CHALLENGE_BACKGROUND");
-        IMAGE_CHALLENGE_BLANK = aMgr.GetImageThrow("IMAGE_CHALLENGE_BLANK");
-        IMAGE_CHALLENGE_THUMBNAILS = aMgr.GetImageThrow("IMAGE_CHALLENGE_THUMBNAILS");
-        IMAGE_CHALLENGE_WINDOW = aMgr.GetImageThrow("IMAGE_CHALLENGE_WINDOW");
-        IMAGE_CHALLENGE_WINDOW_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_CHALLENGE_WINDOW_HIGHLIGHT");
-        IMAGE_LOCK = aMgr.GetImageThrow("IMAGE_LOCK");
-        IMAGE_LOCK_OPEN = aMgr.GetImageThrow("IMAGE_LOCK_OPEN");
-        IMAGE_SURVIVAL_THUMBNAILS = aMgr.GetImageThrow("IMAGE_SURVIVAL_THUMBNAILS");
+        IMAGE_CHALLENGE_BACKGROUND = aMgr.GetImageThrow(ResourceId::IMAGE_CHALLENGE_BACKGROUND_ID);
+        IMAGE_CHALLENGE_BLANK = aMgr.GetImageThrow(ResourceId::IMAGE_CHALLENGE_BLANK_ID);
+        IMAGE_CHALLENGE_THUMBNAILS = aMgr.GetImageThrow(ResourceId::IMAGE_CHALLENGE_THUMBNAILS_ID);
+        IMAGE_CHALLENGE_WINDOW = aMgr.GetImageThrow(ResourceId::IMAGE_CHALLENGE_WINDOW_ID);
+        IMAGE_CHALLENGE_WINDOW_HIGHLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_CHALLENGE_WINDOW_HIGHLIGHT_ID);
+        IMAGE_LOCK = aMgr.GetImageThrow(ResourceId::IMAGE_LOCK_ID);
+        IMAGE_LOCK_OPEN = aMgr.GetImageThrow(ResourceId::IMAGE_LOCK_OPEN_ID);
+        IMAGE_SURVIVAL_THUMBNAILS = aMgr.GetImageThrow(ResourceId::IMAGE_SURVIVAL_THUMBNAILS_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -297,18 +301,18 @@ bool Sexy::ExtractDelayLoad_CreditsResources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        FONT_BRIANNETOD32 = aMgr.GetFontThrow("FONT_BRIANNETOD32");
-        FONT_BRIANNETOD32BLACK = aMgr.GetFontThrow("FONT_BRIANNETOD32BLACK");
-        IMAGE_CREDITS_PLAYBUTTON = aMgr.GetImageThrow("IMAGE_CREDITS_PLAYBUTTON");
-        IMAGE_CREDITS_ZOMBIENOTE = aMgr.GetImageThrow("IMAGE_CREDITS_ZOMBIENOTE");
-        IMAGE_REANIM_CREDITS_DISCOLIGHTS = aMgr.GetImageThrow("IMAGE_REANIM_CREDITS_DISCOLIGHTS");
-        IMAGE_REANIM_CREDITS_FOGMACHINE = aMgr.GetImageThrow("IMAGE_REANIM_CREDITS_FOGMACHINE");
-        IMAGE_REANIM_SUNFLOWER_HEAD_SING1 = aMgr.GetImageThrow("IMAGE_REANIM_SUNFLOWER_HEAD_SING1");
-        IMAGE_REANIM_SUNFLOWER_HEAD_SING2 = aMgr.GetImageThrow("IMAGE_REANIM_SUNFLOWER_HEAD_SING2");
-        IMAGE_REANIM_SUNFLOWER_HEAD_SING3 = aMgr.GetImageThrow("IMAGE_REANIM_SUNFLOWER_HEAD_SING3");
-        IMAGE_REANIM_SUNFLOWER_HEAD_SING4 = aMgr.GetImageThrow("IMAGE_REANIM_SUNFLOWER_HEAD_SING4");
-        IMAGE_REANIM_SUNFLOWER_HEAD_SING5 = aMgr.GetImageThrow("IMAGE_REANIM_SUNFLOWER_HEAD_SING5");
-        IMAGE_REANIM_SUNFLOWER_HEAD_WINK = aMgr.GetImageThrow("IMAGE_REANIM_SUNFLOWER_HEAD_WINK");
+        FONT_BRIANNETOD32 = aMgr.GetFontThrow(ResourceId::FONT_BRIANNETOD32_ID);
+        FONT_BRIANNETOD32BLACK = aMgr.GetFontThrow(ResourceId::FONT_BRIANNETOD32BLACK_ID);
+        IMAGE_CREDITS_PLAYBUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_CREDITS_PLAYBUTTON_ID);
+        IMAGE_CREDITS_ZOMBIENOTE = aMgr.GetImageThrow(ResourceId::IMAGE_CREDITS_ZOMBIENOTE_ID);
+        IMAGE_REANIM_CREDITS_DISCOLIGHTS = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_CREDITS_DISCOLIGHTS_ID);
+        IMAGE_REANIM_CREDITS_FOGMACHINE = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_CREDITS_FOGMACHINE_ID);
+        IMAGE_REANIM_SUNFLOWER_HEAD_SING1 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SUNFLOWER_HEAD_SING1_ID);
+        IMAGE_REANIM_SUNFLOWER_HEAD_SING2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SUNFLOWER_HEAD_SING2_ID);
+        IMAGE_REANIM_SUNFLOWER_HEAD_SING3 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SUNFLOWER_HEAD_SING3_ID);
+        IMAGE_REANIM_SUNFLOWER_HEAD_SING4 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SUNFLOWER_HEAD_SING4_ID);
+        IMAGE_REANIM_SUNFLOWER_HEAD_SING5 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SUNFLOWER_HEAD_SING5_ID);
+        IMAGE_REANIM_SUNFLOWER_HEAD_WINK = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SUNFLOWER_HEAD_WINK_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -323,7 +327,7 @@ bool Sexy::ExtractDelayLoad_GreenHouseGardenResources(ResourceManager *theManage
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_BACKGROUND_GREENHOUSE = aMgr.GetImageThrow("IMAGE_BACKGROUND_GREENHOUSE");
+        IMAGE_BACKGROUND_GREENHOUSE = aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND_GREENHOUSE_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -338,7 +342,7 @@ bool Sexy::ExtractDelayLoad_GreenHouseOverlayResources(ResourceManager *theManag
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_BACKGROUND_GREENHOUSE_OVERLAY = aMgr.GetImageThrow("IMAGE_BACKGROUND_GREENHOUSE_OVERLAY");
+        IMAGE_BACKGROUND_GREENHOUSE_OVERLAY = aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND_GREENHOUSE_OVERLAY_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -353,7 +357,7 @@ bool Sexy::ExtractDelayLoad_MushroomGardenResources(ResourceManager *theManager)
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_BACKGROUND_MUSHROOMGARDEN = aMgr.GetImageThrow("IMAGE_BACKGROUND_MUSHROOMGARDEN");
+        IMAGE_BACKGROUND_MUSHROOMGARDEN = aMgr.GetImageThrow(ResourceId::IMAGE_BACKGROUND_MUSHROOMGARDEN_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -391,30 +395,30 @@ bool Sexy::ExtractDelayLoad_StoreResources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_STORE_AQUARIUMGARDENICON = aMgr.GetImageThrow("IMAGE_STORE_AQUARIUMGARDENICON");
-        IMAGE_STORE_BACKGROUND = aMgr.GetImageThrow("IMAGE_STORE_BACKGROUND");
-        IMAGE_STORE_BACKGROUNDNIGHT = aMgr.GetImageThrow("IMAGE_STORE_BACKGROUNDNIGHT");
-        IMAGE_STORE_CAR = aMgr.GetImageThrow("IMAGE_STORE_CAR");
-        IMAGE_STORE_CARCLOSED = aMgr.GetImageThrow("IMAGE_STORE_CARCLOSED");
-        IMAGE_STORE_CARCLOSED_NIGHT = aMgr.GetImageThrow("IMAGE_STORE_CARCLOSED_NIGHT");
-        IMAGE_STORE_CAR_NIGHT = aMgr.GetImageThrow("IMAGE_STORE_CAR_NIGHT");
-        IMAGE_STORE_FIRSTAIDWALLNUTICON = aMgr.GetImageThrow("IMAGE_STORE_FIRSTAIDWALLNUTICON");
-        IMAGE_STORE_HATCHBACKOPEN = aMgr.GetImageThrow("IMAGE_STORE_HATCHBACKOPEN");
-        IMAGE_STORE_MAINMENUBUTTON = aMgr.GetImageThrow("IMAGE_STORE_MAINMENUBUTTON");
-        IMAGE_STORE_MAINMENUBUTTONDOWN = aMgr.GetImageThrow("IMAGE_STORE_MAINMENUBUTTONDOWN");
-        IMAGE_STORE_MAINMENUBUTTONHIGHLIGHT = aMgr.GetImageThrow("IMAGE_STORE_MAINMENUBUTTONHIGHLIGHT");
-        IMAGE_STORE_MUSHROOMGARDENICON = aMgr.GetImageThrow("IMAGE_STORE_MUSHROOMGARDENICON");
-        IMAGE_STORE_NEXTBUTTON = aMgr.GetImageThrow("IMAGE_STORE_NEXTBUTTON");
-        IMAGE_STORE_NEXTBUTTONDISABLED = aMgr.GetImageThrow("IMAGE_STORE_NEXTBUTTONDISABLED");
-        IMAGE_STORE_NEXTBUTTONHIGHLIGHT = aMgr.GetImageThrow("IMAGE_STORE_NEXTBUTTONHIGHLIGHT");
-        IMAGE_STORE_PACKETUPGRADE = aMgr.GetImageThrow("IMAGE_STORE_PACKETUPGRADE");
-        IMAGE_STORE_PREVBUTTON = aMgr.GetImageThrow("IMAGE_STORE_PREVBUTTON");
-        IMAGE_STORE_PREVBUTTONDISABLED = aMgr.GetImageThrow("IMAGE_STORE_PREVBUTTONDISABLED");
-        IMAGE_STORE_PREVBUTTONHIGHLIGHT = aMgr.GetImageThrow("IMAGE_STORE_PREVBUTTONHIGHLIGHT");
-        IMAGE_STORE_PRICETAG = aMgr.GetImageThrow("IMAGE_STORE_PRICETAG");
-        IMAGE_STORE_PVZICON = aMgr.GetImageThrow("IMAGE_STORE_PVZICON");
-        IMAGE_STORE_SIGN = aMgr.GetImageThrow("IMAGE_STORE_SIGN");
-        IMAGE_STORE_TREEOFWISDOMICON = aMgr.GetImageThrow("IMAGE_STORE_TREEOFWISDOMICON");
+        IMAGE_STORE_AQUARIUMGARDENICON = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_AQUARIUMGARDENICON_ID);
+        IMAGE_STORE_BACKGROUND = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_BACKGROUND_ID);
+        IMAGE_STORE_BACKGROUNDNIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_BACKGROUNDNIGHT_ID);
+        IMAGE_STORE_CAR = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_CAR_ID);
+        IMAGE_STORE_CARCLOSED = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_CARCLOSED_ID);
+        IMAGE_STORE_CARCLOSED_NIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_CARCLOSED_NIGHT_ID);
+        IMAGE_STORE_CAR_NIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_CAR_NIGHT_ID);
+        IMAGE_STORE_FIRSTAIDWALLNUTICON = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_FIRSTAIDWALLNUTICON_ID);
+        IMAGE_STORE_HATCHBACKOPEN = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_HATCHBACKOPEN_ID);
+        IMAGE_STORE_MAINMENUBUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_MAINMENUBUTTON_ID);
+        IMAGE_STORE_MAINMENUBUTTONDOWN = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_MAINMENUBUTTONDOWN_ID);
+        IMAGE_STORE_MAINMENUBUTTONHIGHLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_MAINMENUBUTTONHIGHLIGHT_ID);
+        IMAGE_STORE_MUSHROOMGARDENICON = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_MUSHROOMGARDENICON_ID);
+        IMAGE_STORE_NEXTBUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_NEXTBUTTON_ID);
+        IMAGE_STORE_NEXTBUTTONDISABLED = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_NEXTBUTTONDISABLED_ID);
+        IMAGE_STORE_NEXTBUTTONHIGHLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_NEXTBUTTONHIGHLIGHT_ID);
+        IMAGE_STORE_PACKETUPGRADE = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_PACKETUPGRADE_ID);
+        IMAGE_STORE_PREVBUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_PREVBUTTON_ID);
+        IMAGE_STORE_PREVBUTTONDISABLED = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_PREVBUTTONDISABLED_ID);
+        IMAGE_STORE_PREVBUTTONHIGHLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_PREVBUTTONHIGHLIGHT_ID);
+        IMAGE_STORE_PRICETAG = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_PRICETAG_ID);
+        IMAGE_STORE_PVZICON = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_PVZICON_ID);
+        IMAGE_STORE_SIGN = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_SIGN_ID);
+        IMAGE_STORE_TREEOFWISDOMICON = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_TREEOFWISDOMICON_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -650,226 +654,239 @@ bool Sexy::ExtractDelayLoad_ZombatarResources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_ZOMBATAR_ACCEPT_BUTTON = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCEPT_BUTTON");
-        IMAGE_ZOMBATAR_ACCEPT_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCEPT_BUTTON_HIGHLIGHT");
-        IMAGE_ZOMBATAR_ACCESSORY_1 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_1");
-        IMAGE_ZOMBATAR_ACCESSORY_10 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_10");
-        IMAGE_ZOMBATAR_ACCESSORY_11 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_11");
-        IMAGE_ZOMBATAR_ACCESSORY_12 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_12");
-        IMAGE_ZOMBATAR_ACCESSORY_13 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_13");
-        IMAGE_ZOMBATAR_ACCESSORY_14 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_14");
-        IMAGE_ZOMBATAR_ACCESSORY_15 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_15");
-        IMAGE_ZOMBATAR_ACCESSORY_16 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_16");
-        IMAGE_ZOMBATAR_ACCESSORY_2 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_2");
-        IMAGE_ZOMBATAR_ACCESSORY_3 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_3");
-        IMAGE_ZOMBATAR_ACCESSORY_4 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_4");
-        IMAGE_ZOMBATAR_ACCESSORY_5 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_5");
-        IMAGE_ZOMBATAR_ACCESSORY_6 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_6");
-        IMAGE_ZOMBATAR_ACCESSORY_7 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_7");
-        IMAGE_ZOMBATAR_ACCESSORY_8 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_8");
-        IMAGE_ZOMBATAR_ACCESSORY_9 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_9");
-        IMAGE_ZOMBATAR_ACCESSORY_BG = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_BG");
-        IMAGE_ZOMBATAR_ACCESSORY_BG_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_BG_HIGHLIGHT");
-        IMAGE_ZOMBATAR_ACCESSORY_BG_NONE = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_BG_NONE");
-        IMAGE_ZOMBATAR_ACCESSORY_BUTTON = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_BUTTON");
-        IMAGE_ZOMBATAR_ACCESSORY_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_BUTTON_HIGHLIGHT");
-        IMAGE_ZOMBATAR_ACCESSORY_BUTTON_OVER = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ACCESSORY_BUTTON_OVER");
-        IMAGE_ZOMBATAR_BACKDROPS_BUTTON = aMgr.GetImageThrow("IMAGE_ZOMBATAR_BACKDROPS_BUTTON");
-        IMAGE_ZOMBATAR_BACKDROPS_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_BACKDROPS_BUTTON_HIGHLIGHT");
-        IMAGE_ZOMBATAR_BACKDROPS_BUTTON_OVER = aMgr.GetImageThrow("IMAGE_ZOMBATAR_BACKDROPS_BUTTON_OVER");
-        IMAGE_ZOMBATAR_BACKGROUND_BLANK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_BACKGROUND_BLANK");
-        IMAGE_ZOMBATAR_BACKGROUND_CRAZYDAVE = aMgr.GetImageThrow("IMAGE_ZOMBATAR_BACKGROUND_CRAZYDAVE");
-        IMAGE_ZOMBATAR_BACKGROUND_MENU = aMgr.GetImageThrow("IMAGE_ZOMBATAR_BACKGROUND_MENU");
-        IMAGE_ZOMBATAR_BACKGROUND_MENU_DOS = aMgr.GetImageThrow("IMAGE_ZOMBATAR_BACKGROUND_MENU_DOS");
-        IMAGE_ZOMBATAR_BACKGROUND_ROOF = aMgr.GetImageThrow("IMAGE_ZOMBATAR_BACKGROUND_ROOF");
-        IMAGE_ZOMBATAR_BACK_BUTTON = aMgr.GetImageThrow("IMAGE_ZOMBATAR_BACK_BUTTON");
-        IMAGE_ZOMBATAR_BACK_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_BACK_BUTTON_HIGHLIGHT");
-        IMAGE_ZOMBATAR_BEGIN_BUTTON = aMgr.GetImageThrow("IMAGE_ZOMBATAR_BEGIN_BUTTON");
-        IMAGE_ZOMBATAR_BEGIN_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_BEGIN_BUTTON_HIGHLIGHT");
-        IMAGE_ZOMBATAR_CLOTHES_1 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_CLOTHES_1");
-        IMAGE_ZOMBATAR_CLOTHES_10 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_CLOTHES_10");
-        IMAGE_ZOMBATAR_CLOTHES_11 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_CLOTHES_11");
-        IMAGE_ZOMBATAR_CLOTHES_12 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_CLOTHES_12");
-        IMAGE_ZOMBATAR_CLOTHES_2 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_CLOTHES_2");
-        IMAGE_ZOMBATAR_CLOTHES_3 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_CLOTHES_3");
-        IMAGE_ZOMBATAR_CLOTHES_4 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_CLOTHES_4");
-        IMAGE_ZOMBATAR_CLOTHES_5 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_CLOTHES_5");
-        IMAGE_ZOMBATAR_CLOTHES_6 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_CLOTHES_6");
-        IMAGE_ZOMBATAR_CLOTHES_7 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_CLOTHES_7");
-        IMAGE_ZOMBATAR_CLOTHES_8 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_CLOTHES_8");
-        IMAGE_ZOMBATAR_CLOTHES_9 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_CLOTHES_9");
-        IMAGE_ZOMBATAR_CLOTHES_BUTTON = aMgr.GetImageThrow("IMAGE_ZOMBATAR_CLOTHES_BUTTON");
-        IMAGE_ZOMBATAR_CLOTHES_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_CLOTHES_BUTTON_HIGHLIGHT");
-        IMAGE_ZOMBATAR_CLOTHES_BUTTON_OVER = aMgr.GetImageThrow("IMAGE_ZOMBATAR_CLOTHES_BUTTON_OVER");
-        IMAGE_ZOMBATAR_COLORPICKER = aMgr.GetImageThrow("IMAGE_ZOMBATAR_COLORPICKER");
-        IMAGE_ZOMBATAR_COLORPICKER_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_COLORPICKER_HIGHLIGHT");
-        IMAGE_ZOMBATAR_COLORPICKER_NONE = aMgr.GetImageThrow("IMAGE_ZOMBATAR_COLORPICKER_NONE");
-        IMAGE_ZOMBATAR_COLORS_BG = aMgr.GetImageThrow("IMAGE_ZOMBATAR_COLORS_BG");
-        IMAGE_ZOMBATAR_COLORS_BG_SMALL = aMgr.GetImageThrow("IMAGE_ZOMBATAR_COLORS_BG_SMALL");
-        IMAGE_ZOMBATAR_DISPLAY_WINDOW = aMgr.GetImageThrow("IMAGE_ZOMBATAR_DISPLAY_WINDOW");
-        IMAGE_ZOMBATAR_EYEWEAR_1 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_1");
-        IMAGE_ZOMBATAR_EYEWEAR_10 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_10");
-        IMAGE_ZOMBATAR_EYEWEAR_10_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_10_MASK");
-        IMAGE_ZOMBATAR_EYEWEAR_11 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_11");
-        IMAGE_ZOMBATAR_EYEWEAR_11_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_11_MASK");
-        IMAGE_ZOMBATAR_EYEWEAR_12 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_12");
-        IMAGE_ZOMBATAR_EYEWEAR_12_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_12_MASK");
-        IMAGE_ZOMBATAR_EYEWEAR_13 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_13");
-        IMAGE_ZOMBATAR_EYEWEAR_14 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_14");
-        IMAGE_ZOMBATAR_EYEWEAR_15 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_15");
-        IMAGE_ZOMBATAR_EYEWEAR_16 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_16");
-        IMAGE_ZOMBATAR_EYEWEAR_1_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_1_MASK");
-        IMAGE_ZOMBATAR_EYEWEAR_2 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_2");
-        IMAGE_ZOMBATAR_EYEWEAR_2_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_2_MASK");
-        IMAGE_ZOMBATAR_EYEWEAR_3 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_3");
-        IMAGE_ZOMBATAR_EYEWEAR_3_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_3_MASK");
-        IMAGE_ZOMBATAR_EYEWEAR_4 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_4");
-        IMAGE_ZOMBATAR_EYEWEAR_4_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_4_MASK");
-        IMAGE_ZOMBATAR_EYEWEAR_5 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_5");
-        IMAGE_ZOMBATAR_EYEWEAR_5_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_5_MASK");
-        IMAGE_ZOMBATAR_EYEWEAR_6 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_6");
-        IMAGE_ZOMBATAR_EYEWEAR_6_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_6_MASK");
-        IMAGE_ZOMBATAR_EYEWEAR_7 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_7");
-        IMAGE_ZOMBATAR_EYEWEAR_7_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_7_MASK");
-        IMAGE_ZOMBATAR_EYEWEAR_8 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_8");
-        IMAGE_ZOMBATAR_EYEWEAR_8_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_8_MASK");
-        IMAGE_ZOMBATAR_EYEWEAR_9 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_9");
-        IMAGE_ZOMBATAR_EYEWEAR_9_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_9_MASK");
-        IMAGE_ZOMBATAR_EYEWEAR_BUTTON = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_BUTTON");
-        IMAGE_ZOMBATAR_EYEWEAR_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_BUTTON_HIGHLIGHT");
-        IMAGE_ZOMBATAR_EYEWEAR_BUTTON_OVER = aMgr.GetImageThrow("IMAGE_ZOMBATAR_EYEWEAR_BUTTON_OVER");
-        IMAGE_ZOMBATAR_FACIALHAIR_1 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_1");
-        IMAGE_ZOMBATAR_FACIALHAIR_10 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_10");
-        IMAGE_ZOMBATAR_FACIALHAIR_10_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_10_MASK");
-        IMAGE_ZOMBATAR_FACIALHAIR_11 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_11");
-        IMAGE_ZOMBATAR_FACIALHAIR_11_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_11_MASK");
-        IMAGE_ZOMBATAR_FACIALHAIR_12 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_12");
-        IMAGE_ZOMBATAR_FACIALHAIR_12_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_12_MASK");
-        IMAGE_ZOMBATAR_FACIALHAIR_13 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_13");
-        IMAGE_ZOMBATAR_FACIALHAIR_14 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_14");
-        IMAGE_ZOMBATAR_FACIALHAIR_14_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_14_MASK");
-        IMAGE_ZOMBATAR_FACIALHAIR_15 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_15");
-        IMAGE_ZOMBATAR_FACIALHAIR_15_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_15_MASK");
-        IMAGE_ZOMBATAR_FACIALHAIR_16 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_16");
-        IMAGE_ZOMBATAR_FACIALHAIR_16_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_16_MASK");
-        IMAGE_ZOMBATAR_FACIALHAIR_17 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_17");
-        IMAGE_ZOMBATAR_FACIALHAIR_18 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_18");
-        IMAGE_ZOMBATAR_FACIALHAIR_18_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_18_MASK");
-        IMAGE_ZOMBATAR_FACIALHAIR_19 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_19");
-        IMAGE_ZOMBATAR_FACIALHAIR_1_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_1_MASK");
-        IMAGE_ZOMBATAR_FACIALHAIR_2 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_2");
-        IMAGE_ZOMBATAR_FACIALHAIR_20 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_20");
-        IMAGE_ZOMBATAR_FACIALHAIR_21 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_21");
-        IMAGE_ZOMBATAR_FACIALHAIR_21_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_21_MASK");
-        IMAGE_ZOMBATAR_FACIALHAIR_22 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_22");
-        IMAGE_ZOMBATAR_FACIALHAIR_22_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_22_MASK");
-        IMAGE_ZOMBATAR_FACIALHAIR_23 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_23");
-        IMAGE_ZOMBATAR_FACIALHAIR_23_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_23_MASK");
-        IMAGE_ZOMBATAR_FACIALHAIR_24 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_24");
-        IMAGE_ZOMBATAR_FACIALHAIR_24_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_24_MASK");
-        IMAGE_ZOMBATAR_FACIALHAIR_3 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_3");
-        IMAGE_ZOMBATAR_FACIALHAIR_4 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_4");
-        IMAGE_ZOMBATAR_FACIALHAIR_4_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_4_MASK");
-        IMAGE_ZOMBATAR_FACIALHAIR_5 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_5");
-        IMAGE_ZOMBATAR_FACIALHAIR_6 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_6");
-        IMAGE_ZOMBATAR_FACIALHAIR_7 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_7");
-        IMAGE_ZOMBATAR_FACIALHAIR_8 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_8");
-        IMAGE_ZOMBATAR_FACIALHAIR_8_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_8_MASK");
-        IMAGE_ZOMBATAR_FACIALHAIR_9 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_9");
-        IMAGE_ZOMBATAR_FACIALHAIR_9_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIALHAIR_9_MASK");
-        IMAGE_ZOMBATAR_FACIAL_HAIR_BUTTON = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIAL_HAIR_BUTTON");
-        IMAGE_ZOMBATAR_FACIAL_HAIR_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIAL_HAIR_BUTTON_HIGHLIGHT");
-        IMAGE_ZOMBATAR_FACIAL_HAIR_BUTTON_OVER = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FACIAL_HAIR_BUTTON_OVER");
-        IMAGE_ZOMBATAR_FINISHED_BUTTON = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FINISHED_BUTTON");
-        IMAGE_ZOMBATAR_FINISHED_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_FINISHED_BUTTON_HIGHLIGHT");
-        IMAGE_ZOMBATAR_HAIR_1 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_1");
-        IMAGE_ZOMBATAR_HAIR_10 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_10");
-        IMAGE_ZOMBATAR_HAIR_11 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_11");
-        IMAGE_ZOMBATAR_HAIR_11_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_11_MASK");
-        IMAGE_ZOMBATAR_HAIR_12 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_12");
-        IMAGE_ZOMBATAR_HAIR_12_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_12_MASK");
-        IMAGE_ZOMBATAR_HAIR_13 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_13");
-        IMAGE_ZOMBATAR_HAIR_13_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_13_MASK");
-        IMAGE_ZOMBATAR_HAIR_14 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_14");
-        IMAGE_ZOMBATAR_HAIR_14_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_14_MASK");
-        IMAGE_ZOMBATAR_HAIR_15 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_15");
-        IMAGE_ZOMBATAR_HAIR_15_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_15_MASK");
-        IMAGE_ZOMBATAR_HAIR_16 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_16");
-        IMAGE_ZOMBATAR_HAIR_1_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_1_MASK");
-        IMAGE_ZOMBATAR_HAIR_2 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_2");
-        IMAGE_ZOMBATAR_HAIR_2_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_2_MASK");
-        IMAGE_ZOMBATAR_HAIR_3 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_3");
-        IMAGE_ZOMBATAR_HAIR_4 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_4");
-        IMAGE_ZOMBATAR_HAIR_5 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_5");
-        IMAGE_ZOMBATAR_HAIR_6 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_6");
-        IMAGE_ZOMBATAR_HAIR_7 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_7");
-        IMAGE_ZOMBATAR_HAIR_8 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_8");
-        IMAGE_ZOMBATAR_HAIR_9 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_9");
-        IMAGE_ZOMBATAR_HAIR_BUTTON = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_BUTTON");
-        IMAGE_ZOMBATAR_HAIR_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_BUTTON_HIGHLIGHT");
-        IMAGE_ZOMBATAR_HAIR_BUTTON_OVER = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HAIR_BUTTON_OVER");
-        IMAGE_ZOMBATAR_HATS_1 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_1");
-        IMAGE_ZOMBATAR_HATS_10 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_10");
-        IMAGE_ZOMBATAR_HATS_11 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_11");
-        IMAGE_ZOMBATAR_HATS_11_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_11_MASK");
-        IMAGE_ZOMBATAR_HATS_12 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_12");
-        IMAGE_ZOMBATAR_HATS_13 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_13");
-        IMAGE_ZOMBATAR_HATS_14 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_14");
-        IMAGE_ZOMBATAR_HATS_1_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_1_MASK");
-        IMAGE_ZOMBATAR_HATS_2 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_2");
-        IMAGE_ZOMBATAR_HATS_3 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_3");
-        IMAGE_ZOMBATAR_HATS_3_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_3_MASK");
-        IMAGE_ZOMBATAR_HATS_4 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_4");
-        IMAGE_ZOMBATAR_HATS_5 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_5");
-        IMAGE_ZOMBATAR_HATS_6 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_6");
-        IMAGE_ZOMBATAR_HATS_6_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_6_MASK");
-        IMAGE_ZOMBATAR_HATS_7 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_7");
-        IMAGE_ZOMBATAR_HATS_7_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_7_MASK");
-        IMAGE_ZOMBATAR_HATS_8 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_8");
-        IMAGE_ZOMBATAR_HATS_8_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_8_MASK");
-        IMAGE_ZOMBATAR_HATS_9 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_9");
-        IMAGE_ZOMBATAR_HATS_9_MASK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_9_MASK");
-        IMAGE_ZOMBATAR_HATS_BUTTON = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_BUTTON");
-        IMAGE_ZOMBATAR_HATS_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_BUTTON_HIGHLIGHT");
-        IMAGE_ZOMBATAR_HATS_BUTTON_OVER = aMgr.GetImageThrow("IMAGE_ZOMBATAR_HATS_BUTTON_OVER");
-        IMAGE_ZOMBATAR_LOGO = aMgr.GetImageThrow("IMAGE_ZOMBATAR_LOGO");
-        IMAGE_ZOMBATAR_MAINMENUBACK_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_MAINMENUBACK_HIGHLIGHT");
-        IMAGE_ZOMBATAR_MAIN_BG = aMgr.GetImageThrow("IMAGE_ZOMBATAR_MAIN_BG");
-        IMAGE_ZOMBATAR_NEWZOMBIE_BUTTON = aMgr.GetImageThrow("IMAGE_ZOMBATAR_NEWZOMBIE_BUTTON");
-        IMAGE_ZOMBATAR_NEWZOMBIE_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_NEWZOMBIE_BUTTON_HIGHLIGHT");
-        IMAGE_ZOMBATAR_NEXT_BUTTON = aMgr.GetImageThrow("IMAGE_ZOMBATAR_NEXT_BUTTON");
-        IMAGE_ZOMBATAR_NEXT_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_NEXT_BUTTON_HIGHLIGHT");
-        IMAGE_ZOMBATAR_PREV_BUTTON = aMgr.GetImageThrow("IMAGE_ZOMBATAR_PREV_BUTTON");
-        IMAGE_ZOMBATAR_PREV_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_PREV_BUTTON_HIGHLIGHT");
-        IMAGE_ZOMBATAR_SKIN_BUTTON = aMgr.GetImageThrow("IMAGE_ZOMBATAR_SKIN_BUTTON");
-        IMAGE_ZOMBATAR_SKIN_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_SKIN_BUTTON_HIGHLIGHT");
-        IMAGE_ZOMBATAR_TIDBITS_1 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TIDBITS_1");
-        IMAGE_ZOMBATAR_TIDBITS_10 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TIDBITS_10");
-        IMAGE_ZOMBATAR_TIDBITS_11 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TIDBITS_11");
-        IMAGE_ZOMBATAR_TIDBITS_12 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TIDBITS_12");
-        IMAGE_ZOMBATAR_TIDBITS_13 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TIDBITS_13");
-        IMAGE_ZOMBATAR_TIDBITS_14 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TIDBITS_14");
-        IMAGE_ZOMBATAR_TIDBITS_2 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TIDBITS_2");
-        IMAGE_ZOMBATAR_TIDBITS_3 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TIDBITS_3");
-        IMAGE_ZOMBATAR_TIDBITS_4 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TIDBITS_4");
-        IMAGE_ZOMBATAR_TIDBITS_5 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TIDBITS_5");
-        IMAGE_ZOMBATAR_TIDBITS_6 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TIDBITS_6");
-        IMAGE_ZOMBATAR_TIDBITS_7 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TIDBITS_7");
-        IMAGE_ZOMBATAR_TIDBITS_8 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TIDBITS_8");
-        IMAGE_ZOMBATAR_TIDBITS_9 = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TIDBITS_9");
-        IMAGE_ZOMBATAR_TIDBITS_BUTTON = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TIDBITS_BUTTON");
-        IMAGE_ZOMBATAR_TIDBITS_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TIDBITS_BUTTON_HIGHLIGHT");
-        IMAGE_ZOMBATAR_TIDBITS_BUTTON_OVER = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TIDBITS_BUTTON_OVER");
-        IMAGE_ZOMBATAR_TOS_ARROW = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TOS_ARROW");
-        IMAGE_ZOMBATAR_TOS_SLIDER = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TOS_SLIDER");
-        IMAGE_ZOMBATAR_TOS_SLIDER_THUMB = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TOS_SLIDER_THUMB");
-        IMAGE_ZOMBATAR_TRIPTYCH = aMgr.GetImageThrow("IMAGE_ZOMBATAR_TRIPTYCH");
-        IMAGE_ZOMBATAR_VIEW_BUTTON = aMgr.GetImageThrow("IMAGE_ZOMBATAR_VIEW_BUTTON");
-        IMAGE_ZOMBATAR_VIEW_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZOMBATAR_VIEW_BUTTON_HIGHLIGHT");
-        IMAGE_ZOMBATAR_WIDGET_BG = aMgr.GetImageThrow("IMAGE_ZOMBATAR_WIDGET_BG");
-        IMAGE_ZOMBATAR_WIDGET_INNER_BG = aMgr.GetImageThrow("IMAGE_ZOMBATAR_WIDGET_INNER_BG");
-        IMAGE_ZOMBATAR_ZOMBIE_BLANK = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ZOMBIE_BLANK");
-        IMAGE_ZOMBATAR_ZOMBIE_BLANK_SKIN = aMgr.GetImageThrow("IMAGE_ZOMBATAR_ZOMBIE_BLANK_SKIN");
+        IMAGE_ZOMBATAR_ACCEPT_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCEPT_BUTTON_ID);
+        IMAGE_ZOMBATAR_ACCEPT_BUTTON_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCEPT_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_1 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_1_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_10 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_10_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_11 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_11_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_12 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_12_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_13 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_13_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_14 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_14_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_15 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_15_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_16 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_16_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_2 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_2_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_3 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_3_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_4 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_4_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_5 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_5_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_6 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_6_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_7 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_7_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_8 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_8_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_9 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_9_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_BG = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_BG_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_BG_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_BG_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_BG_NONE = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_BG_NONE_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_BUTTON_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_BUTTON_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_ACCESSORY_BUTTON_OVER = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ACCESSORY_BUTTON_OVER_ID);
+        IMAGE_ZOMBATAR_BACKDROPS_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_BACKDROPS_BUTTON_ID);
+        IMAGE_ZOMBATAR_BACKDROPS_BUTTON_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_BACKDROPS_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_BACKDROPS_BUTTON_OVER = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_BACKDROPS_BUTTON_OVER_ID);
+        IMAGE_ZOMBATAR_BACKGROUND_BLANK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_BACKGROUND_BLANK_ID);
+        IMAGE_ZOMBATAR_BACKGROUND_CRAZYDAVE = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_BACKGROUND_CRAZYDAVE_ID);
+        IMAGE_ZOMBATAR_BACKGROUND_MENU = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_BACKGROUND_MENU_ID);
+        IMAGE_ZOMBATAR_BACKGROUND_MENU_DOS = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_BACKGROUND_MENU_DOS_ID);
+        IMAGE_ZOMBATAR_BACKGROUND_ROOF = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_BACKGROUND_ROOF_ID);
+        IMAGE_ZOMBATAR_BACK_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_BACK_BUTTON_ID);
+        IMAGE_ZOMBATAR_BACK_BUTTON_HIGHLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_BACK_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_BEGIN_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_BEGIN_BUTTON_ID);
+        IMAGE_ZOMBATAR_BEGIN_BUTTON_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_BEGIN_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_CLOTHES_1 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_CLOTHES_1_ID);
+        IMAGE_ZOMBATAR_CLOTHES_10 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_CLOTHES_10_ID);
+        IMAGE_ZOMBATAR_CLOTHES_11 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_CLOTHES_11_ID);
+        IMAGE_ZOMBATAR_CLOTHES_12 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_CLOTHES_12_ID);
+        IMAGE_ZOMBATAR_CLOTHES_2 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_CLOTHES_2_ID);
+        IMAGE_ZOMBATAR_CLOTHES_3 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_CLOTHES_3_ID);
+        IMAGE_ZOMBATAR_CLOTHES_4 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_CLOTHES_4_ID);
+        IMAGE_ZOMBATAR_CLOTHES_5 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_CLOTHES_5_ID);
+        IMAGE_ZOMBATAR_CLOTHES_6 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_CLOTHES_6_ID);
+        IMAGE_ZOMBATAR_CLOTHES_7 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_CLOTHES_7_ID);
+        IMAGE_ZOMBATAR_CLOTHES_8 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_CLOTHES_8_ID);
+        IMAGE_ZOMBATAR_CLOTHES_9 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_CLOTHES_9_ID);
+        IMAGE_ZOMBATAR_CLOTHES_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_CLOTHES_BUTTON_ID);
+        IMAGE_ZOMBATAR_CLOTHES_BUTTON_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_CLOTHES_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_CLOTHES_BUTTON_OVER = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_CLOTHES_BUTTON_OVER_ID);
+        IMAGE_ZOMBATAR_COLORPICKER = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_COLORPICKER_ID);
+        IMAGE_ZOMBATAR_COLORPICKER_HIGHLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_COLORPICKER_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_COLORPICKER_NONE = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_COLORPICKER_NONE_ID);
+        IMAGE_ZOMBATAR_COLORS_BG = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_COLORS_BG_ID);
+        IMAGE_ZOMBATAR_COLORS_BG_SMALL = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_COLORS_BG_SMALL_ID);
+        IMAGE_ZOMBATAR_DISPLAY_WINDOW = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_DISPLAY_WINDOW_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_1 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_1_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_10 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_10_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_10_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_10_MASK_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_11 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_11_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_11_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_11_MASK_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_12 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_12_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_12_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_12_MASK_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_13 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_13_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_14 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_14_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_15 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_15_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_16 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_16_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_1_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_1_MASK_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_2 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_2_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_2_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_2_MASK_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_3 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_3_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_3_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_3_MASK_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_4 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_4_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_4_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_4_MASK_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_5 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_5_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_5_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_5_MASK_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_6 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_6_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_6_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_6_MASK_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_7 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_7_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_7_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_7_MASK_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_8 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_8_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_8_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_8_MASK_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_9 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_9_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_9_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_9_MASK_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_BUTTON_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_BUTTON_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_EYEWEAR_BUTTON_OVER = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_EYEWEAR_BUTTON_OVER_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_1 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_1_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_10 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_10_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_10_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_10_MASK_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_11 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_11_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_11_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_11_MASK_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_12 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_12_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_12_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_12_MASK_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_13 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_13_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_14 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_14_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_14_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_14_MASK_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_15 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_15_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_15_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_15_MASK_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_16 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_16_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_16_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_16_MASK_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_17 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_17_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_18 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_18_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_18_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_18_MASK_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_19 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_19_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_1_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_1_MASK_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_2 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_2_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_20 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_20_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_21 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_21_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_21_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_21_MASK_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_22 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_22_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_22_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_22_MASK_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_23 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_23_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_23_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_23_MASK_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_24 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_24_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_24_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_24_MASK_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_3 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_3_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_4 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_4_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_4_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_4_MASK_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_5 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_5_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_6 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_6_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_7 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_7_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_8 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_8_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_8_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_8_MASK_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_9 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_9_ID);
+        IMAGE_ZOMBATAR_FACIALHAIR_9_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIALHAIR_9_MASK_ID);
+        IMAGE_ZOMBATAR_FACIAL_HAIR_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIAL_HAIR_BUTTON_ID);
+        IMAGE_ZOMBATAR_FACIAL_HAIR_BUTTON_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIAL_HAIR_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_FACIAL_HAIR_BUTTON_OVER =
+            aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FACIAL_HAIR_BUTTON_OVER_ID);
+        IMAGE_ZOMBATAR_FINISHED_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FINISHED_BUTTON_ID);
+        IMAGE_ZOMBATAR_FINISHED_BUTTON_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_FINISHED_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_HAIR_1 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_1_ID);
+        IMAGE_ZOMBATAR_HAIR_10 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_10_ID);
+        IMAGE_ZOMBATAR_HAIR_11 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_11_ID);
+        IMAGE_ZOMBATAR_HAIR_11_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_11_MASK_ID);
+        IMAGE_ZOMBATAR_HAIR_12 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_12_ID);
+        IMAGE_ZOMBATAR_HAIR_12_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_12_MASK_ID);
+        IMAGE_ZOMBATAR_HAIR_13 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_13_ID);
+        IMAGE_ZOMBATAR_HAIR_13_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_13_MASK_ID);
+        IMAGE_ZOMBATAR_HAIR_14 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_14_ID);
+        IMAGE_ZOMBATAR_HAIR_14_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_14_MASK_ID);
+        IMAGE_ZOMBATAR_HAIR_15 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_15_ID);
+        IMAGE_ZOMBATAR_HAIR_15_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_15_MASK_ID);
+        IMAGE_ZOMBATAR_HAIR_16 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_16_ID);
+        IMAGE_ZOMBATAR_HAIR_1_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_1_MASK_ID);
+        IMAGE_ZOMBATAR_HAIR_2 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_2_ID);
+        IMAGE_ZOMBATAR_HAIR_2_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_2_MASK_ID);
+        IMAGE_ZOMBATAR_HAIR_3 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_3_ID);
+        IMAGE_ZOMBATAR_HAIR_4 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_4_ID);
+        IMAGE_ZOMBATAR_HAIR_5 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_5_ID);
+        IMAGE_ZOMBATAR_HAIR_6 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_6_ID);
+        IMAGE_ZOMBATAR_HAIR_7 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_7_ID);
+        IMAGE_ZOMBATAR_HAIR_8 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_8_ID);
+        IMAGE_ZOMBATAR_HAIR_9 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_9_ID);
+        IMAGE_ZOMBATAR_HAIR_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_BUTTON_ID);
+        IMAGE_ZOMBATAR_HAIR_BUTTON_HIGHLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_HAIR_BUTTON_OVER = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HAIR_BUTTON_OVER_ID);
+        IMAGE_ZOMBATAR_HATS_1 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_1_ID);
+        IMAGE_ZOMBATAR_HATS_10 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_10_ID);
+        IMAGE_ZOMBATAR_HATS_11 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_11_ID);
+        IMAGE_ZOMBATAR_HATS_11_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_11_MASK_ID);
+        IMAGE_ZOMBATAR_HATS_12 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_12_ID);
+        IMAGE_ZOMBATAR_HATS_13 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_13_ID);
+        IMAGE_ZOMBATAR_HATS_14 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_14_ID);
+        IMAGE_ZOMBATAR_HATS_1_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_1_MASK_ID);
+        IMAGE_ZOMBATAR_HATS_2 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_2_ID);
+        IMAGE_ZOMBATAR_HATS_3 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_3_ID);
+        IMAGE_ZOMBATAR_HATS_3_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_3_MASK_ID);
+        IMAGE_ZOMBATAR_HATS_4 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_4_ID);
+        IMAGE_ZOMBATAR_HATS_5 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_5_ID);
+        IMAGE_ZOMBATAR_HATS_6 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_6_ID);
+        IMAGE_ZOMBATAR_HATS_6_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_6_MASK_ID);
+        IMAGE_ZOMBATAR_HATS_7 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_7_ID);
+        IMAGE_ZOMBATAR_HATS_7_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_7_MASK_ID);
+        IMAGE_ZOMBATAR_HATS_8 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_8_ID);
+        IMAGE_ZOMBATAR_HATS_8_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_8_MASK_ID);
+        IMAGE_ZOMBATAR_HATS_9 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_9_ID);
+        IMAGE_ZOMBATAR_HATS_9_MASK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_9_MASK_ID);
+        IMAGE_ZOMBATAR_HATS_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_BUTTON_ID);
+        IMAGE_ZOMBATAR_HATS_BUTTON_HIGHLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_HATS_BUTTON_OVER = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_HATS_BUTTON_OVER_ID);
+        IMAGE_ZOMBATAR_LOGO = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_LOGO_ID);
+        IMAGE_ZOMBATAR_MAINMENUBACK_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_MAINMENUBACK_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_MAIN_BG = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_MAIN_BG_ID);
+        IMAGE_ZOMBATAR_NEWZOMBIE_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_NEWZOMBIE_BUTTON_ID);
+        IMAGE_ZOMBATAR_NEWZOMBIE_BUTTON_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_NEWZOMBIE_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_NEXT_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_NEXT_BUTTON_ID);
+        IMAGE_ZOMBATAR_NEXT_BUTTON_HIGHLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_NEXT_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_PREV_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_PREV_BUTTON_ID);
+        IMAGE_ZOMBATAR_PREV_BUTTON_HIGHLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_PREV_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_SKIN_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_SKIN_BUTTON_ID);
+        IMAGE_ZOMBATAR_SKIN_BUTTON_HIGHLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_SKIN_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_TIDBITS_1 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TIDBITS_1_ID);
+        IMAGE_ZOMBATAR_TIDBITS_10 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TIDBITS_10_ID);
+        IMAGE_ZOMBATAR_TIDBITS_11 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TIDBITS_11_ID);
+        IMAGE_ZOMBATAR_TIDBITS_12 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TIDBITS_12_ID);
+        IMAGE_ZOMBATAR_TIDBITS_13 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TIDBITS_13_ID);
+        IMAGE_ZOMBATAR_TIDBITS_14 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TIDBITS_14_ID);
+        IMAGE_ZOMBATAR_TIDBITS_2 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TIDBITS_2_ID);
+        IMAGE_ZOMBATAR_TIDBITS_3 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TIDBITS_3_ID);
+        IMAGE_ZOMBATAR_TIDBITS_4 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TIDBITS_4_ID);
+        IMAGE_ZOMBATAR_TIDBITS_5 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TIDBITS_5_ID);
+        IMAGE_ZOMBATAR_TIDBITS_6 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TIDBITS_6_ID);
+        IMAGE_ZOMBATAR_TIDBITS_7 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TIDBITS_7_ID);
+        IMAGE_ZOMBATAR_TIDBITS_8 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TIDBITS_8_ID);
+        IMAGE_ZOMBATAR_TIDBITS_9 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TIDBITS_9_ID);
+        IMAGE_ZOMBATAR_TIDBITS_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TIDBITS_BUTTON_ID);
+        IMAGE_ZOMBATAR_TIDBITS_BUTTON_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TIDBITS_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_TIDBITS_BUTTON_OVER = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TIDBITS_BUTTON_OVER_ID);
+        IMAGE_ZOMBATAR_TOS_ARROW = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TOS_ARROW_ID);
+        IMAGE_ZOMBATAR_TOS_SLIDER = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TOS_SLIDER_ID);
+        IMAGE_ZOMBATAR_TOS_SLIDER_THUMB = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TOS_SLIDER_THUMB_ID);
+        IMAGE_ZOMBATAR_TRIPTYCH = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_TRIPTYCH_ID);
+        IMAGE_ZOMBATAR_VIEW_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_VIEW_BUTTON_ID);
+        IMAGE_ZOMBATAR_VIEW_BUTTON_HIGHLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_VIEW_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ZOMBATAR_WIDGET_BG = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_WIDGET_BG_ID);
+        IMAGE_ZOMBATAR_WIDGET_INNER_BG = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_WIDGET_INNER_BG_ID);
+        IMAGE_ZOMBATAR_ZOMBIE_BLANK = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ZOMBIE_BLANK_ID);
+        IMAGE_ZOMBATAR_ZOMBIE_BLANK_SKIN = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBATAR_ZOMBIE_BLANK_SKIN_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -884,7 +901,7 @@ bool Sexy::ExtractDelayLoad_ZombieFinalNoteResources(ResourceManager *theManager
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_ZOMBIE_FINAL_NOTE = aMgr.GetImageThrow("IMAGE_ZOMBIE_FINAL_NOTE");
+        IMAGE_ZOMBIE_FINAL_NOTE = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_FINAL_NOTE_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -899,7 +916,7 @@ bool Sexy::ExtractDelayLoad_ZombieNoteResources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_ZOMBIE_NOTE = aMgr.GetImageThrow("IMAGE_ZOMBIE_NOTE");
+        IMAGE_ZOMBIE_NOTE = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_NOTE_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -914,7 +931,7 @@ bool Sexy::ExtractDelayLoad_ZombieNote1Resources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_ZOMBIE_NOTE1 = aMgr.GetImageThrow("IMAGE_ZOMBIE_NOTE1");
+        IMAGE_ZOMBIE_NOTE1 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_NOTE1_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -929,7 +946,7 @@ bool Sexy::ExtractDelayLoad_ZombieNote2Resources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_ZOMBIE_NOTE2 = aMgr.GetImageThrow("IMAGE_ZOMBIE_NOTE2");
+        IMAGE_ZOMBIE_NOTE2 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_NOTE2_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -944,7 +961,7 @@ bool Sexy::ExtractDelayLoad_ZombieNote3Resources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_ZOMBIE_NOTE3 = aMgr.GetImageThrow("IMAGE_ZOMBIE_NOTE3");
+        IMAGE_ZOMBIE_NOTE3 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_NOTE3_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -959,7 +976,7 @@ bool Sexy::ExtractDelayLoad_ZombieNote4Resources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_ZOMBIE_NOTE4 = aMgr.GetImageThrow("IMAGE_ZOMBIE_NOTE4");
+        IMAGE_ZOMBIE_NOTE4 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_NOTE4_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -974,7 +991,7 @@ bool Sexy::ExtractDelayLoad_ZombieNoteHelpResources(ResourceManager *theManager)
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_ZOMBIE_NOTE_HELP = aMgr.GetImageThrow("IMAGE_ZOMBIE_NOTE_HELP");
+        IMAGE_ZOMBIE_NOTE_HELP = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_NOTE_HELP_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -991,9 +1008,9 @@ bool Sexy::ExtractDelayLoad_ZombiquariumResources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_AQUARIUM1 = aMgr.GetImageThrow("IMAGE_AQUARIUM1");
-        IMAGE_WAVECENTER = aMgr.GetImageThrow("IMAGE_WAVECENTER");
-        IMAGE_WAVESIDE = aMgr.GetImageThrow("IMAGE_WAVESIDE");
+        IMAGE_AQUARIUM1 = aMgr.GetImageThrow(ResourceId::IMAGE_AQUARIUM1_ID);
+        IMAGE_WAVECENTER = aMgr.GetImageThrow(ResourceId::IMAGE_WAVECENTER_ID);
+        IMAGE_WAVESIDE = aMgr.GetImageThrow(ResourceId::IMAGE_WAVESIDE_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -1010,9 +1027,9 @@ bool Sexy::ExtractInitResources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_BLANK = aMgr.GetImageThrow("IMAGE_BLANK");
-        IMAGE_PARTNER_LOGO = aMgr.GetImageThrow("IMAGE_PARTNER_LOGO");
-        IMAGE_POPCAP_LOGO = aMgr.GetImageThrow("IMAGE_POPCAP_LOGO");
+        IMAGE_BLANK = aMgr.GetImageThrow(ResourceId::IMAGE_BLANK_ID);
+        IMAGE_PARTNER_LOGO = aMgr.GetImageThrow(ResourceId::IMAGE_PARTNER_LOGO_ID);
+        IMAGE_POPCAP_LOGO = aMgr.GetImageThrow(ResourceId::IMAGE_POPCAP_LOGO_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -1035,15 +1052,15 @@ bool Sexy::ExtractLoaderBarResources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        FONT_BRIANNETOD16 = aMgr.GetFontThrow("FONT_BRIANNETOD16");
-        IMAGE_LOADBAR_DIRT = aMgr.GetImageThrow("IMAGE_LOADBAR_DIRT");
-        IMAGE_LOADBAR_GRASS = aMgr.GetImageThrow("IMAGE_LOADBAR_GRASS");
-        IMAGE_PVZ_LOGO = aMgr.GetImageThrow("IMAGE_PVZ_LOGO");
-        IMAGE_REANIM_SODROLLCAP = aMgr.GetImageThrow("IMAGE_REANIM_SODROLLCAP");
-        IMAGE_TITLESCREEN = aMgr.GetImageThrow("IMAGE_TITLESCREEN");
-        SOUND_BUTTONCLICK = aMgr.GetSoundThrow("SOUND_BUTTONCLICK");
-        SOUND_LOADINGBAR_FLOWER = aMgr.GetSoundThrow("SOUND_LOADINGBAR_FLOWER");
-        SOUND_LOADINGBAR_ZOMBIE = aMgr.GetSoundThrow("SOUND_LOADINGBAR_ZOMBIE");
+        FONT_BRIANNETOD16 = aMgr.GetFontThrow(ResourceId::FONT_BRIANNETOD16_ID);
+        IMAGE_LOADBAR_DIRT = aMgr.GetImageThrow(ResourceId::IMAGE_LOADBAR_DIRT_ID);
+        IMAGE_LOADBAR_GRASS = aMgr.GetImageThrow(ResourceId::IMAGE_LOADBAR_GRASS_ID);
+        IMAGE_PVZ_LOGO = aMgr.GetImageThrow(ResourceId::IMAGE_PVZ_LOGO_ID);
+        IMAGE_REANIM_SODROLLCAP = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SODROLLCAP_ID);
+        IMAGE_TITLESCREEN = aMgr.GetImageThrow(ResourceId::IMAGE_TITLESCREEN_ID);
+        SOUND_BUTTONCLICK = aMgr.GetSoundThrow(ResourceId::SOUND_BUTTONCLICK_ID);
+        SOUND_LOADINGBAR_FLOWER = aMgr.GetSoundThrow(ResourceId::SOUND_LOADINGBAR_FLOWER_ID);
+        SOUND_LOADINGBAR_ZOMBIE = aMgr.GetSoundThrow(ResourceId::SOUND_LOADINGBAR_ZOMBIE_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -1075,24 +1092,26 @@ bool Sexy::ExtractLoadingFontsResources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        FONT_BRIANNETOD12 = aMgr.GetFontThrow("FONT_BRIANNETOD12");
-        FONT_CONTINUUMBOLD14 = aMgr.GetFontThrow("FONT_CONTINUUMBOLD14");
-        FONT_CONTINUUMBOLD14OUTLINE = aMgr.GetFontThrow("FONT_CONTINUUMBOLD14OUTLINE");
-        FONT_DWARVENTODCRAFT12 = aMgr.GetFontThrow("FONT_DWARVENTODCRAFT12");
-        FONT_DWARVENTODCRAFT15 = aMgr.GetFontThrow("FONT_DWARVENTODCRAFT15");
-        FONT_DWARVENTODCRAFT18 = aMgr.GetFontThrow("FONT_DWARVENTODCRAFT18");
-        FONT_DWARVENTODCRAFT18BRIGHTGREENINSET = aMgr.GetFontThrow("FONT_DWARVENTODCRAFT18BRIGHTGREENINSET");
-        FONT_DWARVENTODCRAFT18GREENINSET = aMgr.GetFontThrow("FONT_DWARVENTODCRAFT18GREENINSET");
-        FONT_DWARVENTODCRAFT18YELLOW = aMgr.GetFontThrow("FONT_DWARVENTODCRAFT18YELLOW");
-        FONT_DWARVENTODCRAFT24 = aMgr.GetFontThrow("FONT_DWARVENTODCRAFT24");
-        FONT_DWARVENTODCRAFT36BRIGHTGREENINSET = aMgr.GetFontThrow("FONT_DWARVENTODCRAFT36BRIGHTGREENINSET");
-        FONT_DWARVENTODCRAFT36GREENINSET = aMgr.GetFontThrow("FONT_DWARVENTODCRAFT36GREENINSET");
-        FONT_HOUSEOFTERROR16 = aMgr.GetFontThrow("FONT_HOUSEOFTERROR16");
-        FONT_HOUSEOFTERROR20 = aMgr.GetFontThrow("FONT_HOUSEOFTERROR20");
-        FONT_HOUSEOFTERROR28 = aMgr.GetFontThrow("FONT_HOUSEOFTERROR28");
-        FONT_IMAGE_HOUSEOFTERROR28 = aMgr.GetImageThrow("FONT_IMAGE_HOUSEOFTERROR28");
-        FONT_PICO129 = aMgr.GetFontThrow("FONT_PICO129");
-        FONT_TINYBOLD = aMgr.GetFontThrow("FONT_TINYBOLD");
+        FONT_BRIANNETOD12 = aMgr.GetFontThrow(ResourceId::FONT_BRIANNETOD12_ID);
+        FONT_CONTINUUMBOLD14 = aMgr.GetFontThrow(ResourceId::FONT_CONTINUUMBOLD14_ID);
+        FONT_CONTINUUMBOLD14OUTLINE = aMgr.GetFontThrow(ResourceId::FONT_CONTINUUMBOLD14OUTLINE_ID);
+        FONT_DWARVENTODCRAFT12 = aMgr.GetFontThrow(ResourceId::FONT_DWARVENTODCRAFT12_ID);
+        FONT_DWARVENTODCRAFT15 = aMgr.GetFontThrow(ResourceId::FONT_DWARVENTODCRAFT15_ID);
+        FONT_DWARVENTODCRAFT18 = aMgr.GetFontThrow(ResourceId::FONT_DWARVENTODCRAFT18_ID);
+        FONT_DWARVENTODCRAFT18BRIGHTGREENINSET =
+            aMgr.GetFontThrow(ResourceId::FONT_DWARVENTODCRAFT18BRIGHTGREENINSET_ID);
+        FONT_DWARVENTODCRAFT18GREENINSET = aMgr.GetFontThrow(ResourceId::FONT_DWARVENTODCRAFT18GREENINSET_ID);
+        FONT_DWARVENTODCRAFT18YELLOW = aMgr.GetFontThrow(ResourceId::FONT_DWARVENTODCRAFT18YELLOW_ID);
+        FONT_DWARVENTODCRAFT24 = aMgr.GetFontThrow(ResourceId::FONT_DWARVENTODCRAFT24_ID);
+        FONT_DWARVENTODCRAFT36BRIGHTGREENINSET =
+            aMgr.GetFontThrow(ResourceId::FONT_DWARVENTODCRAFT36BRIGHTGREENINSET_ID);
+        FONT_DWARVENTODCRAFT36GREENINSET = aMgr.GetFontThrow(ResourceId::FONT_DWARVENTODCRAFT36GREENINSET_ID);
+        FONT_HOUSEOFTERROR16 = aMgr.GetFontThrow(ResourceId::FONT_HOUSEOFTERROR16_ID);
+        FONT_HOUSEOFTERROR20 = aMgr.GetFontThrow(ResourceId::FONT_HOUSEOFTERROR20_ID);
+        FONT_HOUSEOFTERROR28 = aMgr.GetFontThrow(ResourceId::FONT_HOUSEOFTERROR28_ID);
+        FONT_IMAGE_HOUSEOFTERROR28 = aMgr.GetImageThrow(ResourceId::FONT_IMAGE_HOUSEOFTERROR28_ID);
+        FONT_PICO129 = aMgr.GetFontThrow(ResourceId::FONT_PICO129_ID);
+        FONT_TINYBOLD = aMgr.GetFontThrow(ResourceId::FONT_TINYBOLD_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -1473,391 +1492,453 @@ bool Sexy::ExtractLoadingImagesResources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        IMAGE_ACHEESEMENTS_BACK_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ACHEESEMENTS_BACK_HIGHLIGHT");
-        IMAGE_ACHEESEMENTS_BEJEWELED = aMgr.GetImageThrow("IMAGE_ACHEESEMENTS_BEJEWELED");
-        IMAGE_ACHEESEMENTS_BOOKWORM = aMgr.GetImageThrow("IMAGE_ACHEESEMENTS_BOOKWORM");
-        IMAGE_ACHEESEMENTS_CHINA = aMgr.GetImageThrow("IMAGE_ACHEESEMENTS_CHINA");
-        IMAGE_ACHEESEMENTS_CHUZZLE = aMgr.GetImageThrow("IMAGE_ACHEESEMENTS_CHUZZLE");
-        IMAGE_ACHEESEMENTS_HOLE_TILE = aMgr.GetImageThrow("IMAGE_ACHEESEMENTS_HOLE_TILE");
-        IMAGE_ACHEESEMENTS_ICONS = aMgr.GetImageThrow("IMAGE_ACHEESEMENTS_ICONS");
-        IMAGE_ACHEESEMENTS_MORE_BUTTON = aMgr.GetImageThrow("IMAGE_ACHEESEMENTS_MORE_BUTTON");
-        IMAGE_ACHEESEMENTS_MORE_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ACHEESEMENTS_MORE_BUTTON_HIGHLIGHT");
-        IMAGE_ACHEESEMENTS_MORE_ROCK = aMgr.GetImageThrow("IMAGE_ACHEESEMENTS_MORE_ROCK");
-        IMAGE_ACHEESEMENTS_PEGGLE = aMgr.GetImageThrow("IMAGE_ACHEESEMENTS_PEGGLE");
-        IMAGE_ACHEESEMENTS_PIPE = aMgr.GetImageThrow("IMAGE_ACHEESEMENTS_PIPE");
-        IMAGE_ACHEESEMENTS_TOP_BUTTON = aMgr.GetImageThrow("IMAGE_ACHEESEMENTS_TOP_BUTTON");
-        IMAGE_ACHEESEMENTS_TOP_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ACHEESEMENTS_TOP_BUTTON_HIGHLIGHT");
-        IMAGE_ACHEESEMENTS_ZUMA = aMgr.GetImageThrow("IMAGE_ACHEESEMENTS_ZUMA");
-        IMAGE_ALMANAC = aMgr.GetImageThrow("IMAGE_ALMANAC");
-        IMAGE_ALMANAC_IMITATER = aMgr.GetImageThrow("IMAGE_ALMANAC_IMITATER");
-        IMAGE_AWARDPICKUPGLOW = aMgr.GetImageThrow("IMAGE_AWARDPICKUPGLOW");
-        IMAGE_BEGHOULED_TWIST_OVERLAY = aMgr.GetImageThrow("IMAGE_BEGHOULED_TWIST_OVERLAY");
-        IMAGE_BRAIN = aMgr.GetImageThrow("IMAGE_BRAIN");
-        IMAGE_BUG_SPRAY = aMgr.GetImageThrow("IMAGE_BUG_SPRAY");
-        IMAGE_BUNGEECORD = aMgr.GetImageThrow("IMAGE_BUNGEECORD");
-        IMAGE_BUNGEETARGET = aMgr.GetImageThrow("IMAGE_BUNGEETARGET");
-        IMAGE_BUTTON_DOWN_LEFT = aMgr.GetImageThrow("IMAGE_BUTTON_DOWN_LEFT");
-        IMAGE_BUTTON_DOWN_MIDDLE = aMgr.GetImageThrow("IMAGE_BUTTON_DOWN_MIDDLE");
-        IMAGE_BUTTON_DOWN_RIGHT = aMgr.GetImageThrow("IMAGE_BUTTON_DOWN_RIGHT");
-        IMAGE_BUTTON_LEFT = aMgr.GetImageThrow("IMAGE_BUTTON_LEFT");
-        IMAGE_BUTTON_MIDDLE = aMgr.GetImageThrow("IMAGE_BUTTON_MIDDLE");
-        IMAGE_BUTTON_RIGHT = aMgr.GetImageThrow("IMAGE_BUTTON_RIGHT");
-        IMAGE_CARKEYS = aMgr.GetImageThrow("IMAGE_CARKEYS");
-        IMAGE_CHOCOLATE = aMgr.GetImageThrow("IMAGE_CHOCOLATE");
-        IMAGE_COBCANNON_POPCORN = aMgr.GetImageThrow("IMAGE_COBCANNON_POPCORN");
-        IMAGE_COBCANNON_TARGET = aMgr.GetImageThrow("IMAGE_COBCANNON_TARGET");
-        IMAGE_COINBANK = aMgr.GetImageThrow("IMAGE_COINBANK");
-        IMAGE_CONVEYORBELT = aMgr.GetImageThrow("IMAGE_CONVEYORBELT");
-        IMAGE_CONVEYORBELT_BACKDROP = aMgr.GetImageThrow("IMAGE_CONVEYORBELT_BACKDROP");
-        IMAGE_CRATER = aMgr.GetImageThrow("IMAGE_CRATER");
-        IMAGE_CRATER_FADING = aMgr.GetImageThrow("IMAGE_CRATER_FADING");
-        IMAGE_CRATER_ROOF_CENTER = aMgr.GetImageThrow("IMAGE_CRATER_ROOF_CENTER");
-        IMAGE_CRATER_ROOF_LEFT = aMgr.GetImageThrow("IMAGE_CRATER_ROOF_LEFT");
-        IMAGE_CRATER_WATER_DAY = aMgr.GetImageThrow("IMAGE_CRATER_WATER_DAY");
-        IMAGE_CRATER_WATER_NIGHT = aMgr.GetImageThrow("IMAGE_CRATER_WATER_NIGHT");
-        IMAGE_DIALOG_BIGBOTTOMLEFT = aMgr.GetImageThrow("IMAGE_DIALOG_BIGBOTTOMLEFT");
-        IMAGE_DIALOG_BIGBOTTOMMIDDLE = aMgr.GetImageThrow("IMAGE_DIALOG_BIGBOTTOMMIDDLE");
-        IMAGE_DIALOG_BIGBOTTOMRIGHT = aMgr.GetImageThrow("IMAGE_DIALOG_BIGBOTTOMRIGHT");
-        IMAGE_DIALOG_BOTTOMLEFT = aMgr.GetImageThrow("IMAGE_DIALOG_BOTTOMLEFT");
-        IMAGE_DIALOG_BOTTOMMIDDLE = aMgr.GetImageThrow("IMAGE_DIALOG_BOTTOMMIDDLE");
-        IMAGE_DIALOG_BOTTOMRIGHT = aMgr.GetImageThrow("IMAGE_DIALOG_BOTTOMRIGHT");
-        IMAGE_DIALOG_CENTERLEFT = aMgr.GetImageThrow("IMAGE_DIALOG_CENTERLEFT");
-        IMAGE_DIALOG_CENTERMIDDLE = aMgr.GetImageThrow("IMAGE_DIALOG_CENTERMIDDLE");
-        IMAGE_DIALOG_CENTERRIGHT = aMgr.GetImageThrow("IMAGE_DIALOG_CENTERRIGHT");
-        IMAGE_DIALOG_HEADER = aMgr.GetImageThrow("IMAGE_DIALOG_HEADER");
-        IMAGE_DIALOG_TOPLEFT = aMgr.GetImageThrow("IMAGE_DIALOG_TOPLEFT");
-        IMAGE_DIALOG_TOPMIDDLE = aMgr.GetImageThrow("IMAGE_DIALOG_TOPMIDDLE");
-        IMAGE_DIALOG_TOPRIGHT = aMgr.GetImageThrow("IMAGE_DIALOG_TOPRIGHT");
-        IMAGE_DIRTBIG = aMgr.GetImageThrow("IMAGE_DIRTBIG");
-        IMAGE_DIRTSMALL = aMgr.GetImageThrow("IMAGE_DIRTSMALL");
-        IMAGE_DOOMSHROOM_EXPLOSION_BASE = aMgr.GetImageThrow("IMAGE_DOOMSHROOM_EXPLOSION_BASE");
-        IMAGE_DUST_PUFFS = aMgr.GetImageThrow("IMAGE_DUST_PUFFS");
-        IMAGE_EDITBOX = aMgr.GetImageThrow("IMAGE_EDITBOX");
-        IMAGE_FERTILIZER = aMgr.GetImageThrow("IMAGE_FERTILIZER");
-        IMAGE_FLAGMETER = aMgr.GetImageThrow("IMAGE_FLAGMETER");
-        IMAGE_FLAGMETERLEVELPROGRESS = aMgr.GetImageThrow("IMAGE_FLAGMETERLEVELPROGRESS");
-        IMAGE_FLAGMETERPARTS = aMgr.GetImageThrow("IMAGE_FLAGMETERPARTS");
-        IMAGE_ICE = aMgr.GetImageThrow("IMAGE_ICE");
-        IMAGE_ICETRAP = aMgr.GetImageThrow("IMAGE_ICETRAP");
-        IMAGE_ICETRAP2 = aMgr.GetImageThrow("IMAGE_ICETRAP2");
-        IMAGE_ICETRAP_PARTICLES = aMgr.GetImageThrow("IMAGE_ICETRAP_PARTICLES");
-        IMAGE_ICE_CAP = aMgr.GetImageThrow("IMAGE_ICE_CAP");
-        IMAGE_ICE_SPARKLES = aMgr.GetImageThrow("IMAGE_ICE_SPARKLES");
-        IMAGE_ICON_POOLCLEANER = aMgr.GetImageThrow("IMAGE_ICON_POOLCLEANER");
-        IMAGE_ICON_RAKE = aMgr.GetImageThrow("IMAGE_ICON_RAKE");
-        IMAGE_ICON_ROOFCLEANER = aMgr.GetImageThrow("IMAGE_ICON_ROOFCLEANER");
-        IMAGE_IMITATERCLOUDS = aMgr.GetImageThrow("IMAGE_IMITATERCLOUDS");
-        IMAGE_IMITATERPUFFS = aMgr.GetImageThrow("IMAGE_IMITATERPUFFS");
-        IMAGE_IMITATERSEED = aMgr.GetImageThrow("IMAGE_IMITATERSEED");
-        IMAGE_IMITATERSEEDDISABLED = aMgr.GetImageThrow("IMAGE_IMITATERSEEDDISABLED");
-        IMAGE_MELONPULT_PARTICLES = aMgr.GetImageThrow("IMAGE_MELONPULT_PARTICLES");
-        IMAGE_MINIGAME_TROPHY = aMgr.GetImageThrow("IMAGE_MINIGAME_TROPHY");
-        IMAGE_MONEYBAG = aMgr.GetImageThrow("IMAGE_MONEYBAG");
-        IMAGE_MONEYBAG_HI_RES = aMgr.GetImageThrow("IMAGE_MONEYBAG_HI_RES");
-        IMAGE_NIGHT_GRAVE_GRAPHIC = aMgr.GetImageThrow("IMAGE_NIGHT_GRAVE_GRAPHIC");
-        IMAGE_OPTIONS_BACKTOGAMEBUTTON0 = aMgr.GetImageThrow("IMAGE_OPTIONS_BACKTOGAMEBUTTON0");
-        IMAGE_OPTIONS_BACKTOGAMEBUTTON2 = aMgr.GetImageThrow("IMAGE_OPTIONS_BACKTOGAMEBUTTON2");
-        IMAGE_OPTIONS_CHECKBOX0 = aMgr.GetImageThrow("IMAGE_OPTIONS_CHECKBOX0");
-        IMAGE_OPTIONS_CHECKBOX1 = aMgr.GetImageThrow("IMAGE_OPTIONS_CHECKBOX1");
-        IMAGE_OPTIONS_MENUBACK = aMgr.GetImageThrow("IMAGE_OPTIONS_MENUBACK");
-        IMAGE_OPTIONS_SLIDERKNOB2 = aMgr.GetImageThrow("IMAGE_OPTIONS_SLIDERKNOB2");
-        IMAGE_OPTIONS_SLIDERSLOT = aMgr.GetImageThrow("IMAGE_OPTIONS_SLIDERSLOT");
-        IMAGE_PACKET_PLANTS = aMgr.GetImageThrow("IMAGE_PACKET_PLANTS");
-        IMAGE_PEA_PARTICLES = aMgr.GetImageThrow("IMAGE_PEA_PARTICLES");
-        IMAGE_PEA_SHADOWS = aMgr.GetImageThrow("IMAGE_PEA_SHADOWS");
-        IMAGE_PEA_SPLATS = aMgr.GetImageThrow("IMAGE_PEA_SPLATS");
-        IMAGE_PHONOGRAPH = aMgr.GetImageThrow("IMAGE_PHONOGRAPH");
-        IMAGE_PINATA = aMgr.GetImageThrow("IMAGE_PINATA");
-        IMAGE_PLANTSHADOW = aMgr.GetImageThrow("IMAGE_PLANTSHADOW");
-        IMAGE_PLANTSHADOW2 = aMgr.GetImageThrow("IMAGE_PLANTSHADOW2");
-        IMAGE_PLANTSPEECHBUBBLE = aMgr.GetImageThrow("IMAGE_PLANTSPEECHBUBBLE");
-        IMAGE_POOL = aMgr.GetImageThrow("IMAGE_POOL");
-        IMAGE_POOLSPARKLY = aMgr.GetImageThrow("IMAGE_POOLSPARKLY");
-        IMAGE_POOL_BASE = aMgr.GetImageThrow("IMAGE_POOL_BASE");
-        IMAGE_POOL_BASE_NIGHT = aMgr.GetImageThrow("IMAGE_POOL_BASE_NIGHT");
+        IMAGE_ACHEESEMENTS_BACK_HIGHLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_ACHEESEMENTS_BACK_HIGHLIGHT_ID);
+        IMAGE_ACHEESEMENTS_BEJEWELED = aMgr.GetImageThrow(ResourceId::IMAGE_ACHEESEMENTS_BEJEWELED_ID);
+        IMAGE_ACHEESEMENTS_BOOKWORM = aMgr.GetImageThrow(ResourceId::IMAGE_ACHEESEMENTS_BOOKWORM_ID);
+        IMAGE_ACHEESEMENTS_CHINA = aMgr.GetImageThrow(ResourceId::IMAGE_ACHEESEMENTS_CHINA_ID);
+        IMAGE_ACHEESEMENTS_CHUZZLE = aMgr.GetImageThrow(ResourceId::IMAGE_ACHEESEMENTS_CHUZZLE_ID);
+        IMAGE_ACHEESEMENTS_HOLE_TILE = aMgr.GetImageThrow(ResourceId::IMAGE_ACHEESEMENTS_HOLE_TILE_ID);
+        IMAGE_ACHEESEMENTS_ICONS = aMgr.GetImageThrow(ResourceId::IMAGE_ACHEESEMENTS_ICONS_ID);
+        IMAGE_ACHEESEMENTS_MORE_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ACHEESEMENTS_MORE_BUTTON_ID);
+        IMAGE_ACHEESEMENTS_MORE_BUTTON_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_ACHEESEMENTS_MORE_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ACHEESEMENTS_MORE_ROCK = aMgr.GetImageThrow(ResourceId::IMAGE_ACHEESEMENTS_MORE_ROCK_ID);
+        IMAGE_ACHEESEMENTS_PEGGLE = aMgr.GetImageThrow(ResourceId::IMAGE_ACHEESEMENTS_PEGGLE_ID);
+        IMAGE_ACHEESEMENTS_PIPE = aMgr.GetImageThrow(ResourceId::IMAGE_ACHEESEMENTS_PIPE_ID);
+        IMAGE_ACHEESEMENTS_TOP_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ACHEESEMENTS_TOP_BUTTON_ID);
+        IMAGE_ACHEESEMENTS_TOP_BUTTON_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_ACHEESEMENTS_TOP_BUTTON_HIGHLIGHT_ID);
+        IMAGE_ACHEESEMENTS_ZUMA = aMgr.GetImageThrow(ResourceId::IMAGE_ACHEESEMENTS_ZUMA_ID);
+        IMAGE_ALMANAC = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_ID);
+        IMAGE_ALMANAC_IMITATER = aMgr.GetImageThrow(ResourceId::IMAGE_ALMANAC_IMITATER_ID);
+        IMAGE_AWARDPICKUPGLOW = aMgr.GetImageThrow(ResourceId::IMAGE_AWARDPICKUPGLOW_ID);
+        IMAGE_BEGHOULED_TWIST_OVERLAY = aMgr.GetImageThrow(ResourceId::IMAGE_BEGHOULED_TWIST_OVERLAY_ID);
+        IMAGE_BRAIN = aMgr.GetImageThrow(ResourceId::IMAGE_BRAIN_ID);
+        IMAGE_BUG_SPRAY = aMgr.GetImageThrow(ResourceId::IMAGE_BUG_SPRAY_ID);
+        IMAGE_BUNGEECORD = aMgr.GetImageThrow(ResourceId::IMAGE_BUNGEECORD_ID);
+        IMAGE_BUNGEETARGET = aMgr.GetImageThrow(ResourceId::IMAGE_BUNGEETARGET_ID);
+        IMAGE_BUTTON_DOWN_LEFT = aMgr.GetImageThrow(ResourceId::IMAGE_BUTTON_DOWN_LEFT_ID);
+        IMAGE_BUTTON_DOWN_MIDDLE = aMgr.GetImageThrow(ResourceId::IMAGE_BUTTON_DOWN_MIDDLE_ID);
+        IMAGE_BUTTON_DOWN_RIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_BUTTON_DOWN_RIGHT_ID);
+        IMAGE_BUTTON_LEFT = aMgr.GetImageThrow(ResourceId::IMAGE_BUTTON_LEFT_ID);
+        IMAGE_BUTTON_MIDDLE = aMgr.GetImageThrow(ResourceId::IMAGE_BUTTON_MIDDLE_ID);
+        IMAGE_BUTTON_RIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_BUTTON_RIGHT_ID);
+        IMAGE_CARKEYS = aMgr.GetImageThrow(ResourceId::IMAGE_CARKEYS_ID);
+        IMAGE_CHOCOLATE = aMgr.GetImageThrow(ResourceId::IMAGE_CHOCOLATE_ID);
+        IMAGE_COBCANNON_POPCORN = aMgr.GetImageThrow(ResourceId::IMAGE_COBCANNON_POPCORN_ID);
+        IMAGE_COBCANNON_TARGET = aMgr.GetImageThrow(ResourceId::IMAGE_COBCANNON_TARGET_ID);
+        IMAGE_COINBANK = aMgr.GetImageThrow(ResourceId::IMAGE_COINBANK_ID);
+        IMAGE_CONVEYORBELT = aMgr.GetImageThrow(ResourceId::IMAGE_CONVEYORBELT_ID);
+        IMAGE_CONVEYORBELT_BACKDROP = aMgr.GetImageThrow(ResourceId::IMAGE_CONVEYORBELT_BACKDROP_ID);
+        IMAGE_CRATER = aMgr.GetImageThrow(ResourceId::IMAGE_CRATER_ID);
+        IMAGE_CRATER_FADING = aMgr.GetImageThrow(ResourceId::IMAGE_CRATER_FADING_ID);
+        IMAGE_CRATER_ROOF_CENTER = aMgr.GetImageThrow(ResourceId::IMAGE_CRATER_ROOF_CENTER_ID);
+        IMAGE_CRATER_ROOF_LEFT = aMgr.GetImageThrow(ResourceId::IMAGE_CRATER_ROOF_LEFT_ID);
+        IMAGE_CRATER_WATER_DAY = aMgr.GetImageThrow(ResourceId::IMAGE_CRATER_WATER_DAY_ID);
+        IMAGE_CRATER_WATER_NIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_CRATER_WATER_NIGHT_ID);
+        IMAGE_DIALOG_BIGBOTTOMLEFT = aMgr.GetImageThrow(ResourceId::IMAGE_DIALOG_BIGBOTTOMLEFT_ID);
+        IMAGE_DIALOG_BIGBOTTOMMIDDLE = aMgr.GetImageThrow(ResourceId::IMAGE_DIALOG_BIGBOTTOMMIDDLE_ID);
+        IMAGE_DIALOG_BIGBOTTOMRIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_DIALOG_BIGBOTTOMRIGHT_ID);
+        IMAGE_DIALOG_BOTTOMLEFT = aMgr.GetImageThrow(ResourceId::IMAGE_DIALOG_BOTTOMLEFT_ID);
+        IMAGE_DIALOG_BOTTOMMIDDLE = aMgr.GetImageThrow(ResourceId::IMAGE_DIALOG_BOTTOMMIDDLE_ID);
+        IMAGE_DIALOG_BOTTOMRIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_DIALOG_BOTTOMRIGHT_ID);
+        IMAGE_DIALOG_CENTERLEFT = aMgr.GetImageThrow(ResourceId::IMAGE_DIALOG_CENTERLEFT_ID);
+        IMAGE_DIALOG_CENTERMIDDLE = aMgr.GetImageThrow(ResourceId::IMAGE_DIALOG_CENTERMIDDLE_ID);
+        IMAGE_DIALOG_CENTERRIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_DIALOG_CENTERRIGHT_ID);
+        IMAGE_DIALOG_HEADER = aMgr.GetImageThrow(ResourceId::IMAGE_DIALOG_HEADER_ID);
+        IMAGE_DIALOG_TOPLEFT = aMgr.GetImageThrow(ResourceId::IMAGE_DIALOG_TOPLEFT_ID);
+        IMAGE_DIALOG_TOPMIDDLE = aMgr.GetImageThrow(ResourceId::IMAGE_DIALOG_TOPMIDDLE_ID);
+        IMAGE_DIALOG_TOPRIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_DIALOG_TOPRIGHT_ID);
+        IMAGE_DIRTBIG = aMgr.GetImageThrow(ResourceId::IMAGE_DIRTBIG_ID);
+        IMAGE_DIRTSMALL = aMgr.GetImageThrow(ResourceId::IMAGE_DIRTSMALL_ID);
+        IMAGE_DOOMSHROOM_EXPLOSION_BASE = aMgr.GetImageThrow(ResourceId::IMAGE_DOOMSHROOM_EXPLOSION_BASE_ID);
+        IMAGE_DUST_PUFFS = aMgr.GetImageThrow(ResourceId::IMAGE_DUST_PUFFS_ID);
+        IMAGE_EDITBOX = aMgr.GetImageThrow(ResourceId::IMAGE_EDITBOX_ID);
+        IMAGE_FERTILIZER = aMgr.GetImageThrow(ResourceId::IMAGE_FERTILIZER_ID);
+        IMAGE_FLAGMETER = aMgr.GetImageThrow(ResourceId::IMAGE_FLAGMETER_ID);
+        IMAGE_FLAGMETERLEVELPROGRESS = aMgr.GetImageThrow(ResourceId::IMAGE_FLAGMETERLEVELPROGRESS_ID);
+        IMAGE_FLAGMETERPARTS = aMgr.GetImageThrow(ResourceId::IMAGE_FLAGMETERPARTS_ID);
+        IMAGE_ICE = aMgr.GetImageThrow(ResourceId::IMAGE_ICE_ID);
+        IMAGE_ICETRAP = aMgr.GetImageThrow(ResourceId::IMAGE_ICETRAP_ID);
+        IMAGE_ICETRAP2 = aMgr.GetImageThrow(ResourceId::IMAGE_ICETRAP2_ID);
+        IMAGE_ICETRAP_PARTICLES = aMgr.GetImageThrow(ResourceId::IMAGE_ICETRAP_PARTICLES_ID);
+        IMAGE_ICE_CAP = aMgr.GetImageThrow(ResourceId::IMAGE_ICE_CAP_ID);
+        IMAGE_ICE_SPARKLES = aMgr.GetImageThrow(ResourceId::IMAGE_ICE_SPARKLES_ID);
+        IMAGE_ICON_POOLCLEANER = aMgr.GetImageThrow(ResourceId::IMAGE_ICON_POOLCLEANER_ID);
+        IMAGE_ICON_RAKE = aMgr.GetImageThrow(ResourceId::IMAGE_ICON_RAKE_ID);
+        IMAGE_ICON_ROOFCLEANER = aMgr.GetImageThrow(ResourceId::IMAGE_ICON_ROOFCLEANER_ID);
+        IMAGE_IMITATERCLOUDS = aMgr.GetImageThrow(ResourceId::IMAGE_IMITATERCLOUDS_ID);
+        IMAGE_IMITATERPUFFS = aMgr.GetImageThrow(ResourceId::IMAGE_IMITATERPUFFS_ID);
+        IMAGE_IMITATERSEED = aMgr.GetImageThrow(ResourceId::IMAGE_IMITATERSEED_ID);
+        IMAGE_IMITATERSEEDDISABLED = aMgr.GetImageThrow(ResourceId::IMAGE_IMITATERSEEDDISABLED_ID);
+        IMAGE_MELONPULT_PARTICLES = aMgr.GetImageThrow(ResourceId::IMAGE_MELONPULT_PARTICLES_ID);
+        IMAGE_MINIGAME_TROPHY = aMgr.GetImageThrow(ResourceId::IMAGE_MINIGAME_TROPHY_ID);
+        IMAGE_MONEYBAG = aMgr.GetImageThrow(ResourceId::IMAGE_MONEYBAG_ID);
+        IMAGE_MONEYBAG_HI_RES = aMgr.GetImageThrow(ResourceId::IMAGE_MONEYBAG_HI_RES_ID);
+        IMAGE_NIGHT_GRAVE_GRAPHIC = aMgr.GetImageThrow(ResourceId::IMAGE_NIGHT_GRAVE_GRAPHIC_ID);
+        IMAGE_OPTIONS_BACKTOGAMEBUTTON0 = aMgr.GetImageThrow(ResourceId::IMAGE_OPTIONS_BACKTOGAMEBUTTON0_ID);
+        IMAGE_OPTIONS_BACKTOGAMEBUTTON2 = aMgr.GetImageThrow(ResourceId::IMAGE_OPTIONS_BACKTOGAMEBUTTON2_ID);
+        IMAGE_OPTIONS_CHECKBOX0 = aMgr.GetImageThrow(ResourceId::IMAGE_OPTIONS_CHECKBOX0_ID);
+        IMAGE_OPTIONS_CHECKBOX1 = aMgr.GetImageThrow(ResourceId::IMAGE_OPTIONS_CHECKBOX1_ID);
+        IMAGE_OPTIONS_MENUBACK = aMgr.GetImageThrow(ResourceId::IMAGE_OPTIONS_MENUBACK_ID);
+        IMAGE_OPTIONS_SLIDERKNOB2 = aMgr.GetImageThrow(ResourceId::IMAGE_OPTIONS_SLIDERKNOB2_ID);
+        IMAGE_OPTIONS_SLIDERSLOT = aMgr.GetImageThrow(ResourceId::IMAGE_OPTIONS_SLIDERSLOT_ID);
+        IMAGE_PACKET_PLANTS = aMgr.GetImageThrow(ResourceId::IMAGE_PACKET_PLANTS_ID);
+        IMAGE_PEA_PARTICLES = aMgr.GetImageThrow(ResourceId::IMAGE_PEA_PARTICLES_ID);
+        IMAGE_PEA_SHADOWS = aMgr.GetImageThrow(ResourceId::IMAGE_PEA_SHADOWS_ID);
+        IMAGE_PEA_SPLATS = aMgr.GetImageThrow(ResourceId::IMAGE_PEA_SPLATS_ID);
+        IMAGE_PHONOGRAPH = aMgr.GetImageThrow(ResourceId::IMAGE_PHONOGRAPH_ID);
+        IMAGE_PINATA = aMgr.GetImageThrow(ResourceId::IMAGE_PINATA_ID);
+        IMAGE_PLANTSHADOW = aMgr.GetImageThrow(ResourceId::IMAGE_PLANTSHADOW_ID);
+        IMAGE_PLANTSHADOW2 = aMgr.GetImageThrow(ResourceId::IMAGE_PLANTSHADOW2_ID);
+        IMAGE_PLANTSPEECHBUBBLE = aMgr.GetImageThrow(ResourceId::IMAGE_PLANTSPEECHBUBBLE_ID);
+        IMAGE_POOL = aMgr.GetImageThrow(ResourceId::IMAGE_POOL_ID);
+        IMAGE_POOLSPARKLY = aMgr.GetImageThrow(ResourceId::IMAGE_POOLSPARKLY_ID);
+        IMAGE_POOL_BASE = aMgr.GetImageThrow(ResourceId::IMAGE_POOL_BASE_ID);
+        IMAGE_POOL_BASE_NIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_POOL_BASE_NIGHT_ID);
         //		IMAGE_POOL_CAUSTIC_EFFECT = aMgr.GetImageThrow("IMAGE_POOL_CAUSTIC_EFFECT");
-        IMAGE_POOL_NIGHT = aMgr.GetImageThrow("IMAGE_POOL_NIGHT");
-        IMAGE_POOL_SHADING = aMgr.GetImageThrow("IMAGE_POOL_SHADING");
-        IMAGE_POOL_SHADING_NIGHT = aMgr.GetImageThrow("IMAGE_POOL_SHADING_NIGHT");
-        IMAGE_POTATOMINE_PARTICLES = aMgr.GetImageThrow("IMAGE_POTATOMINE_PARTICLES");
-        IMAGE_PRESENT = aMgr.GetImageThrow("IMAGE_PRESENT");
-        IMAGE_PRESENTOPEN = aMgr.GetImageThrow("IMAGE_PRESENTOPEN");
-        IMAGE_PROJECTILECACTUS = aMgr.GetImageThrow("IMAGE_PROJECTILECACTUS");
-        IMAGE_PROJECTILEPEA = aMgr.GetImageThrow("IMAGE_PROJECTILEPEA");
-        IMAGE_PROJECTILESNOWPEA = aMgr.GetImageThrow("IMAGE_PROJECTILESNOWPEA");
-        IMAGE_PROJECTILE_STAR = aMgr.GetImageThrow("IMAGE_PROJECTILE_STAR");
-        IMAGE_PUFFSHROOM_PUFF1 = aMgr.GetImageThrow("IMAGE_PUFFSHROOM_PUFF1");
-        IMAGE_QUICKPLAY_BACK_BUTTON = aMgr.GetImageThrow("IMAGE_QUICKPLAY_BACK_BUTTON");
-        IMAGE_QUICKPLAY_BACK_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_QUICKPLAY_BACK_BUTTON_HIGHLIGHT");
-        IMAGE_QUICKPLAY_MINIGAMES_BUTTON = aMgr.GetImageThrow("IMAGE_QUICKPLAY_MINIGAMES_BUTTON");
-        IMAGE_QUICKPLAY_MINIGAMES_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_QUICKPLAY_MINIGAMES_BUTTON_HIGHLIGHT");
-        IMAGE_QUICKPLAY_MINIGAMES_CLOUD = aMgr.GetImageThrow("IMAGE_QUICKPLAY_MINIGAMES_CLOUD");
-        IMAGE_QUICKPLAY_PUZZLES_BUTTON = aMgr.GetImageThrow("IMAGE_QUICKPLAY_PUZZLES_BUTTON");
-        IMAGE_QUICKPLAY_PUZZLES_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_QUICKPLAY_PUZZLES_BUTTON_HIGHLIGHT");
-        IMAGE_QUICKPLAY_PUZZLES_CLOUD = aMgr.GetImageThrow("IMAGE_QUICKPLAY_PUZZLES_CLOUD");
-        IMAGE_QUICKPLAY_SURVIVAL_BUTTON = aMgr.GetImageThrow("IMAGE_QUICKPLAY_SURVIVAL_BUTTON");
-        IMAGE_QUICKPLAY_SURVIVAL_BUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_QUICKPLAY_SURVIVAL_BUTTON_HIGHLIGHT");
-        IMAGE_QUICKPLAY_SURVIVAL_CLOUD = aMgr.GetImageThrow("IMAGE_QUICKPLAY_SURVIVAL_CLOUD");
-        IMAGE_RAIN = aMgr.GetImageThrow("IMAGE_RAIN");
-        IMAGE_REANIM_CABBAGEPULT_CABBAGE = aMgr.GetImageThrow("IMAGE_REANIM_CABBAGEPULT_CABBAGE");
-        IMAGE_REANIM_COBCANNON_COB = aMgr.GetImageThrow("IMAGE_REANIM_COBCANNON_COB");
-        IMAGE_REANIM_COINGLOW = aMgr.GetImageThrow("IMAGE_REANIM_COINGLOW");
-        IMAGE_REANIM_COIN_GOLD_DOLLAR = aMgr.GetImageThrow("IMAGE_REANIM_COIN_GOLD_DOLLAR");
-        IMAGE_REANIM_COIN_SILVER_DOLLAR = aMgr.GetImageThrow("IMAGE_REANIM_COIN_SILVER_DOLLAR");
-        IMAGE_REANIM_CORNPULT_BUTTER = aMgr.GetImageThrow("IMAGE_REANIM_CORNPULT_BUTTER");
-        IMAGE_REANIM_CORNPULT_BUTTER_SPLAT = aMgr.GetImageThrow("IMAGE_REANIM_CORNPULT_BUTTER_SPLAT");
-        IMAGE_REANIM_CORNPULT_KERNAL = aMgr.GetImageThrow("IMAGE_REANIM_CORNPULT_KERNAL");
-        IMAGE_REANIM_CRAZYDAVE_MOUTH1 = aMgr.GetImageThrow("IMAGE_REANIM_CRAZYDAVE_MOUTH1");
-        IMAGE_REANIM_CRAZYDAVE_MOUTH4 = aMgr.GetImageThrow("IMAGE_REANIM_CRAZYDAVE_MOUTH4");
-        IMAGE_REANIM_CRAZYDAVE_MOUTH5 = aMgr.GetImageThrow("IMAGE_REANIM_CRAZYDAVE_MOUTH5");
-        IMAGE_REANIM_CRAZYDAVE_MOUTH6 = aMgr.GetImageThrow("IMAGE_REANIM_CRAZYDAVE_MOUTH6");
-        IMAGE_REANIM_DIAMOND = aMgr.GetImageThrow("IMAGE_REANIM_DIAMOND");
-        IMAGE_REANIM_GARLIC_BODY2 = aMgr.GetImageThrow("IMAGE_REANIM_GARLIC_BODY2");
-        IMAGE_REANIM_GARLIC_BODY3 = aMgr.GetImageThrow("IMAGE_REANIM_GARLIC_BODY3");
-        IMAGE_REANIM_MELONPULT_MELON = aMgr.GetImageThrow("IMAGE_REANIM_MELONPULT_MELON");
-        IMAGE_REANIM_POT_TOP_DARK = aMgr.GetImageThrow("IMAGE_REANIM_POT_TOP_DARK");
-        IMAGE_REANIM_PUMPKIN_DAMAGE1 = aMgr.GetImageThrow("IMAGE_REANIM_PUMPKIN_DAMAGE1");
-        IMAGE_REANIM_PUMPKIN_DAMAGE3 = aMgr.GetImageThrow("IMAGE_REANIM_PUMPKIN_DAMAGE3");
+        IMAGE_POOL_NIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_POOL_NIGHT_ID);
+        IMAGE_POOL_SHADING = aMgr.GetImageThrow(ResourceId::IMAGE_POOL_SHADING_ID);
+        IMAGE_POOL_SHADING_NIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_POOL_SHADING_NIGHT_ID);
+        IMAGE_POTATOMINE_PARTICLES = aMgr.GetImageThrow(ResourceId::IMAGE_POTATOMINE_PARTICLES_ID);
+        IMAGE_PRESENT = aMgr.GetImageThrow(ResourceId::IMAGE_PRESENT_ID);
+        IMAGE_PRESENTOPEN = aMgr.GetImageThrow(ResourceId::IMAGE_PRESENTOPEN_ID);
+        IMAGE_PROJECTILECACTUS = aMgr.GetImageThrow(ResourceId::IMAGE_PROJECTILECACTUS_ID);
+        IMAGE_PROJECTILEPEA = aMgr.GetImageThrow(ResourceId::IMAGE_PROJECTILEPEA_ID);
+        IMAGE_PROJECTILESNOWPEA = aMgr.GetImageThrow(ResourceId::IMAGE_PROJECTILESNOWPEA_ID);
+        IMAGE_PROJECTILE_STAR = aMgr.GetImageThrow(ResourceId::IMAGE_PROJECTILE_STAR_ID);
+        IMAGE_PUFFSHROOM_PUFF1 = aMgr.GetImageThrow(ResourceId::IMAGE_PUFFSHROOM_PUFF1_ID);
+        IMAGE_QUICKPLAY_BACK_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_QUICKPLAY_BACK_BUTTON_ID);
+        IMAGE_QUICKPLAY_BACK_BUTTON_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_QUICKPLAY_BACK_BUTTON_HIGHLIGHT_ID);
+        IMAGE_QUICKPLAY_MINIGAMES_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_QUICKPLAY_MINIGAMES_BUTTON_ID);
+        IMAGE_QUICKPLAY_MINIGAMES_BUTTON_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_QUICKPLAY_MINIGAMES_BUTTON_HIGHLIGHT_ID);
+        IMAGE_QUICKPLAY_MINIGAMES_CLOUD = aMgr.GetImageThrow(ResourceId::IMAGE_QUICKPLAY_MINIGAMES_CLOUD_ID);
+        IMAGE_QUICKPLAY_PUZZLES_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_QUICKPLAY_PUZZLES_BUTTON_ID);
+        IMAGE_QUICKPLAY_PUZZLES_BUTTON_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_QUICKPLAY_PUZZLES_BUTTON_HIGHLIGHT_ID);
+        IMAGE_QUICKPLAY_PUZZLES_CLOUD = aMgr.GetImageThrow(ResourceId::IMAGE_QUICKPLAY_PUZZLES_CLOUD_ID);
+        IMAGE_QUICKPLAY_SURVIVAL_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_QUICKPLAY_SURVIVAL_BUTTON_ID);
+        IMAGE_QUICKPLAY_SURVIVAL_BUTTON_HIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_QUICKPLAY_SURVIVAL_BUTTON_HIGHLIGHT_ID);
+        IMAGE_QUICKPLAY_SURVIVAL_CLOUD = aMgr.GetImageThrow(ResourceId::IMAGE_QUICKPLAY_SURVIVAL_CLOUD_ID);
+        IMAGE_RAIN = aMgr.GetImageThrow(ResourceId::IMAGE_RAIN_ID);
+        IMAGE_REANIM_CABBAGEPULT_CABBAGE = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_CABBAGEPULT_CABBAGE_ID);
+        IMAGE_REANIM_COBCANNON_COB = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_COBCANNON_COB_ID);
+        IMAGE_REANIM_COINGLOW = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_COINGLOW_ID);
+        IMAGE_REANIM_COIN_GOLD_DOLLAR = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_COIN_GOLD_DOLLAR_ID);
+        IMAGE_REANIM_COIN_SILVER_DOLLAR = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_COIN_SILVER_DOLLAR_ID);
+        IMAGE_REANIM_CORNPULT_BUTTER = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_CORNPULT_BUTTER_ID);
+        IMAGE_REANIM_CORNPULT_BUTTER_SPLAT = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_CORNPULT_BUTTER_SPLAT_ID);
+        IMAGE_REANIM_CORNPULT_KERNAL = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_CORNPULT_KERNAL_ID);
+        IMAGE_REANIM_CRAZYDAVE_MOUTH1 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_CRAZYDAVE_MOUTH1_ID);
+        IMAGE_REANIM_CRAZYDAVE_MOUTH4 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_CRAZYDAVE_MOUTH4_ID);
+        IMAGE_REANIM_CRAZYDAVE_MOUTH5 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_CRAZYDAVE_MOUTH5_ID);
+        IMAGE_REANIM_CRAZYDAVE_MOUTH6 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_CRAZYDAVE_MOUTH6_ID);
+        IMAGE_REANIM_DIAMOND = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_DIAMOND_ID);
+        IMAGE_REANIM_GARLIC_BODY2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_GARLIC_BODY2_ID);
+        IMAGE_REANIM_GARLIC_BODY3 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_GARLIC_BODY3_ID);
+        IMAGE_REANIM_MELONPULT_MELON = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_MELONPULT_MELON_ID);
+        IMAGE_REANIM_POT_TOP_DARK = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_POT_TOP_DARK_ID);
+        IMAGE_REANIM_PUMPKIN_DAMAGE1 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_PUMPKIN_DAMAGE1_ID);
+        IMAGE_REANIM_PUMPKIN_DAMAGE3 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_PUMPKIN_DAMAGE3_ID);
         IMAGE_REANIM_SELECTORSCREEN_ADVENTURE_BUTTON =
-            aMgr.GetImageThrow("IMAGE_REANIM_SELECTORSCREEN_ADVENTURE_BUTTON");
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SELECTORSCREEN_ADVENTURE_BUTTON_ID);
         IMAGE_REANIM_SELECTORSCREEN_ADVENTURE_HIGHLIGHT =
-            aMgr.GetImageThrow("IMAGE_REANIM_SELECTORSCREEN_ADVENTURE_HIGHLIGHT");
-        IMAGE_REANIM_SELECTORSCREEN_ALMANAC_SHADOW = aMgr.GetImageThrow("IMAGE_REANIM_SELECTORSCREEN_ALMANAC_SHADOW");
-        IMAGE_REANIM_SELECTORSCREEN_BG = aMgr.GetImageThrow("IMAGE_REANIM_SELECTORSCREEN_BG");
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SELECTORSCREEN_ADVENTURE_HIGHLIGHT_ID);
+        IMAGE_REANIM_SELECTORSCREEN_ALMANAC_SHADOW =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SELECTORSCREEN_ALMANAC_SHADOW_ID);
+        IMAGE_REANIM_SELECTORSCREEN_BG = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SELECTORSCREEN_BG_ID);
         IMAGE_REANIM_SELECTORSCREEN_CHALLENGES_BUTTON =
-            aMgr.GetImageThrow("IMAGE_REANIM_SELECTORSCREEN_CHALLENGES_BUTTON");
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SELECTORSCREEN_CHALLENGES_BUTTON_ID);
         IMAGE_REANIM_SELECTORSCREEN_CHALLENGES_HIGHLIGHT =
-            aMgr.GetImageThrow("IMAGE_REANIM_SELECTORSCREEN_CHALLENGES_HIGHLIGHT");
-        IMAGE_REANIM_SELECTORSCREEN_KEY_SHADOW = aMgr.GetImageThrow("IMAGE_REANIM_SELECTORSCREEN_KEY_SHADOW");
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SELECTORSCREEN_CHALLENGES_HIGHLIGHT_ID);
+        IMAGE_REANIM_SELECTORSCREEN_KEY_SHADOW =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SELECTORSCREEN_KEY_SHADOW_ID);
         IMAGE_REANIM_SELECTORSCREEN_STARTADVENTURE_BUTTON =
-            aMgr.GetImageThrow("IMAGE_REANIM_SELECTORSCREEN_STARTADVENTURE_BUTTON");
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SELECTORSCREEN_STARTADVENTURE_BUTTON_ID);
         IMAGE_REANIM_SELECTORSCREEN_STARTADVENTURE_HIGHLIGHT =
-            aMgr.GetImageThrow("IMAGE_REANIM_SELECTORSCREEN_STARTADVENTURE_HIGHLIGHT");
-        IMAGE_REANIM_SELECTORSCREEN_SURVIVAL_BUTTON = aMgr.GetImageThrow("IMAGE_REANIM_SELECTORSCREEN_SURVIVAL_BUTTON");
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SELECTORSCREEN_STARTADVENTURE_HIGHLIGHT_ID);
+        IMAGE_REANIM_SELECTORSCREEN_SURVIVAL_BUTTON =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SELECTORSCREEN_SURVIVAL_BUTTON_ID);
         IMAGE_REANIM_SELECTORSCREEN_SURVIVAL_HIGHLIGHT =
-            aMgr.GetImageThrow("IMAGE_REANIM_SELECTORSCREEN_SURVIVAL_HIGHLIGHT");
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SELECTORSCREEN_SURVIVAL_HIGHLIGHT_ID);
         IMAGE_REANIM_SELECTORSCREEN_VASEBREAKER_BUTTON =
-            aMgr.GetImageThrow("IMAGE_REANIM_SELECTORSCREEN_VASEBREAKER_BUTTON");
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SELECTORSCREEN_VASEBREAKER_BUTTON_ID);
         IMAGE_REANIM_SELECTORSCREEN_VASEBREAKER_HIGHLIGHT =
-            aMgr.GetImageThrow("IMAGE_REANIM_SELECTORSCREEN_VASEBREAKER_HIGHLIGHT");
-        IMAGE_REANIM_SELECTORSCREEN_WOODSIGN2_PRESS = aMgr.GetImageThrow("IMAGE_REANIM_SELECTORSCREEN_WOODSIGN2_PRESS");
-        IMAGE_REANIM_SELECTORSCREEN_WOODSIGN3_PRESS = aMgr.GetImageThrow("IMAGE_REANIM_SELECTORSCREEN_WOODSIGN3_PRESS");
-        IMAGE_REANIM_STINKY_TURN3 = aMgr.GetImageThrow("IMAGE_REANIM_STINKY_TURN3");
-        IMAGE_REANIM_TALLNUT_CRACKED1 = aMgr.GetImageThrow("IMAGE_REANIM_TALLNUT_CRACKED1");
-        IMAGE_REANIM_TALLNUT_CRACKED2 = aMgr.GetImageThrow("IMAGE_REANIM_TALLNUT_CRACKED2");
-        IMAGE_REANIM_TREE_BG = aMgr.GetImageThrow("IMAGE_REANIM_TREE_BG");
-        IMAGE_REANIM_WALLNUT_BODY = aMgr.GetImageThrow("IMAGE_REANIM_WALLNUT_BODY");
-        IMAGE_REANIM_WALLNUT_CRACKED1 = aMgr.GetImageThrow("IMAGE_REANIM_WALLNUT_CRACKED1");
-        IMAGE_REANIM_WALLNUT_CRACKED2 = aMgr.GetImageThrow("IMAGE_REANIM_WALLNUT_CRACKED2");
-        IMAGE_REANIM_WINTERMELON_PROJECTILE = aMgr.GetImageThrow("IMAGE_REANIM_WINTERMELON_PROJECTILE");
-        IMAGE_REANIM_ZENGARDEN_BUGSPRAY_BOTTLE = aMgr.GetImageThrow("IMAGE_REANIM_ZENGARDEN_BUGSPRAY_BOTTLE");
-        IMAGE_REANIM_ZOMBIE_BACKUP_INNERARM_HAND = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BACKUP_INNERARM_HAND");
-        IMAGE_REANIM_ZOMBIE_BACKUP_OUTERARM_UPPER2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BACKUP_OUTERARM_UPPER2");
-        IMAGE_REANIM_ZOMBIE_BALLOON_OUTERARM_UPPER2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BALLOON_OUTERARM_UPPER2");
-        IMAGE_REANIM_ZOMBIE_BOBSLED_OUTERARM_HAND = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BOBSLED_OUTERARM_HAND");
-        IMAGE_REANIM_ZOMBIE_BOBSLED_OUTERARM_UPPER2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BOBSLED_OUTERARM_UPPER2");
-        IMAGE_REANIM_ZOMBIE_BOSS_EYEGLOW_BLUE = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BOSS_EYEGLOW_BLUE");
-        IMAGE_REANIM_ZOMBIE_BOSS_FOOT_DAMAGE1 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BOSS_FOOT_DAMAGE1");
-        IMAGE_REANIM_ZOMBIE_BOSS_FOOT_DAMAGE2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BOSS_FOOT_DAMAGE2");
-        IMAGE_REANIM_ZOMBIE_BOSS_HEAD_DAMAGE1 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BOSS_HEAD_DAMAGE1");
-        IMAGE_REANIM_ZOMBIE_BOSS_HEAD_DAMAGE2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BOSS_HEAD_DAMAGE2");
-        IMAGE_REANIM_ZOMBIE_BOSS_ICEBALL = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BOSS_ICEBALL");
-        IMAGE_REANIM_ZOMBIE_BOSS_JAW_DAMAGE1 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BOSS_JAW_DAMAGE1");
-        IMAGE_REANIM_ZOMBIE_BOSS_JAW_DAMAGE2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BOSS_JAW_DAMAGE2");
-        IMAGE_REANIM_ZOMBIE_BOSS_MOUTHGLOW_BLUE = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BOSS_MOUTHGLOW_BLUE");
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SELECTORSCREEN_VASEBREAKER_HIGHLIGHT_ID);
+        IMAGE_REANIM_SELECTORSCREEN_WOODSIGN2_PRESS =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SELECTORSCREEN_WOODSIGN2_PRESS_ID);
+        IMAGE_REANIM_SELECTORSCREEN_WOODSIGN3_PRESS =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_SELECTORSCREEN_WOODSIGN3_PRESS_ID);
+        IMAGE_REANIM_STINKY_TURN3 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_STINKY_TURN3_ID);
+        IMAGE_REANIM_TALLNUT_CRACKED1 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_TALLNUT_CRACKED1_ID);
+        IMAGE_REANIM_TALLNUT_CRACKED2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_TALLNUT_CRACKED2_ID);
+        IMAGE_REANIM_TREE_BG = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_TREE_BG_ID);
+        IMAGE_REANIM_WALLNUT_BODY = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_WALLNUT_BODY_ID);
+        IMAGE_REANIM_WALLNUT_CRACKED1 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_WALLNUT_CRACKED1_ID);
+        IMAGE_REANIM_WALLNUT_CRACKED2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_WALLNUT_CRACKED2_ID);
+        IMAGE_REANIM_WINTERMELON_PROJECTILE = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_WINTERMELON_PROJECTILE_ID);
+        IMAGE_REANIM_ZENGARDEN_BUGSPRAY_BOTTLE =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZENGARDEN_BUGSPRAY_BOTTLE_ID);
+        IMAGE_REANIM_ZOMBIE_BACKUP_INNERARM_HAND =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BACKUP_INNERARM_HAND_ID);
+        IMAGE_REANIM_ZOMBIE_BACKUP_OUTERARM_UPPER2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BACKUP_OUTERARM_UPPER2_ID);
+        IMAGE_REANIM_ZOMBIE_BALLOON_OUTERARM_UPPER2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BALLOON_OUTERARM_UPPER2_ID);
+        IMAGE_REANIM_ZOMBIE_BOBSLED_OUTERARM_HAND =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BOBSLED_OUTERARM_HAND_ID);
+        IMAGE_REANIM_ZOMBIE_BOBSLED_OUTERARM_UPPER2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BOBSLED_OUTERARM_UPPER2_ID);
+        IMAGE_REANIM_ZOMBIE_BOSS_EYEGLOW_BLUE =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BOSS_EYEGLOW_BLUE_ID);
+        IMAGE_REANIM_ZOMBIE_BOSS_FOOT_DAMAGE1 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BOSS_FOOT_DAMAGE1_ID);
+        IMAGE_REANIM_ZOMBIE_BOSS_FOOT_DAMAGE2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BOSS_FOOT_DAMAGE2_ID);
+        IMAGE_REANIM_ZOMBIE_BOSS_HEAD_DAMAGE1 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BOSS_HEAD_DAMAGE1_ID);
+        IMAGE_REANIM_ZOMBIE_BOSS_HEAD_DAMAGE2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BOSS_HEAD_DAMAGE2_ID);
+        IMAGE_REANIM_ZOMBIE_BOSS_ICEBALL = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BOSS_ICEBALL_ID);
+        IMAGE_REANIM_ZOMBIE_BOSS_JAW_DAMAGE1 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BOSS_JAW_DAMAGE1_ID);
+        IMAGE_REANIM_ZOMBIE_BOSS_JAW_DAMAGE2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BOSS_JAW_DAMAGE2_ID);
+        IMAGE_REANIM_ZOMBIE_BOSS_MOUTHGLOW_BLUE =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BOSS_MOUTHGLOW_BLUE_ID);
         IMAGE_REANIM_ZOMBIE_BOSS_OUTERARM_HAND_DAMAGE1 =
-            aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BOSS_OUTERARM_HAND_DAMAGE1");
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BOSS_OUTERARM_HAND_DAMAGE1_ID);
         IMAGE_REANIM_ZOMBIE_BOSS_OUTERARM_HAND_DAMAGE2 =
-            aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BOSS_OUTERARM_HAND_DAMAGE2");
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BOSS_OUTERARM_HAND_DAMAGE2_ID);
         IMAGE_REANIM_ZOMBIE_BOSS_OUTERARM_THUMB_DAMAGE1 =
-            aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BOSS_OUTERARM_THUMB_DAMAGE1");
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BOSS_OUTERARM_THUMB_DAMAGE1_ID);
         IMAGE_REANIM_ZOMBIE_BOSS_OUTERARM_THUMB_DAMAGE2 =
-            aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BOSS_OUTERARM_THUMB_DAMAGE2");
-        IMAGE_REANIM_ZOMBIE_BUCKET1 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BUCKET1");
-        IMAGE_REANIM_ZOMBIE_BUCKET2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BUCKET2");
-        IMAGE_REANIM_ZOMBIE_BUCKET3 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BUCKET3");
-        IMAGE_REANIM_ZOMBIE_BUNGI_HEAD_SCARED = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_BUNGI_HEAD_SCARED");
-        IMAGE_REANIM_ZOMBIE_CATAPULT_BASKETBALL = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_CATAPULT_BASKETBALL");
-        IMAGE_REANIM_ZOMBIE_CATAPULT_POLE = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_CATAPULT_POLE");
-        IMAGE_REANIM_ZOMBIE_CATAPULT_POLE_DAMAGE = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_CATAPULT_POLE_DAMAGE");
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BOSS_OUTERARM_THUMB_DAMAGE2_ID);
+        IMAGE_REANIM_ZOMBIE_BUCKET1 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BUCKET1_ID);
+        IMAGE_REANIM_ZOMBIE_BUCKET2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BUCKET2_ID);
+        IMAGE_REANIM_ZOMBIE_BUCKET3 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BUCKET3_ID);
+        IMAGE_REANIM_ZOMBIE_BUNGI_HEAD_SCARED =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_BUNGI_HEAD_SCARED_ID);
+        IMAGE_REANIM_ZOMBIE_CATAPULT_BASKETBALL =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_CATAPULT_BASKETBALL_ID);
+        IMAGE_REANIM_ZOMBIE_CATAPULT_POLE = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_CATAPULT_POLE_ID);
+        IMAGE_REANIM_ZOMBIE_CATAPULT_POLE_DAMAGE =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_CATAPULT_POLE_DAMAGE_ID);
         IMAGE_REANIM_ZOMBIE_CATAPULT_POLE_DAMAGE_WITHBALL =
-            aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_CATAPULT_POLE_DAMAGE_WITHBALL");
-        IMAGE_REANIM_ZOMBIE_CATAPULT_POLE_WITHBALL = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_CATAPULT_POLE_WITHBALL");
-        IMAGE_REANIM_ZOMBIE_CATAPULT_SIDING_DAMAGE = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_CATAPULT_SIDING_DAMAGE");
-        IMAGE_REANIM_ZOMBIE_CONE1 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_CONE1");
-        IMAGE_REANIM_ZOMBIE_CONE2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_CONE2");
-        IMAGE_REANIM_ZOMBIE_CONE3 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_CONE3");
-        IMAGE_REANIM_ZOMBIE_DIGGER_HARDHAT = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_DIGGER_HARDHAT");
-        IMAGE_REANIM_ZOMBIE_DIGGER_HARDHAT2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_DIGGER_HARDHAT2");
-        IMAGE_REANIM_ZOMBIE_DIGGER_HARDHAT3 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_DIGGER_HARDHAT3");
-        IMAGE_REANIM_ZOMBIE_DIGGER_OUTERARM_UPPER2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_DIGGER_OUTERARM_UPPER2");
-        IMAGE_REANIM_ZOMBIE_DIGGER_PICKAXE = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_DIGGER_PICKAXE");
-        IMAGE_REANIM_ZOMBIE_DISCO_OUTERARM_HAND = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_DISCO_OUTERARM_HAND");
-        IMAGE_REANIM_ZOMBIE_DISCO_OUTERARM_UPPER2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_DISCO_OUTERARM_UPPER2");
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_CATAPULT_POLE_DAMAGE_WITHBALL_ID);
+        IMAGE_REANIM_ZOMBIE_CATAPULT_POLE_WITHBALL =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_CATAPULT_POLE_WITHBALL_ID);
+        IMAGE_REANIM_ZOMBIE_CATAPULT_SIDING_DAMAGE =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_CATAPULT_SIDING_DAMAGE_ID);
+        IMAGE_REANIM_ZOMBIE_CONE1 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_CONE1_ID);
+        IMAGE_REANIM_ZOMBIE_CONE2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_CONE2_ID);
+        IMAGE_REANIM_ZOMBIE_CONE3 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_CONE3_ID);
+        IMAGE_REANIM_ZOMBIE_DIGGER_HARDHAT = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_DIGGER_HARDHAT_ID);
+        IMAGE_REANIM_ZOMBIE_DIGGER_HARDHAT2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_DIGGER_HARDHAT2_ID);
+        IMAGE_REANIM_ZOMBIE_DIGGER_HARDHAT3 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_DIGGER_HARDHAT3_ID);
+        IMAGE_REANIM_ZOMBIE_DIGGER_OUTERARM_UPPER2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_DIGGER_OUTERARM_UPPER2_ID);
+        IMAGE_REANIM_ZOMBIE_DIGGER_PICKAXE = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_DIGGER_PICKAXE_ID);
+        IMAGE_REANIM_ZOMBIE_DISCO_OUTERARM_HAND =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_DISCO_OUTERARM_HAND_ID);
+        IMAGE_REANIM_ZOMBIE_DISCO_OUTERARM_UPPER2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_DISCO_OUTERARM_UPPER2_ID);
         IMAGE_REANIM_ZOMBIE_DOLPHINRIDER_OUTERARM_UPPER2 =
-            aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_DOLPHINRIDER_OUTERARM_UPPER2");
-        IMAGE_REANIM_ZOMBIE_FLAG1 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_FLAG1");
-        IMAGE_REANIM_ZOMBIE_FLAG3 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_FLAG3");
-        IMAGE_REANIM_ZOMBIE_FOOTBALL_HELMET = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_FOOTBALL_HELMET");
-        IMAGE_REANIM_ZOMBIE_FOOTBALL_HELMET2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_FOOTBALL_HELMET2");
-        IMAGE_REANIM_ZOMBIE_FOOTBALL_HELMET3 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_FOOTBALL_HELMET3");
-        IMAGE_REANIM_ZOMBIE_FOOTBALL_LEFTARM_HAND = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_FOOTBALL_LEFTARM_HAND");
-        IMAGE_REANIM_ZOMBIE_FOOTBALL_LEFTARM_UPPER2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_FOOTBALL_LEFTARM_UPPER2");
-        IMAGE_REANIM_ZOMBIE_GARGANTUAR_BODY1_2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_GARGANTUAR_BODY1_2");
-        IMAGE_REANIM_ZOMBIE_GARGANTUAR_BODY1_3 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_GARGANTUAR_BODY1_3");
-        IMAGE_REANIM_ZOMBIE_GARGANTUAR_DUCKXING = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_GARGANTUAR_DUCKXING");
-        IMAGE_REANIM_ZOMBIE_GARGANTUAR_FOOT2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_GARGANTUAR_FOOT2");
-        IMAGE_REANIM_ZOMBIE_GARGANTUAR_HEAD2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_GARGANTUAR_HEAD2");
-        IMAGE_REANIM_ZOMBIE_GARGANTUAR_HEAD2_REDEYE = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_GARGANTUAR_HEAD2_REDEYE");
-        IMAGE_REANIM_ZOMBIE_GARGANTUAR_HEAD_REDEYE = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_GARGANTUAR_HEAD_REDEYE");
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_DOLPHINRIDER_OUTERARM_UPPER2_ID);
+        IMAGE_REANIM_ZOMBIE_FLAG1 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_FLAG1_ID);
+        IMAGE_REANIM_ZOMBIE_FLAG3 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_FLAG3_ID);
+        IMAGE_REANIM_ZOMBIE_FOOTBALL_HELMET = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_FOOTBALL_HELMET_ID);
+        IMAGE_REANIM_ZOMBIE_FOOTBALL_HELMET2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_FOOTBALL_HELMET2_ID);
+        IMAGE_REANIM_ZOMBIE_FOOTBALL_HELMET3 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_FOOTBALL_HELMET3_ID);
+        IMAGE_REANIM_ZOMBIE_FOOTBALL_LEFTARM_HAND =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_FOOTBALL_LEFTARM_HAND_ID);
+        IMAGE_REANIM_ZOMBIE_FOOTBALL_LEFTARM_UPPER2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_FOOTBALL_LEFTARM_UPPER2_ID);
+        IMAGE_REANIM_ZOMBIE_GARGANTUAR_BODY1_2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_GARGANTUAR_BODY1_2_ID);
+        IMAGE_REANIM_ZOMBIE_GARGANTUAR_BODY1_3 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_GARGANTUAR_BODY1_3_ID);
+        IMAGE_REANIM_ZOMBIE_GARGANTUAR_DUCKXING =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_GARGANTUAR_DUCKXING_ID);
+        IMAGE_REANIM_ZOMBIE_GARGANTUAR_FOOT2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_GARGANTUAR_FOOT2_ID);
+        IMAGE_REANIM_ZOMBIE_GARGANTUAR_HEAD2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_GARGANTUAR_HEAD2_ID);
+        IMAGE_REANIM_ZOMBIE_GARGANTUAR_HEAD2_REDEYE =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_GARGANTUAR_HEAD2_REDEYE_ID);
+        IMAGE_REANIM_ZOMBIE_GARGANTUAR_HEAD_REDEYE =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_GARGANTUAR_HEAD_REDEYE_ID);
         IMAGE_REANIM_ZOMBIE_GARGANTUAR_OUTERARM_LOWER2 =
-            aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_GARGANTUAR_OUTERARM_LOWER2");
-        IMAGE_REANIM_ZOMBIE_GARGANTUAR_ZOMBIE = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_GARGANTUAR_ZOMBIE");
-        IMAGE_REANIM_ZOMBIE_HEAD_GROSSOUT = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_HEAD_GROSSOUT");
-        IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES1 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES1");
-        IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES2");
-        IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES3 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES3");
-        IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES4 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES4");
-        IMAGE_REANIM_ZOMBIE_IMP_ARM1_BONE = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_IMP_ARM1_BONE");
-        IMAGE_REANIM_ZOMBIE_IMP_ARM2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_IMP_ARM2");
-        IMAGE_REANIM_ZOMBIE_JACKBOX_BOX = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_JACKBOX_BOX");
-        IMAGE_REANIM_ZOMBIE_JACKBOX_OUTERARM_LOWER2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_JACKBOX_OUTERARM_LOWER2");
-        IMAGE_REANIM_ZOMBIE_LADDER_1 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_LADDER_1");
-        IMAGE_REANIM_ZOMBIE_LADDER_1_DAMAGE1 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_LADDER_1_DAMAGE1");
-        IMAGE_REANIM_ZOMBIE_LADDER_1_DAMAGE2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_LADDER_1_DAMAGE2");
-        IMAGE_REANIM_ZOMBIE_LADDER_5 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_LADDER_5");
-        IMAGE_REANIM_ZOMBIE_LADDER_OUTERARM_UPPER2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_LADDER_OUTERARM_UPPER2");
-        IMAGE_REANIM_ZOMBIE_MUSTACHE2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_MUSTACHE2");
-        IMAGE_REANIM_ZOMBIE_MUSTACHE3 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_MUSTACHE3");
-        IMAGE_REANIM_ZOMBIE_OUTERARM_HAND = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_OUTERARM_HAND");
-        IMAGE_REANIM_ZOMBIE_OUTERARM_UPPER2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_OUTERARM_UPPER2");
-        IMAGE_REANIM_ZOMBIE_PAPER_LEFTARM_LOWER = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_PAPER_LEFTARM_LOWER");
-        IMAGE_REANIM_ZOMBIE_PAPER_LEFTARM_UPPER2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_PAPER_LEFTARM_UPPER2");
-        IMAGE_REANIM_ZOMBIE_PAPER_MADHEAD = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_PAPER_MADHEAD");
-        IMAGE_REANIM_ZOMBIE_PAPER_PAPER2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_PAPER_PAPER2");
-        IMAGE_REANIM_ZOMBIE_PAPER_PAPER3 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_PAPER_PAPER3");
-        IMAGE_REANIM_ZOMBIE_POGO_OUTERARM_UPPER2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_POGO_OUTERARM_UPPER2");
-        IMAGE_REANIM_ZOMBIE_POGO_STICK2DAMAGE1 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_POGO_STICK2DAMAGE1");
-        IMAGE_REANIM_ZOMBIE_POGO_STICK2DAMAGE2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_POGO_STICK2DAMAGE2");
-        IMAGE_REANIM_ZOMBIE_POGO_STICKDAMAGE1 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_POGO_STICKDAMAGE1");
-        IMAGE_REANIM_ZOMBIE_POGO_STICKDAMAGE2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_POGO_STICKDAMAGE2");
-        IMAGE_REANIM_ZOMBIE_POGO_STICKHANDS2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_POGO_STICKHANDS2");
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_GARGANTUAR_OUTERARM_LOWER2_ID);
+        IMAGE_REANIM_ZOMBIE_GARGANTUAR_ZOMBIE =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_GARGANTUAR_ZOMBIE_ID);
+        IMAGE_REANIM_ZOMBIE_HEAD_GROSSOUT = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_HEAD_GROSSOUT_ID);
+        IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES1 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES1_ID);
+        IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES2_ID);
+        IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES3 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES3_ID);
+        IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES4 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES4_ID);
+        IMAGE_REANIM_ZOMBIE_IMP_ARM1_BONE = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_IMP_ARM1_BONE_ID);
+        IMAGE_REANIM_ZOMBIE_IMP_ARM2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_IMP_ARM2_ID);
+        IMAGE_REANIM_ZOMBIE_JACKBOX_BOX = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_JACKBOX_BOX_ID);
+        IMAGE_REANIM_ZOMBIE_JACKBOX_OUTERARM_LOWER2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_JACKBOX_OUTERARM_LOWER2_ID);
+        IMAGE_REANIM_ZOMBIE_LADDER_1 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_LADDER_1_ID);
+        IMAGE_REANIM_ZOMBIE_LADDER_1_DAMAGE1 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_LADDER_1_DAMAGE1_ID);
+        IMAGE_REANIM_ZOMBIE_LADDER_1_DAMAGE2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_LADDER_1_DAMAGE2_ID);
+        IMAGE_REANIM_ZOMBIE_LADDER_5 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_LADDER_5_ID);
+        IMAGE_REANIM_ZOMBIE_LADDER_OUTERARM_UPPER2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_LADDER_OUTERARM_UPPER2_ID);
+        IMAGE_REANIM_ZOMBIE_MUSTACHE2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_MUSTACHE2_ID);
+        IMAGE_REANIM_ZOMBIE_MUSTACHE3 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_MUSTACHE3_ID);
+        IMAGE_REANIM_ZOMBIE_OUTERARM_HAND = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_OUTERARM_HAND_ID);
+        IMAGE_REANIM_ZOMBIE_OUTERARM_UPPER2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_OUTERARM_UPPER2_ID);
+        IMAGE_REANIM_ZOMBIE_PAPER_LEFTARM_LOWER =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_PAPER_LEFTARM_LOWER_ID);
+        IMAGE_REANIM_ZOMBIE_PAPER_LEFTARM_UPPER2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_PAPER_LEFTARM_UPPER2_ID);
+        IMAGE_REANIM_ZOMBIE_PAPER_MADHEAD = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_PAPER_MADHEAD_ID);
+        IMAGE_REANIM_ZOMBIE_PAPER_PAPER2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_PAPER_PAPER2_ID);
+        IMAGE_REANIM_ZOMBIE_PAPER_PAPER3 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_PAPER_PAPER3_ID);
+        IMAGE_REANIM_ZOMBIE_POGO_OUTERARM_UPPER2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_POGO_OUTERARM_UPPER2_ID);
+        IMAGE_REANIM_ZOMBIE_POGO_STICK2DAMAGE1 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_POGO_STICK2DAMAGE1_ID);
+        IMAGE_REANIM_ZOMBIE_POGO_STICK2DAMAGE2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_POGO_STICK2DAMAGE2_ID);
+        IMAGE_REANIM_ZOMBIE_POGO_STICKDAMAGE1 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_POGO_STICKDAMAGE1_ID);
+        IMAGE_REANIM_ZOMBIE_POGO_STICKDAMAGE2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_POGO_STICKDAMAGE2_ID);
+        IMAGE_REANIM_ZOMBIE_POGO_STICKHANDS2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_POGO_STICKHANDS2_ID);
         IMAGE_REANIM_ZOMBIE_POLEVAULTER_OUTERARM_UPPER2 =
-            aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_POLEVAULTER_OUTERARM_UPPER2");
-        IMAGE_REANIM_ZOMBIE_SCREENDOOR1 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_SCREENDOOR1");
-        IMAGE_REANIM_ZOMBIE_SCREENDOOR2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_SCREENDOOR2");
-        IMAGE_REANIM_ZOMBIE_SCREENDOOR3 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_SCREENDOOR3");
-        IMAGE_REANIM_ZOMBIE_SNORKLE_HEAD = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_SNORKLE_HEAD");
-        IMAGE_REANIM_ZOMBIE_SNORKLE_OUTERARM_UPPER2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_SNORKLE_OUTERARM_UPPER2");
-        IMAGE_REANIM_ZOMBIE_YETI_OUTERARM_HAND = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_YETI_OUTERARM_HAND");
-        IMAGE_REANIM_ZOMBIE_YETI_OUTERARM_UPPER2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_YETI_OUTERARM_UPPER2");
-        IMAGE_REANIM_ZOMBIE_ZAMBONI_1_DAMAGE1 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_ZAMBONI_1_DAMAGE1");
-        IMAGE_REANIM_ZOMBIE_ZAMBONI_1_DAMAGE2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_ZAMBONI_1_DAMAGE2");
-        IMAGE_REANIM_ZOMBIE_ZAMBONI_2_DAMAGE1 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_ZAMBONI_2_DAMAGE1");
-        IMAGE_REANIM_ZOMBIE_ZAMBONI_2_DAMAGE2 = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_ZAMBONI_2_DAMAGE2");
-        IMAGE_REANIM_ZOMBIE_ZAMBONI_WHEEL_FLAT = aMgr.GetImageThrow("IMAGE_REANIM_ZOMBIE_ZAMBONI_WHEEL_FLAT");
-        IMAGE_ROCKSMALL = aMgr.GetImageThrow("IMAGE_ROCKSMALL");
-        IMAGE_SCARY_POT = aMgr.GetImageThrow("IMAGE_SCARY_POT");
-        IMAGE_SEEDBANK = aMgr.GetImageThrow("IMAGE_SEEDBANK");
-        IMAGE_SEEDCHOOSER_BACKGROUND = aMgr.GetImageThrow("IMAGE_SEEDCHOOSER_BACKGROUND");
-        IMAGE_SEEDCHOOSER_BUTTON = aMgr.GetImageThrow("IMAGE_SEEDCHOOSER_BUTTON");
-        IMAGE_SEEDCHOOSER_BUTTON2 = aMgr.GetImageThrow("IMAGE_SEEDCHOOSER_BUTTON2");
-        IMAGE_SEEDCHOOSER_BUTTON2_GLOW = aMgr.GetImageThrow("IMAGE_SEEDCHOOSER_BUTTON2_GLOW");
-        IMAGE_SEEDCHOOSER_BUTTON_DISABLED = aMgr.GetImageThrow("IMAGE_SEEDCHOOSER_BUTTON_DISABLED");
-        IMAGE_SEEDCHOOSER_BUTTON_GLOW = aMgr.GetImageThrow("IMAGE_SEEDCHOOSER_BUTTON_GLOW");
-        IMAGE_SEEDCHOOSER_IMITATERADDON = aMgr.GetImageThrow("IMAGE_SEEDCHOOSER_IMITATERADDON");
-        IMAGE_SEEDPACKETFLASH = aMgr.GetImageThrow("IMAGE_SEEDPACKETFLASH");
-        IMAGE_SEEDPACKETSILHOUETTE = aMgr.GetImageThrow("IMAGE_SEEDPACKETSILHOUETTE");
-        IMAGE_SEEDPACKET_LARGER = aMgr.GetImageThrow("IMAGE_SEEDPACKET_LARGER");
-        IMAGE_SEEDS = aMgr.GetImageThrow("IMAGE_SEEDS");
-        IMAGE_SELECTORSCREEN_ACHIEVEMENTS_BG = aMgr.GetImageThrow("IMAGE_SELECTORSCREEN_ACHIEVEMENTS_BG");
-        IMAGE_SELECTORSCREEN_ACHIEVEMENTS_PEDESTAL = aMgr.GetImageThrow("IMAGE_SELECTORSCREEN_ACHIEVEMENTS_PEDESTAL");
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_POLEVAULTER_OUTERARM_UPPER2_ID);
+        IMAGE_REANIM_ZOMBIE_SCREENDOOR1 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_SCREENDOOR1_ID);
+        IMAGE_REANIM_ZOMBIE_SCREENDOOR2 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_SCREENDOOR2_ID);
+        IMAGE_REANIM_ZOMBIE_SCREENDOOR3 = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_SCREENDOOR3_ID);
+        IMAGE_REANIM_ZOMBIE_SNORKLE_HEAD = aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_SNORKLE_HEAD_ID);
+        IMAGE_REANIM_ZOMBIE_SNORKLE_OUTERARM_UPPER2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_SNORKLE_OUTERARM_UPPER2_ID);
+        IMAGE_REANIM_ZOMBIE_YETI_OUTERARM_HAND =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_YETI_OUTERARM_HAND_ID);
+        IMAGE_REANIM_ZOMBIE_YETI_OUTERARM_UPPER2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_YETI_OUTERARM_UPPER2_ID);
+        IMAGE_REANIM_ZOMBIE_ZAMBONI_1_DAMAGE1 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_ZAMBONI_1_DAMAGE1_ID);
+        IMAGE_REANIM_ZOMBIE_ZAMBONI_1_DAMAGE2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_ZAMBONI_1_DAMAGE2_ID);
+        IMAGE_REANIM_ZOMBIE_ZAMBONI_2_DAMAGE1 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_ZAMBONI_2_DAMAGE1_ID);
+        IMAGE_REANIM_ZOMBIE_ZAMBONI_2_DAMAGE2 =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_ZAMBONI_2_DAMAGE2_ID);
+        IMAGE_REANIM_ZOMBIE_ZAMBONI_WHEEL_FLAT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_REANIM_ZOMBIE_ZAMBONI_WHEEL_FLAT_ID);
+        IMAGE_ROCKSMALL = aMgr.GetImageThrow(ResourceId::IMAGE_ROCKSMALL_ID);
+        IMAGE_SCARY_POT = aMgr.GetImageThrow(ResourceId::IMAGE_SCARY_POT_ID);
+        IMAGE_SEEDBANK = aMgr.GetImageThrow(ResourceId::IMAGE_SEEDBANK_ID);
+        IMAGE_SEEDCHOOSER_BACKGROUND = aMgr.GetImageThrow(ResourceId::IMAGE_SEEDCHOOSER_BACKGROUND_ID);
+        IMAGE_SEEDCHOOSER_BUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_SEEDCHOOSER_BUTTON_ID);
+        IMAGE_SEEDCHOOSER_BUTTON2 = aMgr.GetImageThrow(ResourceId::IMAGE_SEEDCHOOSER_BUTTON2_ID);
+        IMAGE_SEEDCHOOSER_BUTTON2_GLOW = aMgr.GetImageThrow(ResourceId::IMAGE_SEEDCHOOSER_BUTTON2_GLOW_ID);
+        IMAGE_SEEDCHOOSER_BUTTON_DISABLED = aMgr.GetImageThrow(ResourceId::IMAGE_SEEDCHOOSER_BUTTON_DISABLED_ID);
+        IMAGE_SEEDCHOOSER_BUTTON_GLOW = aMgr.GetImageThrow(ResourceId::IMAGE_SEEDCHOOSER_BUTTON_GLOW_ID);
+        IMAGE_SEEDCHOOSER_IMITATERADDON = aMgr.GetImageThrow(ResourceId::IMAGE_SEEDCHOOSER_IMITATERADDON_ID);
+        IMAGE_SEEDPACKETFLASH = aMgr.GetImageThrow(ResourceId::IMAGE_SEEDPACKETFLASH_ID);
+        IMAGE_SEEDPACKETSILHOUETTE = aMgr.GetImageThrow(ResourceId::IMAGE_SEEDPACKETSILHOUETTE_ID);
+        IMAGE_SEEDPACKET_LARGER = aMgr.GetImageThrow(ResourceId::IMAGE_SEEDPACKET_LARGER_ID);
+        IMAGE_SEEDS = aMgr.GetImageThrow(ResourceId::IMAGE_SEEDS_ID);
+        IMAGE_SELECTORSCREEN_ACHIEVEMENTS_BG = aMgr.GetImageThrow(ResourceId::IMAGE_SELECTORSCREEN_ACHIEVEMENTS_BG_ID);
+        IMAGE_SELECTORSCREEN_ACHIEVEMENTS_PEDESTAL =
+            aMgr.GetImageThrow(ResourceId::IMAGE_SELECTORSCREEN_ACHIEVEMENTS_PEDESTAL_ID);
         IMAGE_SELECTORSCREEN_ACHIEVEMENTS_PEDESTAL_PRESS =
-            aMgr.GetImageThrow("IMAGE_SELECTORSCREEN_ACHIEVEMENTS_PEDESTAL_PRESS");
-        IMAGE_SELECTORSCREEN_ALMANAC = aMgr.GetImageThrow("IMAGE_SELECTORSCREEN_ALMANAC");
-        IMAGE_SELECTORSCREEN_ALMANACHIGHLIGHT = aMgr.GetImageThrow("IMAGE_SELECTORSCREEN_ALMANACHIGHLIGHT");
-        IMAGE_SELECTORSCREEN_HELP1 = aMgr.GetImageThrow("IMAGE_SELECTORSCREEN_HELP1");
-        IMAGE_SELECTORSCREEN_HELP2 = aMgr.GetImageThrow("IMAGE_SELECTORSCREEN_HELP2");
-        IMAGE_SELECTORSCREEN_LEVELNUMBERS = aMgr.GetImageThrow("IMAGE_SELECTORSCREEN_LEVELNUMBERS");
-        IMAGE_SELECTORSCREEN_MOREWAYSTOPLAY_BG = aMgr.GetImageThrow("IMAGE_SELECTORSCREEN_MOREWAYSTOPLAY_BG");
-        IMAGE_SELECTORSCREEN_OPTIONS1 = aMgr.GetImageThrow("IMAGE_SELECTORSCREEN_OPTIONS1");
-        IMAGE_SELECTORSCREEN_OPTIONS2 = aMgr.GetImageThrow("IMAGE_SELECTORSCREEN_OPTIONS2");
-        IMAGE_SELECTORSCREEN_QUIT1 = aMgr.GetImageThrow("IMAGE_SELECTORSCREEN_QUIT1");
-        IMAGE_SELECTORSCREEN_QUIT2 = aMgr.GetImageThrow("IMAGE_SELECTORSCREEN_QUIT2");
-        IMAGE_SELECTORSCREEN_STORE = aMgr.GetImageThrow("IMAGE_SELECTORSCREEN_STORE");
-        IMAGE_SELECTORSCREEN_STOREHIGHLIGHT = aMgr.GetImageThrow("IMAGE_SELECTORSCREEN_STOREHIGHLIGHT");
-        IMAGE_SELECTORSCREEN_ZENGARDEN = aMgr.GetImageThrow("IMAGE_SELECTORSCREEN_ZENGARDEN");
-        IMAGE_SELECTORSCREEN_ZENGARDENHIGHLIGHT = aMgr.GetImageThrow("IMAGE_SELECTORSCREEN_ZENGARDENHIGHLIGHT");
-        IMAGE_SHOVEL = aMgr.GetImageThrow("IMAGE_SHOVEL");
-        IMAGE_SHOVELBANK = aMgr.GetImageThrow("IMAGE_SHOVELBANK");
-        IMAGE_SHOVEL_HI_RES = aMgr.GetImageThrow("IMAGE_SHOVEL_HI_RES");
-        IMAGE_SLOTMACHINE_OVERLAY = aMgr.GetImageThrow("IMAGE_SLOTMACHINE_OVERLAY");
-        IMAGE_SNOWFLAKES = aMgr.GetImageThrow("IMAGE_SNOWFLAKES");
-        IMAGE_SNOWPEA_PARTICLES = aMgr.GetImageThrow("IMAGE_SNOWPEA_PARTICLES");
-        IMAGE_SNOWPEA_PUFF = aMgr.GetImageThrow("IMAGE_SNOWPEA_PUFF");
-        IMAGE_SNOWPEA_SPLATS = aMgr.GetImageThrow("IMAGE_SNOWPEA_SPLATS");
-        IMAGE_SPOTLIGHT = aMgr.GetImageThrow("IMAGE_SPOTLIGHT");
-        IMAGE_SPOTLIGHT2 = aMgr.GetImageThrow("IMAGE_SPOTLIGHT2");
-        IMAGE_STAR_PARTICLES = aMgr.GetImageThrow("IMAGE_STAR_PARTICLES");
-        IMAGE_STAR_SPLATS = aMgr.GetImageThrow("IMAGE_STAR_SPLATS");
-        IMAGE_STORE_SPEECHBUBBLE = aMgr.GetImageThrow("IMAGE_STORE_SPEECHBUBBLE");
-        IMAGE_STORE_SPEECHBUBBLE2 = aMgr.GetImageThrow("IMAGE_STORE_SPEECHBUBBLE2");
-        IMAGE_SUNBANK = aMgr.GetImageThrow("IMAGE_SUNBANK");
-        IMAGE_SUNFLOWER_TROPHY = aMgr.GetImageThrow("IMAGE_SUNFLOWER_TROPHY");
-        IMAGE_TACO = aMgr.GetImageThrow("IMAGE_TACO");
-        IMAGE_TOMBSTONES = aMgr.GetImageThrow("IMAGE_TOMBSTONES");
-        IMAGE_TOMBSTONE_MOUNDS = aMgr.GetImageThrow("IMAGE_TOMBSTONE_MOUNDS");
-        IMAGE_TREEFOOD = aMgr.GetImageThrow("IMAGE_TREEFOOD");
-        IMAGE_TROPHY = aMgr.GetImageThrow("IMAGE_TROPHY");
-        IMAGE_TROPHY_HI_RES = aMgr.GetImageThrow("IMAGE_TROPHY_HI_RES");
-        IMAGE_VASE_CHUNKS = aMgr.GetImageThrow("IMAGE_VASE_CHUNKS");
-        IMAGE_WALLNUTPARTICLESLARGE = aMgr.GetImageThrow("IMAGE_WALLNUTPARTICLESLARGE");
-        IMAGE_WALLNUTPARTICLESSMALL = aMgr.GetImageThrow("IMAGE_WALLNUTPARTICLESSMALL");
-        IMAGE_WALLNUT_BOWLINGSTRIPE = aMgr.GetImageThrow("IMAGE_WALLNUT_BOWLINGSTRIPE");
-        IMAGE_WATERDROP = aMgr.GetImageThrow("IMAGE_WATERDROP");
-        IMAGE_WATERINGCAN = aMgr.GetImageThrow("IMAGE_WATERINGCAN");
-        IMAGE_WATERINGCANGOLD = aMgr.GetImageThrow("IMAGE_WATERINGCANGOLD");
-        IMAGE_WATERPARTICLE = aMgr.GetImageThrow("IMAGE_WATERPARTICLE");
-        IMAGE_WHITEPIXEL = aMgr.GetImageThrow("IMAGE_WHITEPIXEL");
-        IMAGE_WHITEWATER = aMgr.GetImageThrow("IMAGE_WHITEWATER");
-        IMAGE_WHITEWATER_SHADOW = aMgr.GetImageThrow("IMAGE_WHITEWATER_SHADOW");
-        IMAGE_WINTERMELON_PARTICLES = aMgr.GetImageThrow("IMAGE_WINTERMELON_PARTICLES");
-        IMAGE_ZAMBONISMOKE = aMgr.GetImageThrow("IMAGE_ZAMBONISMOKE");
-        IMAGE_ZENSHOPBUTTON = aMgr.GetImageThrow("IMAGE_ZENSHOPBUTTON");
-        IMAGE_ZENSHOPBUTTON_HIGHLIGHT = aMgr.GetImageThrow("IMAGE_ZENSHOPBUTTON_HIGHLIGHT");
-        IMAGE_ZEN_GARDENGLOVE = aMgr.GetImageThrow("IMAGE_ZEN_GARDENGLOVE");
-        IMAGE_ZEN_GOLDTOOLRETICLE = aMgr.GetImageThrow("IMAGE_ZEN_GOLDTOOLRETICLE");
-        IMAGE_ZEN_MONEYSIGN = aMgr.GetImageThrow("IMAGE_ZEN_MONEYSIGN");
-        IMAGE_ZEN_NEED_ICONS = aMgr.GetImageThrow("IMAGE_ZEN_NEED_ICONS");
-        IMAGE_ZEN_NEXTGARDEN = aMgr.GetImageThrow("IMAGE_ZEN_NEXTGARDEN");
-        IMAGE_ZEN_WHEELBARROW = aMgr.GetImageThrow("IMAGE_ZEN_WHEELBARROW");
-        IMAGE_ZOMBIEBACKUPDANCERHEAD = aMgr.GetImageThrow("IMAGE_ZOMBIEBACKUPDANCERHEAD");
-        IMAGE_ZOMBIEBALLOONHEAD = aMgr.GetImageThrow("IMAGE_ZOMBIEBALLOONHEAD");
-        IMAGE_ZOMBIEBOBSLEDHEAD = aMgr.GetImageThrow("IMAGE_ZOMBIEBOBSLEDHEAD");
-        IMAGE_ZOMBIEDANCERHEAD = aMgr.GetImageThrow("IMAGE_ZOMBIEDANCERHEAD");
-        IMAGE_ZOMBIEDIGGERARM = aMgr.GetImageThrow("IMAGE_ZOMBIEDIGGERARM");
-        IMAGE_ZOMBIEDIGGERHEAD = aMgr.GetImageThrow("IMAGE_ZOMBIEDIGGERHEAD");
-        IMAGE_ZOMBIEDOLPHINRIDERHEAD = aMgr.GetImageThrow("IMAGE_ZOMBIEDOLPHINRIDERHEAD");
-        IMAGE_ZOMBIEFOOTBALLHEAD = aMgr.GetImageThrow("IMAGE_ZOMBIEFOOTBALLHEAD");
-        IMAGE_ZOMBIEFUTUREGLASSES = aMgr.GetImageThrow("IMAGE_ZOMBIEFUTUREGLASSES");
-        IMAGE_ZOMBIEIMPHEAD = aMgr.GetImageThrow("IMAGE_ZOMBIEIMPHEAD");
-        IMAGE_ZOMBIEJACKBOXARM = aMgr.GetImageThrow("IMAGE_ZOMBIEJACKBOXARM");
-        IMAGE_ZOMBIELADDERHEAD = aMgr.GetImageThrow("IMAGE_ZOMBIELADDERHEAD");
-        IMAGE_ZOMBIEPOGO = aMgr.GetImageThrow("IMAGE_ZOMBIEPOGO");
-        IMAGE_ZOMBIEPOLEVAULTERHEAD = aMgr.GetImageThrow("IMAGE_ZOMBIEPOLEVAULTERHEAD");
-        IMAGE_ZOMBIEYETIHEAD = aMgr.GetImageThrow("IMAGE_ZOMBIEYETIHEAD");
-        IMAGE_ZOMBIE_BOBSLED1 = aMgr.GetImageThrow("IMAGE_ZOMBIE_BOBSLED1");
-        IMAGE_ZOMBIE_BOBSLED2 = aMgr.GetImageThrow("IMAGE_ZOMBIE_BOBSLED2");
-        IMAGE_ZOMBIE_BOBSLED3 = aMgr.GetImageThrow("IMAGE_ZOMBIE_BOBSLED3");
-        IMAGE_ZOMBIE_BOBSLED4 = aMgr.GetImageThrow("IMAGE_ZOMBIE_BOBSLED4");
-        IMAGE_ZOMBIE_BOBSLED_INSIDE = aMgr.GetImageThrow("IMAGE_ZOMBIE_BOBSLED_INSIDE");
-        IMAGE_ZOMBIE_BOSS_FIREBALL_GROUNDPARTICLES = aMgr.GetImageThrow("IMAGE_ZOMBIE_BOSS_FIREBALL_GROUNDPARTICLES");
-        IMAGE_ZOMBIE_BOSS_FIREBALL_PARTICLES = aMgr.GetImageThrow("IMAGE_ZOMBIE_BOSS_FIREBALL_PARTICLES");
-        IMAGE_ZOMBIE_BOSS_ICEBALL_GROUNDPARTICLES = aMgr.GetImageThrow("IMAGE_ZOMBIE_BOSS_ICEBALL_GROUNDPARTICLES");
-        IMAGE_ZOMBIE_BOSS_ICEBALL_PARTICLES = aMgr.GetImageThrow("IMAGE_ZOMBIE_BOSS_ICEBALL_PARTICLES");
-        IMAGE_ZOMBIE_NOTE_SMALL = aMgr.GetImageThrow("IMAGE_ZOMBIE_NOTE_SMALL");
-        IMAGE_ZOMBIE_SEAWEED = aMgr.GetImageThrow("IMAGE_ZOMBIE_SEAWEED");
-        IMAGE_ZOMBOSS_PARTICLES = aMgr.GetImageThrow("IMAGE_ZOMBOSS_PARTICLES");
+            aMgr.GetImageThrow(ResourceId::IMAGE_SELECTORSCREEN_ACHIEVEMENTS_PEDESTAL_PRESS_ID);
+        IMAGE_SELECTORSCREEN_ALMANAC = aMgr.GetImageThrow(ResourceId::IMAGE_SELECTORSCREEN_ALMANAC_ID);
+        IMAGE_SELECTORSCREEN_ALMANACHIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_SELECTORSCREEN_ALMANACHIGHLIGHT_ID);
+        IMAGE_SELECTORSCREEN_HELP1 = aMgr.GetImageThrow(ResourceId::IMAGE_SELECTORSCREEN_HELP1_ID);
+        IMAGE_SELECTORSCREEN_HELP2 = aMgr.GetImageThrow(ResourceId::IMAGE_SELECTORSCREEN_HELP2_ID);
+        IMAGE_SELECTORSCREEN_LEVELNUMBERS = aMgr.GetImageThrow(ResourceId::IMAGE_SELECTORSCREEN_LEVELNUMBERS_ID);
+        IMAGE_SELECTORSCREEN_MOREWAYSTOPLAY_BG =
+            aMgr.GetImageThrow(ResourceId::IMAGE_SELECTORSCREEN_MOREWAYSTOPLAY_BG_ID);
+        IMAGE_SELECTORSCREEN_OPTIONS1 = aMgr.GetImageThrow(ResourceId::IMAGE_SELECTORSCREEN_OPTIONS1_ID);
+        IMAGE_SELECTORSCREEN_OPTIONS2 = aMgr.GetImageThrow(ResourceId::IMAGE_SELECTORSCREEN_OPTIONS2_ID);
+        IMAGE_SELECTORSCREEN_QUIT1 = aMgr.GetImageThrow(ResourceId::IMAGE_SELECTORSCREEN_QUIT1_ID);
+        IMAGE_SELECTORSCREEN_QUIT2 = aMgr.GetImageThrow(ResourceId::IMAGE_SELECTORSCREEN_QUIT2_ID);
+        IMAGE_SELECTORSCREEN_STORE = aMgr.GetImageThrow(ResourceId::IMAGE_SELECTORSCREEN_STORE_ID);
+        IMAGE_SELECTORSCREEN_STOREHIGHLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_SELECTORSCREEN_STOREHIGHLIGHT_ID);
+        IMAGE_SELECTORSCREEN_ZENGARDEN = aMgr.GetImageThrow(ResourceId::IMAGE_SELECTORSCREEN_ZENGARDEN_ID);
+        IMAGE_SELECTORSCREEN_ZENGARDENHIGHLIGHT =
+            aMgr.GetImageThrow(ResourceId::IMAGE_SELECTORSCREEN_ZENGARDENHIGHLIGHT_ID);
+        IMAGE_SHOVEL = aMgr.GetImageThrow(ResourceId::IMAGE_SHOVEL_ID);
+        IMAGE_SHOVELBANK = aMgr.GetImageThrow(ResourceId::IMAGE_SHOVELBANK_ID);
+        IMAGE_SHOVEL_HI_RES = aMgr.GetImageThrow(ResourceId::IMAGE_SHOVEL_HI_RES_ID);
+        IMAGE_SLOTMACHINE_OVERLAY = aMgr.GetImageThrow(ResourceId::IMAGE_SLOTMACHINE_OVERLAY_ID);
+        IMAGE_SNOWFLAKES = aMgr.GetImageThrow(ResourceId::IMAGE_SNOWFLAKES_ID);
+        IMAGE_SNOWPEA_PARTICLES = aMgr.GetImageThrow(ResourceId::IMAGE_SNOWPEA_PARTICLES_ID);
+        IMAGE_SNOWPEA_PUFF = aMgr.GetImageThrow(ResourceId::IMAGE_SNOWPEA_PUFF_ID);
+        IMAGE_SNOWPEA_SPLATS = aMgr.GetImageThrow(ResourceId::IMAGE_SNOWPEA_SPLATS_ID);
+        IMAGE_SPOTLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_SPOTLIGHT_ID);
+        IMAGE_SPOTLIGHT2 = aMgr.GetImageThrow(ResourceId::IMAGE_SPOTLIGHT2_ID);
+        IMAGE_STAR_PARTICLES = aMgr.GetImageThrow(ResourceId::IMAGE_STAR_PARTICLES_ID);
+        IMAGE_STAR_SPLATS = aMgr.GetImageThrow(ResourceId::IMAGE_STAR_SPLATS_ID);
+        IMAGE_STORE_SPEECHBUBBLE = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_SPEECHBUBBLE_ID);
+        IMAGE_STORE_SPEECHBUBBLE2 = aMgr.GetImageThrow(ResourceId::IMAGE_STORE_SPEECHBUBBLE2_ID);
+        IMAGE_SUNBANK = aMgr.GetImageThrow(ResourceId::IMAGE_SUNBANK_ID);
+        IMAGE_SUNFLOWER_TROPHY = aMgr.GetImageThrow(ResourceId::IMAGE_SUNFLOWER_TROPHY_ID);
+        IMAGE_TACO = aMgr.GetImageThrow(ResourceId::IMAGE_TACO_ID);
+        IMAGE_TOMBSTONES = aMgr.GetImageThrow(ResourceId::IMAGE_TOMBSTONES_ID);
+        IMAGE_TOMBSTONE_MOUNDS = aMgr.GetImageThrow(ResourceId::IMAGE_TOMBSTONE_MOUNDS_ID);
+        IMAGE_TREEFOOD = aMgr.GetImageThrow(ResourceId::IMAGE_TREEFOOD_ID);
+        IMAGE_TROPHY = aMgr.GetImageThrow(ResourceId::IMAGE_TROPHY_ID);
+        IMAGE_TROPHY_HI_RES = aMgr.GetImageThrow(ResourceId::IMAGE_TROPHY_HI_RES_ID);
+        IMAGE_VASE_CHUNKS = aMgr.GetImageThrow(ResourceId::IMAGE_VASE_CHUNKS_ID);
+        IMAGE_WALLNUTPARTICLESLARGE = aMgr.GetImageThrow(ResourceId::IMAGE_WALLNUTPARTICLESLARGE_ID);
+        IMAGE_WALLNUTPARTICLESSMALL = aMgr.GetImageThrow(ResourceId::IMAGE_WALLNUTPARTICLESSMALL_ID);
+        IMAGE_WALLNUT_BOWLINGSTRIPE = aMgr.GetImageThrow(ResourceId::IMAGE_WALLNUT_BOWLINGSTRIPE_ID);
+        IMAGE_WATERDROP = aMgr.GetImageThrow(ResourceId::IMAGE_WATERDROP_ID);
+        IMAGE_WATERINGCAN = aMgr.GetImageThrow(ResourceId::IMAGE_WATERINGCAN_ID);
+        IMAGE_WATERINGCANGOLD = aMgr.GetImageThrow(ResourceId::IMAGE_WATERINGCANGOLD_ID);
+        IMAGE_WATERPARTICLE = aMgr.GetImageThrow(ResourceId::IMAGE_WATERPARTICLE_ID);
+        IMAGE_WHITEPIXEL = aMgr.GetImageThrow(ResourceId::IMAGE_WHITEPIXEL_ID);
+        IMAGE_WHITEWATER = aMgr.GetImageThrow(ResourceId::IMAGE_WHITEWATER_ID);
+        IMAGE_WHITEWATER_SHADOW = aMgr.GetImageThrow(ResourceId::IMAGE_WHITEWATER_SHADOW_ID);
+        IMAGE_WINTERMELON_PARTICLES = aMgr.GetImageThrow(ResourceId::IMAGE_WINTERMELON_PARTICLES_ID);
+        IMAGE_ZAMBONISMOKE = aMgr.GetImageThrow(ResourceId::IMAGE_ZAMBONISMOKE_ID);
+        IMAGE_ZENSHOPBUTTON = aMgr.GetImageThrow(ResourceId::IMAGE_ZENSHOPBUTTON_ID);
+        IMAGE_ZENSHOPBUTTON_HIGHLIGHT = aMgr.GetImageThrow(ResourceId::IMAGE_ZENSHOPBUTTON_HIGHLIGHT_ID);
+        IMAGE_ZEN_GARDENGLOVE = aMgr.GetImageThrow(ResourceId::IMAGE_ZEN_GARDENGLOVE_ID);
+        IMAGE_ZEN_GOLDTOOLRETICLE = aMgr.GetImageThrow(ResourceId::IMAGE_ZEN_GOLDTOOLRETICLE_ID);
+        IMAGE_ZEN_MONEYSIGN = aMgr.GetImageThrow(ResourceId::IMAGE_ZEN_MONEYSIGN_ID);
+        IMAGE_ZEN_NEED_ICONS = aMgr.GetImageThrow(ResourceId::IMAGE_ZEN_NEED_ICONS_ID);
+        IMAGE_ZEN_NEXTGARDEN = aMgr.GetImageThrow(ResourceId::IMAGE_ZEN_NEXTGARDEN_ID);
+        IMAGE_ZEN_WHEELBARROW = aMgr.GetImageThrow(ResourceId::IMAGE_ZEN_WHEELBARROW_ID);
+        IMAGE_ZOMBIEBACKUPDANCERHEAD = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIEBACKUPDANCERHEAD_ID);
+        IMAGE_ZOMBIEBALLOONHEAD = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIEBALLOONHEAD_ID);
+        IMAGE_ZOMBIEBOBSLEDHEAD = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIEBOBSLEDHEAD_ID);
+        IMAGE_ZOMBIEDANCERHEAD = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIEDANCERHEAD_ID);
+        IMAGE_ZOMBIEDIGGERARM = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIEDIGGERARM_ID);
+        IMAGE_ZOMBIEDIGGERHEAD = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIEDIGGERHEAD_ID);
+        IMAGE_ZOMBIEDOLPHINRIDERHEAD = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIEDOLPHINRIDERHEAD_ID);
+        IMAGE_ZOMBIEFOOTBALLHEAD = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIEFOOTBALLHEAD_ID);
+        IMAGE_ZOMBIEFUTUREGLASSES = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIEFUTUREGLASSES_ID);
+        IMAGE_ZOMBIEIMPHEAD = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIEIMPHEAD_ID);
+        IMAGE_ZOMBIEJACKBOXARM = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIEJACKBOXARM_ID);
+        IMAGE_ZOMBIELADDERHEAD = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIELADDERHEAD_ID);
+        IMAGE_ZOMBIEPOGO = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIEPOGO_ID);
+        IMAGE_ZOMBIEPOLEVAULTERHEAD = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIEPOLEVAULTERHEAD_ID);
+        IMAGE_ZOMBIEYETIHEAD = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIEYETIHEAD_ID);
+        IMAGE_ZOMBIE_BOBSLED1 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_BOBSLED1_ID);
+        IMAGE_ZOMBIE_BOBSLED2 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_BOBSLED2_ID);
+        IMAGE_ZOMBIE_BOBSLED3 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_BOBSLED3_ID);
+        IMAGE_ZOMBIE_BOBSLED4 = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_BOBSLED4_ID);
+        IMAGE_ZOMBIE_BOBSLED_INSIDE = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_BOBSLED_INSIDE_ID);
+        IMAGE_ZOMBIE_BOSS_FIREBALL_GROUNDPARTICLES =
+            aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_BOSS_FIREBALL_GROUNDPARTICLES_ID);
+        IMAGE_ZOMBIE_BOSS_FIREBALL_PARTICLES = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_BOSS_FIREBALL_PARTICLES_ID);
+        IMAGE_ZOMBIE_BOSS_ICEBALL_GROUNDPARTICLES =
+            aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_BOSS_ICEBALL_GROUNDPARTICLES_ID);
+        IMAGE_ZOMBIE_BOSS_ICEBALL_PARTICLES = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_BOSS_ICEBALL_PARTICLES_ID);
+        IMAGE_ZOMBIE_NOTE_SMALL = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_NOTE_SMALL_ID);
+        IMAGE_ZOMBIE_SEAWEED = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBIE_SEAWEED_ID);
+        IMAGE_ZOMBOSS_PARTICLES = aMgr.GetImageThrow(ResourceId::IMAGE_ZOMBOSS_PARTICLES_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -2036,171 +2117,171 @@ bool Sexy::ExtractLoadingSoundsResources(ResourceManager *theManager) {
 
     ResourceManager &aMgr = *theManager;
     try {
-        SOUND_ACHIEVEMENT = aMgr.GetSoundThrow("SOUND_ACHIEVEMENT");
-        SOUND_AWOOGA = aMgr.GetSoundThrow("SOUND_AWOOGA");
-        SOUND_BALLOONINFLATE = aMgr.GetSoundThrow("SOUND_BALLOONINFLATE");
-        SOUND_BALLOON_POP = aMgr.GetSoundThrow("SOUND_BALLOON_POP");
-        SOUND_BASKETBALL = aMgr.GetSoundThrow("SOUND_BASKETBALL");
-        SOUND_BIGCHOMP = aMgr.GetSoundThrow("SOUND_BIGCHOMP");
-        SOUND_BLEEP = aMgr.GetSoundThrow("SOUND_BLEEP");
-        SOUND_BLOVER = aMgr.GetSoundThrow("SOUND_BLOVER");
-        SOUND_BOING = aMgr.GetSoundThrow("SOUND_BOING");
-        SOUND_BONK = aMgr.GetSoundThrow("SOUND_BONK");
-        SOUND_BOSSBOULDERATTACK = aMgr.GetSoundThrow("SOUND_BOSSBOULDERATTACK");
-        SOUND_BOSSEXPLOSION = aMgr.GetSoundThrow("SOUND_BOSSEXPLOSION");
-        SOUND_BOWLING = aMgr.GetSoundThrow("SOUND_BOWLING");
-        SOUND_BOWLINGIMPACT = aMgr.GetSoundThrow("SOUND_BOWLINGIMPACT");
-        SOUND_BOWLINGIMPACT2 = aMgr.GetSoundThrow("SOUND_BOWLINGIMPACT2");
-        SOUND_BUGSPRAY = aMgr.GetSoundThrow("SOUND_BUGSPRAY");
-        SOUND_BUNGEE_SCREAM = aMgr.GetSoundThrow("SOUND_BUNGEE_SCREAM");
-        SOUND_BUNGEE_SCREAM2 = aMgr.GetSoundThrow("SOUND_BUNGEE_SCREAM2");
-        SOUND_BUNGEE_SCREAM3 = aMgr.GetSoundThrow("SOUND_BUNGEE_SCREAM3");
-        SOUND_BUTTER = aMgr.GetSoundThrow("SOUND_BUTTER");
-        SOUND_BUZZER = aMgr.GetSoundThrow("SOUND_BUZZER");
-        SOUND_CERAMIC = aMgr.GetSoundThrow("SOUND_CERAMIC");
-        SOUND_CHERRYBOMB = aMgr.GetSoundThrow("SOUND_CHERRYBOMB");
-        SOUND_CHIME = aMgr.GetSoundThrow("SOUND_CHIME");
-        SOUND_CHOMP = aMgr.GetSoundThrow("SOUND_CHOMP");
-        SOUND_CHOMP2 = aMgr.GetSoundThrow("SOUND_CHOMP2");
-        SOUND_CHOMPSOFT = aMgr.GetSoundThrow("SOUND_CHOMPSOFT");
-        SOUND_COBLAUNCH = aMgr.GetSoundThrow("SOUND_COBLAUNCH");
-        SOUND_COFFEE = aMgr.GetSoundThrow("SOUND_COFFEE");
-        SOUND_COIN = aMgr.GetSoundThrow("SOUND_COIN");
-        SOUND_CRAZYDAVECRAZY = aMgr.GetSoundThrow("SOUND_CRAZYDAVECRAZY");
-        SOUND_CRAZYDAVEEXTRALONG1 = aMgr.GetSoundThrow("SOUND_CRAZYDAVEEXTRALONG1");
-        SOUND_CRAZYDAVEEXTRALONG2 = aMgr.GetSoundThrow("SOUND_CRAZYDAVEEXTRALONG2");
-        SOUND_CRAZYDAVEEXTRALONG3 = aMgr.GetSoundThrow("SOUND_CRAZYDAVEEXTRALONG3");
-        SOUND_CRAZYDAVELONG1 = aMgr.GetSoundThrow("SOUND_CRAZYDAVELONG1");
-        SOUND_CRAZYDAVELONG2 = aMgr.GetSoundThrow("SOUND_CRAZYDAVELONG2");
-        SOUND_CRAZYDAVELONG3 = aMgr.GetSoundThrow("SOUND_CRAZYDAVELONG3");
-        SOUND_CRAZYDAVESCREAM = aMgr.GetSoundThrow("SOUND_CRAZYDAVESCREAM");
-        SOUND_CRAZYDAVESCREAM2 = aMgr.GetSoundThrow("SOUND_CRAZYDAVESCREAM2");
-        SOUND_CRAZYDAVESHORT1 = aMgr.GetSoundThrow("SOUND_CRAZYDAVESHORT1");
-        SOUND_CRAZYDAVESHORT2 = aMgr.GetSoundThrow("SOUND_CRAZYDAVESHORT2");
-        SOUND_CRAZYDAVESHORT3 = aMgr.GetSoundThrow("SOUND_CRAZYDAVESHORT3");
-        SOUND_DANCER = aMgr.GetSoundThrow("SOUND_DANCER");
-        SOUND_DIAMOND = aMgr.GetSoundThrow("SOUND_DIAMOND");
-        SOUND_DIGGER_ZOMBIE = aMgr.GetSoundThrow("SOUND_DIGGER_ZOMBIE");
-        SOUND_DIRT_RISE = aMgr.GetSoundThrow("SOUND_DIRT_RISE");
-        SOUND_DOLPHIN_APPEARS = aMgr.GetSoundThrow("SOUND_DOLPHIN_APPEARS");
-        SOUND_DOLPHIN_BEFORE_JUMPING = aMgr.GetSoundThrow("SOUND_DOLPHIN_BEFORE_JUMPING");
-        SOUND_DOOMSHROOM = aMgr.GetSoundThrow("SOUND_DOOMSHROOM");
-        SOUND_EVILLAUGH = aMgr.GetSoundThrow("SOUND_EVILLAUGH");
-        SOUND_EXPLOSION = aMgr.GetSoundThrow("SOUND_EXPLOSION");
-        SOUND_FERTILIZER = aMgr.GetSoundThrow("SOUND_FERTILIZER");
-        SOUND_FINALFANFARE = aMgr.GetSoundThrow("SOUND_FINALFANFARE");
-        SOUND_FINALWAVE = aMgr.GetSoundThrow("SOUND_FINALWAVE");
-        SOUND_FIREPEA = aMgr.GetSoundThrow("SOUND_FIREPEA");
-        SOUND_FLOOP = aMgr.GetSoundThrow("SOUND_FLOOP");
-        SOUND_FROZEN = aMgr.GetSoundThrow("SOUND_FROZEN");
-        SOUND_FUME = aMgr.GetSoundThrow("SOUND_FUME");
-        SOUND_GARGANTUAR_THUMP = aMgr.GetSoundThrow("SOUND_GARGANTUAR_THUMP");
-        SOUND_GARGANTUDEATH = aMgr.GetSoundThrow("SOUND_GARGANTUDEATH");
-        SOUND_GRASSSTEP = aMgr.GetSoundThrow("SOUND_GRASSSTEP");
-        SOUND_GRAVEBUSTERCHOMP = aMgr.GetSoundThrow("SOUND_GRAVEBUSTERCHOMP");
-        SOUND_GRAVEBUTTON = aMgr.GetSoundThrow("SOUND_GRAVEBUTTON");
-        SOUND_GRAVESTONE_RUMBLE = aMgr.GetSoundThrow("SOUND_GRAVESTONE_RUMBLE");
-        SOUND_GROAN = aMgr.GetSoundThrow("SOUND_GROAN");
-        SOUND_GROAN2 = aMgr.GetSoundThrow("SOUND_GROAN2");
-        SOUND_GROAN3 = aMgr.GetSoundThrow("SOUND_GROAN3");
-        SOUND_GROAN4 = aMgr.GetSoundThrow("SOUND_GROAN4");
-        SOUND_GROAN5 = aMgr.GetSoundThrow("SOUND_GROAN5");
-        SOUND_GROAN6 = aMgr.GetSoundThrow("SOUND_GROAN6");
-        SOUND_GULP = aMgr.GetSoundThrow("SOUND_GULP");
-        SOUND_HATCHBACK_CLOSE = aMgr.GetSoundThrow("SOUND_HATCHBACK_CLOSE");
-        SOUND_HATCHBACK_OPEN = aMgr.GetSoundThrow("SOUND_HATCHBACK_OPEN");
-        SOUND_HUGE_WAVE = aMgr.GetSoundThrow("SOUND_HUGE_WAVE");
-        SOUND_HYDRAULIC = aMgr.GetSoundThrow("SOUND_HYDRAULIC");
-        SOUND_HYDRAULIC_SHORT = aMgr.GetSoundThrow("SOUND_HYDRAULIC_SHORT");
-        SOUND_IGNITE = aMgr.GetSoundThrow("SOUND_IGNITE");
-        SOUND_IGNITE2 = aMgr.GetSoundThrow("SOUND_IGNITE2");
-        SOUND_IMP = aMgr.GetSoundThrow("SOUND_IMP");
-        SOUND_IMP2 = aMgr.GetSoundThrow("SOUND_IMP2");
-        SOUND_JACKINTHEBOX = aMgr.GetSoundThrow("SOUND_JACKINTHEBOX");
-        SOUND_JACK_SURPRISE = aMgr.GetSoundThrow("SOUND_JACK_SURPRISE");
-        SOUND_JACK_SURPRISE2 = aMgr.GetSoundThrow("SOUND_JACK_SURPRISE2");
-        SOUND_JALAPENO = aMgr.GetSoundThrow("SOUND_JALAPENO");
-        SOUND_JUICY = aMgr.GetSoundThrow("SOUND_JUICY");
-        SOUND_KERNELPULT = aMgr.GetSoundThrow("SOUND_KERNELPULT");
-        SOUND_KERNELPULT2 = aMgr.GetSoundThrow("SOUND_KERNELPULT2");
-        SOUND_LADDER_ZOMBIE = aMgr.GetSoundThrow("SOUND_LADDER_ZOMBIE");
-        SOUND_LAWNMOWER = aMgr.GetSoundThrow("SOUND_LAWNMOWER");
-        SOUND_LIGHTFILL = aMgr.GetSoundThrow("SOUND_LIGHTFILL");
-        SOUND_LIMBS_POP = aMgr.GetSoundThrow("SOUND_LIMBS_POP");
-        SOUND_LOSEMUSIC = aMgr.GetSoundThrow("SOUND_LOSEMUSIC");
-        SOUND_LOWGROAN = aMgr.GetSoundThrow("SOUND_LOWGROAN");
-        SOUND_LOWGROAN2 = aMgr.GetSoundThrow("SOUND_LOWGROAN2");
-        SOUND_MAGNETSHROOM = aMgr.GetSoundThrow("SOUND_MAGNETSHROOM");
-        SOUND_MELONIMPACT = aMgr.GetSoundThrow("SOUND_MELONIMPACT");
-        SOUND_MELONIMPACT2 = aMgr.GetSoundThrow("SOUND_MELONIMPACT2");
-        SOUND_MINDCONTROLLED = aMgr.GetSoundThrow("SOUND_MINDCONTROLLED");
-        SOUND_MONEYFALLS = aMgr.GetSoundThrow("SOUND_MONEYFALLS");
-        SOUND_NEWSPAPER_RARRGH = aMgr.GetSoundThrow("SOUND_NEWSPAPER_RARRGH");
-        SOUND_NEWSPAPER_RARRGH2 = aMgr.GetSoundThrow("SOUND_NEWSPAPER_RARRGH2");
-        SOUND_NEWSPAPER_RIP = aMgr.GetSoundThrow("SOUND_NEWSPAPER_RIP");
-        SOUND_PAPER = aMgr.GetSoundThrow("SOUND_PAPER");
-        SOUND_PAUSE = aMgr.GetSoundThrow("SOUND_PAUSE");
-        SOUND_PHONOGRAPH = aMgr.GetSoundThrow("SOUND_PHONOGRAPH");
-        SOUND_PLANT = aMgr.GetSoundThrow("SOUND_PLANT");
-        SOUND_PLANT2 = aMgr.GetSoundThrow("SOUND_PLANT2");
-        SOUND_PLANTERN = aMgr.GetSoundThrow("SOUND_PLANTERN");
-        SOUND_PLANTGROW = aMgr.GetSoundThrow("SOUND_PLANTGROW");
-        SOUND_PLANT_WATER = aMgr.GetSoundThrow("SOUND_PLANT_WATER");
-        SOUND_PLASTICHIT = aMgr.GetSoundThrow("SOUND_PLASTICHIT");
-        SOUND_PLASTICHIT2 = aMgr.GetSoundThrow("SOUND_PLASTICHIT2");
-        SOUND_POGO_ZOMBIE = aMgr.GetSoundThrow("SOUND_POGO_ZOMBIE");
-        SOUND_POINTS = aMgr.GetSoundThrow("SOUND_POINTS");
-        SOUND_POLEVAULT = aMgr.GetSoundThrow("SOUND_POLEVAULT");
-        SOUND_POOL_CLEANER = aMgr.GetSoundThrow("SOUND_POOL_CLEANER");
-        SOUND_PORTAL = aMgr.GetSoundThrow("SOUND_PORTAL");
-        SOUND_POTATO_MINE = aMgr.GetSoundThrow("SOUND_POTATO_MINE");
-        SOUND_PRIZE = aMgr.GetSoundThrow("SOUND_PRIZE");
-        SOUND_PUFF = aMgr.GetSoundThrow("SOUND_PUFF");
-        SOUND_RAIN = aMgr.GetSoundThrow("SOUND_RAIN");
-        SOUND_READYSETPLANT = aMgr.GetSoundThrow("SOUND_READYSETPLANT");
-        SOUND_REVERSE_EXPLOSION = aMgr.GetSoundThrow("SOUND_REVERSE_EXPLOSION");
-        SOUND_ROLL_IN = aMgr.GetSoundThrow("SOUND_ROLL_IN");
-        SOUND_RVTHROW = aMgr.GetSoundThrow("SOUND_RVTHROW");
-        SOUND_SCREAM = aMgr.GetSoundThrow("SOUND_SCREAM");
-        SOUND_SEEDLIFT = aMgr.GetSoundThrow("SOUND_SEEDLIFT");
-        SOUND_SHIELDHIT = aMgr.GetSoundThrow("SOUND_SHIELDHIT");
-        SOUND_SHIELDHIT2 = aMgr.GetSoundThrow("SOUND_SHIELDHIT2");
-        SOUND_SHOOP = aMgr.GetSoundThrow("SOUND_SHOOP");
-        SOUND_SHOVEL = aMgr.GetSoundThrow("SOUND_SHOVEL");
-        SOUND_SIREN = aMgr.GetSoundThrow("SOUND_SIREN");
-        SOUND_SLOT_MACHINE = aMgr.GetSoundThrow("SOUND_SLOT_MACHINE");
-        SOUND_SLURP = aMgr.GetSoundThrow("SOUND_SLURP");
-        SOUND_SNOW_PEA_SPARKLES = aMgr.GetSoundThrow("SOUND_SNOW_PEA_SPARKLES");
-        SOUND_SPLAT = aMgr.GetSoundThrow("SOUND_SPLAT");
-        SOUND_SPLAT2 = aMgr.GetSoundThrow("SOUND_SPLAT2");
-        SOUND_SPLAT3 = aMgr.GetSoundThrow("SOUND_SPLAT3");
-        SOUND_SQUASH_HMM = aMgr.GetSoundThrow("SOUND_SQUASH_HMM");
-        SOUND_SQUASH_HMM2 = aMgr.GetSoundThrow("SOUND_SQUASH_HMM2");
-        SOUND_SUKHBIR = aMgr.GetSoundThrow("SOUND_SUKHBIR");
-        SOUND_SUKHBIR2 = aMgr.GetSoundThrow("SOUND_SUKHBIR2");
-        SOUND_SUKHBIR3 = aMgr.GetSoundThrow("SOUND_SUKHBIR3");
-        SOUND_SUKHBIR4 = aMgr.GetSoundThrow("SOUND_SUKHBIR4");
-        SOUND_SUKHBIR5 = aMgr.GetSoundThrow("SOUND_SUKHBIR5");
-        SOUND_SUKHBIR6 = aMgr.GetSoundThrow("SOUND_SUKHBIR6");
-        SOUND_SWING = aMgr.GetSoundThrow("SOUND_SWING");
-        SOUND_TAP = aMgr.GetSoundThrow("SOUND_TAP");
-        SOUND_TAP2 = aMgr.GetSoundThrow("SOUND_TAP2");
-        SOUND_TAPGLASS = aMgr.GetSoundThrow("SOUND_TAPGLASS");
-        SOUND_THROW = aMgr.GetSoundThrow("SOUND_THROW");
-        SOUND_THROW2 = aMgr.GetSoundThrow("SOUND_THROW2");
-        SOUND_THUNDER = aMgr.GetSoundThrow("SOUND_THUNDER");
-        SOUND_VASE_BREAKING = aMgr.GetSoundThrow("SOUND_VASE_BREAKING");
-        SOUND_WAKEUP = aMgr.GetSoundThrow("SOUND_WAKEUP");
-        SOUND_WATERING = aMgr.GetSoundThrow("SOUND_WATERING");
-        SOUND_WINMUSIC = aMgr.GetSoundThrow("SOUND_WINMUSIC");
-        SOUND_YUCK = aMgr.GetSoundThrow("SOUND_YUCK");
-        SOUND_YUCK2 = aMgr.GetSoundThrow("SOUND_YUCK2");
-        SOUND_ZAMBONI = aMgr.GetSoundThrow("SOUND_ZAMBONI");
-        SOUND_ZOMBAQUARIUM_DIE = aMgr.GetSoundThrow("SOUND_ZOMBAQUARIUM_DIE");
-        SOUND_ZOMBIESPLASH = aMgr.GetSoundThrow("SOUND_ZOMBIESPLASH");
-        SOUND_ZOMBIE_ENTERING_WATER = aMgr.GetSoundThrow("SOUND_ZOMBIE_ENTERING_WATER");
-        SOUND_ZOMBIE_FALLING_1 = aMgr.GetSoundThrow("SOUND_ZOMBIE_FALLING_1");
-        SOUND_ZOMBIE_FALLING_2 = aMgr.GetSoundThrow("SOUND_ZOMBIE_FALLING_2");
+        SOUND_ACHIEVEMENT = aMgr.GetSoundThrow(ResourceId::SOUND_ACHIEVEMENT_ID);
+        SOUND_AWOOGA = aMgr.GetSoundThrow(ResourceId::SOUND_AWOOGA_ID);
+        SOUND_BALLOONINFLATE = aMgr.GetSoundThrow(ResourceId::SOUND_BALLOONINFLATE_ID);
+        SOUND_BALLOON_POP = aMgr.GetSoundThrow(ResourceId::SOUND_BALLOON_POP_ID);
+        SOUND_BASKETBALL = aMgr.GetSoundThrow(ResourceId::SOUND_BASKETBALL_ID);
+        SOUND_BIGCHOMP = aMgr.GetSoundThrow(ResourceId::SOUND_BIGCHOMP_ID);
+        SOUND_BLEEP = aMgr.GetSoundThrow(ResourceId::SOUND_BLEEP_ID);
+        SOUND_BLOVER = aMgr.GetSoundThrow(ResourceId::SOUND_BLOVER_ID);
+        SOUND_BOING = aMgr.GetSoundThrow(ResourceId::SOUND_BOING_ID);
+        SOUND_BONK = aMgr.GetSoundThrow(ResourceId::SOUND_BONK_ID);
+        SOUND_BOSSBOULDERATTACK = aMgr.GetSoundThrow(ResourceId::SOUND_BOSSBOULDERATTACK_ID);
+        SOUND_BOSSEXPLOSION = aMgr.GetSoundThrow(ResourceId::SOUND_BOSSEXPLOSION_ID);
+        SOUND_BOWLING = aMgr.GetSoundThrow(ResourceId::SOUND_BOWLING_ID);
+        SOUND_BOWLINGIMPACT = aMgr.GetSoundThrow(ResourceId::SOUND_BOWLINGIMPACT_ID);
+        SOUND_BOWLINGIMPACT2 = aMgr.GetSoundThrow(ResourceId::SOUND_BOWLINGIMPACT2_ID);
+        SOUND_BUGSPRAY = aMgr.GetSoundThrow(ResourceId::SOUND_BUGSPRAY_ID);
+        SOUND_BUNGEE_SCREAM = aMgr.GetSoundThrow(ResourceId::SOUND_BUNGEE_SCREAM_ID);
+        SOUND_BUNGEE_SCREAM2 = aMgr.GetSoundThrow(ResourceId::SOUND_BUNGEE_SCREAM2_ID);
+        SOUND_BUNGEE_SCREAM3 = aMgr.GetSoundThrow(ResourceId::SOUND_BUNGEE_SCREAM3_ID);
+        SOUND_BUTTER = aMgr.GetSoundThrow(ResourceId::SOUND_BUTTER_ID);
+        SOUND_BUZZER = aMgr.GetSoundThrow(ResourceId::SOUND_BUZZER_ID);
+        SOUND_CERAMIC = aMgr.GetSoundThrow(ResourceId::SOUND_CERAMIC_ID);
+        SOUND_CHERRYBOMB = aMgr.GetSoundThrow(ResourceId::SOUND_CHERRYBOMB_ID);
+        SOUND_CHIME = aMgr.GetSoundThrow(ResourceId::SOUND_CHIME_ID);
+        SOUND_CHOMP = aMgr.GetSoundThrow(ResourceId::SOUND_CHOMP_ID);
+        SOUND_CHOMP2 = aMgr.GetSoundThrow(ResourceId::SOUND_CHOMP2_ID);
+        SOUND_CHOMPSOFT = aMgr.GetSoundThrow(ResourceId::SOUND_CHOMPSOFT_ID);
+        SOUND_COBLAUNCH = aMgr.GetSoundThrow(ResourceId::SOUND_COBLAUNCH_ID);
+        SOUND_COFFEE = aMgr.GetSoundThrow(ResourceId::SOUND_COFFEE_ID);
+        SOUND_COIN = aMgr.GetSoundThrow(ResourceId::SOUND_COIN_ID);
+        SOUND_CRAZYDAVECRAZY = aMgr.GetSoundThrow(ResourceId::SOUND_CRAZYDAVECRAZY_ID);
+        SOUND_CRAZYDAVEEXTRALONG1 = aMgr.GetSoundThrow(ResourceId::SOUND_CRAZYDAVEEXTRALONG1_ID);
+        SOUND_CRAZYDAVEEXTRALONG2 = aMgr.GetSoundThrow(ResourceId::SOUND_CRAZYDAVEEXTRALONG2_ID);
+        SOUND_CRAZYDAVEEXTRALONG3 = aMgr.GetSoundThrow(ResourceId::SOUND_CRAZYDAVEEXTRALONG3_ID);
+        SOUND_CRAZYDAVELONG1 = aMgr.GetSoundThrow(ResourceId::SOUND_CRAZYDAVELONG1_ID);
+        SOUND_CRAZYDAVELONG2 = aMgr.GetSoundThrow(ResourceId::SOUND_CRAZYDAVELONG2_ID);
+        SOUND_CRAZYDAVELONG3 = aMgr.GetSoundThrow(ResourceId::SOUND_CRAZYDAVELONG3_ID);
+        SOUND_CRAZYDAVESCREAM = aMgr.GetSoundThrow(ResourceId::SOUND_CRAZYDAVESCREAM_ID);
+        SOUND_CRAZYDAVESCREAM2 = aMgr.GetSoundThrow(ResourceId::SOUND_CRAZYDAVESCREAM2_ID);
+        SOUND_CRAZYDAVESHORT1 = aMgr.GetSoundThrow(ResourceId::SOUND_CRAZYDAVESHORT1_ID);
+        SOUND_CRAZYDAVESHORT2 = aMgr.GetSoundThrow(ResourceId::SOUND_CRAZYDAVESHORT2_ID);
+        SOUND_CRAZYDAVESHORT3 = aMgr.GetSoundThrow(ResourceId::SOUND_CRAZYDAVESHORT3_ID);
+        SOUND_DANCER = aMgr.GetSoundThrow(ResourceId::SOUND_DANCER_ID);
+        SOUND_DIAMOND = aMgr.GetSoundThrow(ResourceId::SOUND_DIAMOND_ID);
+        SOUND_DIGGER_ZOMBIE = aMgr.GetSoundThrow(ResourceId::SOUND_DIGGER_ZOMBIE_ID);
+        SOUND_DIRT_RISE = aMgr.GetSoundThrow(ResourceId::SOUND_DIRT_RISE_ID);
+        SOUND_DOLPHIN_APPEARS = aMgr.GetSoundThrow(ResourceId::SOUND_DOLPHIN_APPEARS_ID);
+        SOUND_DOLPHIN_BEFORE_JUMPING = aMgr.GetSoundThrow(ResourceId::SOUND_DOLPHIN_BEFORE_JUMPING_ID);
+        SOUND_DOOMSHROOM = aMgr.GetSoundThrow(ResourceId::SOUND_DOOMSHROOM_ID);
+        SOUND_EVILLAUGH = aMgr.GetSoundThrow(ResourceId::SOUND_EVILLAUGH_ID);
+        SOUND_EXPLOSION = aMgr.GetSoundThrow(ResourceId::SOUND_EXPLOSION_ID);
+        SOUND_FERTILIZER = aMgr.GetSoundThrow(ResourceId::SOUND_FERTILIZER_ID);
+        SOUND_FINALFANFARE = aMgr.GetSoundThrow(ResourceId::SOUND_FINALFANFARE_ID);
+        SOUND_FINALWAVE = aMgr.GetSoundThrow(ResourceId::SOUND_FINALWAVE_ID);
+        SOUND_FIREPEA = aMgr.GetSoundThrow(ResourceId::SOUND_FIREPEA_ID);
+        SOUND_FLOOP = aMgr.GetSoundThrow(ResourceId::SOUND_FLOOP_ID);
+        SOUND_FROZEN = aMgr.GetSoundThrow(ResourceId::SOUND_FROZEN_ID);
+        SOUND_FUME = aMgr.GetSoundThrow(ResourceId::SOUND_FUME_ID);
+        SOUND_GARGANTUAR_THUMP = aMgr.GetSoundThrow(ResourceId::SOUND_GARGANTUAR_THUMP_ID);
+        SOUND_GARGANTUDEATH = aMgr.GetSoundThrow(ResourceId::SOUND_GARGANTUDEATH_ID);
+        SOUND_GRASSSTEP = aMgr.GetSoundThrow(ResourceId::SOUND_GRASSSTEP_ID);
+        SOUND_GRAVEBUSTERCHOMP = aMgr.GetSoundThrow(ResourceId::SOUND_GRAVEBUSTERCHOMP_ID);
+        SOUND_GRAVEBUTTON = aMgr.GetSoundThrow(ResourceId::SOUND_GRAVEBUTTON_ID);
+        SOUND_GRAVESTONE_RUMBLE = aMgr.GetSoundThrow(ResourceId::SOUND_GRAVESTONE_RUMBLE_ID);
+        SOUND_GROAN = aMgr.GetSoundThrow(ResourceId::SOUND_GROAN_ID);
+        SOUND_GROAN2 = aMgr.GetSoundThrow(ResourceId::SOUND_GROAN2_ID);
+        SOUND_GROAN3 = aMgr.GetSoundThrow(ResourceId::SOUND_GROAN3_ID);
+        SOUND_GROAN4 = aMgr.GetSoundThrow(ResourceId::SOUND_GROAN4_ID);
+        SOUND_GROAN5 = aMgr.GetSoundThrow(ResourceId::SOUND_GROAN5_ID);
+        SOUND_GROAN6 = aMgr.GetSoundThrow(ResourceId::SOUND_GROAN6_ID);
+        SOUND_GULP = aMgr.GetSoundThrow(ResourceId::SOUND_GULP_ID);
+        SOUND_HATCHBACK_CLOSE = aMgr.GetSoundThrow(ResourceId::SOUND_HATCHBACK_CLOSE_ID);
+        SOUND_HATCHBACK_OPEN = aMgr.GetSoundThrow(ResourceId::SOUND_HATCHBACK_OPEN_ID);
+        SOUND_HUGE_WAVE = aMgr.GetSoundThrow(ResourceId::SOUND_HUGE_WAVE_ID);
+        SOUND_HYDRAULIC = aMgr.GetSoundThrow(ResourceId::SOUND_HYDRAULIC_ID);
+        SOUND_HYDRAULIC_SHORT = aMgr.GetSoundThrow(ResourceId::SOUND_HYDRAULIC_SHORT_ID);
+        SOUND_IGNITE = aMgr.GetSoundThrow(ResourceId::SOUND_IGNITE_ID);
+        SOUND_IGNITE2 = aMgr.GetSoundThrow(ResourceId::SOUND_IGNITE2_ID);
+        SOUND_IMP = aMgr.GetSoundThrow(ResourceId::SOUND_IMP_ID);
+        SOUND_IMP2 = aMgr.GetSoundThrow(ResourceId::SOUND_IMP2_ID);
+        SOUND_JACKINTHEBOX = aMgr.GetSoundThrow(ResourceId::SOUND_JACKINTHEBOX_ID);
+        SOUND_JACK_SURPRISE = aMgr.GetSoundThrow(ResourceId::SOUND_JACK_SURPRISE_ID);
+        SOUND_JACK_SURPRISE2 = aMgr.GetSoundThrow(ResourceId::SOUND_JACK_SURPRISE2_ID);
+        SOUND_JALAPENO = aMgr.GetSoundThrow(ResourceId::SOUND_JALAPENO_ID);
+        SOUND_JUICY = aMgr.GetSoundThrow(ResourceId::SOUND_JUICY_ID);
+        SOUND_KERNELPULT = aMgr.GetSoundThrow(ResourceId::SOUND_KERNELPULT_ID);
+        SOUND_KERNELPULT2 = aMgr.GetSoundThrow(ResourceId::SOUND_KERNELPULT2_ID);
+        SOUND_LADDER_ZOMBIE = aMgr.GetSoundThrow(ResourceId::SOUND_LADDER_ZOMBIE_ID);
+        SOUND_LAWNMOWER = aMgr.GetSoundThrow(ResourceId::SOUND_LAWNMOWER_ID);
+        SOUND_LIGHTFILL = aMgr.GetSoundThrow(ResourceId::SOUND_LIGHTFILL_ID);
+        SOUND_LIMBS_POP = aMgr.GetSoundThrow(ResourceId::SOUND_LIMBS_POP_ID);
+        SOUND_LOSEMUSIC = aMgr.GetSoundThrow(ResourceId::SOUND_LOSEMUSIC_ID);
+        SOUND_LOWGROAN = aMgr.GetSoundThrow(ResourceId::SOUND_LOWGROAN_ID);
+        SOUND_LOWGROAN2 = aMgr.GetSoundThrow(ResourceId::SOUND_LOWGROAN2_ID);
+        SOUND_MAGNETSHROOM = aMgr.GetSoundThrow(ResourceId::SOUND_MAGNETSHROOM_ID);
+        SOUND_MELONIMPACT = aMgr.GetSoundThrow(ResourceId::SOUND_MELONIMPACT_ID);
+        SOUND_MELONIMPACT2 = aMgr.GetSoundThrow(ResourceId::SOUND_MELONIMPACT2_ID);
+        SOUND_MINDCONTROLLED = aMgr.GetSoundThrow(ResourceId::SOUND_MINDCONTROLLED_ID);
+        SOUND_MONEYFALLS = aMgr.GetSoundThrow(ResourceId::SOUND_MONEYFALLS_ID);
+        SOUND_NEWSPAPER_RARRGH = aMgr.GetSoundThrow(ResourceId::SOUND_NEWSPAPER_RARRGH_ID);
+        SOUND_NEWSPAPER_RARRGH2 = aMgr.GetSoundThrow(ResourceId::SOUND_NEWSPAPER_RARRGH2_ID);
+        SOUND_NEWSPAPER_RIP = aMgr.GetSoundThrow(ResourceId::SOUND_NEWSPAPER_RIP_ID);
+        SOUND_PAPER = aMgr.GetSoundThrow(ResourceId::SOUND_PAPER_ID);
+        SOUND_PAUSE = aMgr.GetSoundThrow(ResourceId::SOUND_PAUSE_ID);
+        SOUND_PHONOGRAPH = aMgr.GetSoundThrow(ResourceId::SOUND_PHONOGRAPH_ID);
+        SOUND_PLANT = aMgr.GetSoundThrow(ResourceId::SOUND_PLANT_ID);
+        SOUND_PLANT2 = aMgr.GetSoundThrow(ResourceId::SOUND_PLANT2_ID);
+        SOUND_PLANTERN = aMgr.GetSoundThrow(ResourceId::SOUND_PLANTERN_ID);
+        SOUND_PLANTGROW = aMgr.GetSoundThrow(ResourceId::SOUND_PLANTGROW_ID);
+        SOUND_PLANT_WATER = aMgr.GetSoundThrow(ResourceId::SOUND_PLANT_WATER_ID);
+        SOUND_PLASTICHIT = aMgr.GetSoundThrow(ResourceId::SOUND_PLASTICHIT_ID);
+        SOUND_PLASTICHIT2 = aMgr.GetSoundThrow(ResourceId::SOUND_PLASTICHIT2_ID);
+        SOUND_POGO_ZOMBIE = aMgr.GetSoundThrow(ResourceId::SOUND_POGO_ZOMBIE_ID);
+        SOUND_POINTS = aMgr.GetSoundThrow(ResourceId::SOUND_POINTS_ID);
+        SOUND_POLEVAULT = aMgr.GetSoundThrow(ResourceId::SOUND_POLEVAULT_ID);
+        SOUND_POOL_CLEANER = aMgr.GetSoundThrow(ResourceId::SOUND_POOL_CLEANER_ID);
+        SOUND_PORTAL = aMgr.GetSoundThrow(ResourceId::SOUND_PORTAL_ID);
+        SOUND_POTATO_MINE = aMgr.GetSoundThrow(ResourceId::SOUND_POTATO_MINE_ID);
+        SOUND_PRIZE = aMgr.GetSoundThrow(ResourceId::SOUND_PRIZE_ID);
+        SOUND_PUFF = aMgr.GetSoundThrow(ResourceId::SOUND_PUFF_ID);
+        SOUND_RAIN = aMgr.GetSoundThrow(ResourceId::SOUND_RAIN_ID);
+        SOUND_READYSETPLANT = aMgr.GetSoundThrow(ResourceId::SOUND_READYSETPLANT_ID);
+        SOUND_REVERSE_EXPLOSION = aMgr.GetSoundThrow(ResourceId::SOUND_REVERSE_EXPLOSION_ID);
+        SOUND_ROLL_IN = aMgr.GetSoundThrow(ResourceId::SOUND_ROLL_IN_ID);
+        SOUND_RVTHROW = aMgr.GetSoundThrow(ResourceId::SOUND_RVTHROW_ID);
+        SOUND_SCREAM = aMgr.GetSoundThrow(ResourceId::SOUND_SCREAM_ID);
+        SOUND_SEEDLIFT = aMgr.GetSoundThrow(ResourceId::SOUND_SEEDLIFT_ID);
+        SOUND_SHIELDHIT = aMgr.GetSoundThrow(ResourceId::SOUND_SHIELDHIT_ID);
+        SOUND_SHIELDHIT2 = aMgr.GetSoundThrow(ResourceId::SOUND_SHIELDHIT2_ID);
+        SOUND_SHOOP = aMgr.GetSoundThrow(ResourceId::SOUND_SHOOP_ID);
+        SOUND_SHOVEL = aMgr.GetSoundThrow(ResourceId::SOUND_SHOVEL_ID);
+        SOUND_SIREN = aMgr.GetSoundThrow(ResourceId::SOUND_SIREN_ID);
+        SOUND_SLOT_MACHINE = aMgr.GetSoundThrow(ResourceId::SOUND_SLOT_MACHINE_ID);
+        SOUND_SLURP = aMgr.GetSoundThrow(ResourceId::SOUND_SLURP_ID);
+        SOUND_SNOW_PEA_SPARKLES = aMgr.GetSoundThrow(ResourceId::SOUND_SNOW_PEA_SPARKLES_ID);
+        SOUND_SPLAT = aMgr.GetSoundThrow(ResourceId::SOUND_SPLAT_ID);
+        SOUND_SPLAT2 = aMgr.GetSoundThrow(ResourceId::SOUND_SPLAT2_ID);
+        SOUND_SPLAT3 = aMgr.GetSoundThrow(ResourceId::SOUND_SPLAT3_ID);
+        SOUND_SQUASH_HMM = aMgr.GetSoundThrow(ResourceId::SOUND_SQUASH_HMM_ID);
+        SOUND_SQUASH_HMM2 = aMgr.GetSoundThrow(ResourceId::SOUND_SQUASH_HMM2_ID);
+        SOUND_SUKHBIR = aMgr.GetSoundThrow(ResourceId::SOUND_SUKHBIR_ID);
+        SOUND_SUKHBIR2 = aMgr.GetSoundThrow(ResourceId::SOUND_SUKHBIR2_ID);
+        SOUND_SUKHBIR3 = aMgr.GetSoundThrow(ResourceId::SOUND_SUKHBIR3_ID);
+        SOUND_SUKHBIR4 = aMgr.GetSoundThrow(ResourceId::SOUND_SUKHBIR4_ID);
+        SOUND_SUKHBIR5 = aMgr.GetSoundThrow(ResourceId::SOUND_SUKHBIR5_ID);
+        SOUND_SUKHBIR6 = aMgr.GetSoundThrow(ResourceId::SOUND_SUKHBIR6_ID);
+        SOUND_SWING = aMgr.GetSoundThrow(ResourceId::SOUND_SWING_ID);
+        SOUND_TAP = aMgr.GetSoundThrow(ResourceId::SOUND_TAP_ID);
+        SOUND_TAP2 = aMgr.GetSoundThrow(ResourceId::SOUND_TAP2_ID);
+        SOUND_TAPGLASS = aMgr.GetSoundThrow(ResourceId::SOUND_TAPGLASS_ID);
+        SOUND_THROW = aMgr.GetSoundThrow(ResourceId::SOUND_THROW_ID);
+        SOUND_THROW2 = aMgr.GetSoundThrow(ResourceId::SOUND_THROW2_ID);
+        SOUND_THUNDER = aMgr.GetSoundThrow(ResourceId::SOUND_THUNDER_ID);
+        SOUND_VASE_BREAKING = aMgr.GetSoundThrow(ResourceId::SOUND_VASE_BREAKING_ID);
+        SOUND_WAKEUP = aMgr.GetSoundThrow(ResourceId::SOUND_WAKEUP_ID);
+        SOUND_WATERING = aMgr.GetSoundThrow(ResourceId::SOUND_WATERING_ID);
+        SOUND_WINMUSIC = aMgr.GetSoundThrow(ResourceId::SOUND_WINMUSIC_ID);
+        SOUND_YUCK = aMgr.GetSoundThrow(ResourceId::SOUND_YUCK_ID);
+        SOUND_YUCK2 = aMgr.GetSoundThrow(ResourceId::SOUND_YUCK2_ID);
+        SOUND_ZAMBONI = aMgr.GetSoundThrow(ResourceId::SOUND_ZAMBONI_ID);
+        SOUND_ZOMBAQUARIUM_DIE = aMgr.GetSoundThrow(ResourceId::SOUND_ZOMBAQUARIUM_DIE_ID);
+        SOUND_ZOMBIESPLASH = aMgr.GetSoundThrow(ResourceId::SOUND_ZOMBIESPLASH_ID);
+        SOUND_ZOMBIE_ENTERING_WATER = aMgr.GetSoundThrow(ResourceId::SOUND_ZOMBIE_ENTERING_WATER_ID);
+        SOUND_ZOMBIE_FALLING_1 = aMgr.GetSoundThrow(ResourceId::SOUND_ZOMBIE_FALLING_1_ID);
+        SOUND_ZOMBIE_FALLING_2 = aMgr.GetSoundThrow(ResourceId::SOUND_ZOMBIE_FALLING_2_ID);
     } catch (ResourceManagerException &) {
         return false;
     }
@@ -2519,6 +2600,263 @@ void *gResources[static_cast<int>(Sexy::ResourceId::RESOURCE_ID_MAX)] = {
     &Sexy::IMAGE_ZOMBATAR_VIEW_BUTTON_HIGHLIGHT
 };
 
+const char *const gResourceStringIds[static_cast<int>(Sexy::ResourceId::RESOURCE_ID_MAX)] = {
+    "IMAGE_BLANK", "IMAGE_POPCAP_LOGO", "IMAGE_PARTNER_LOGO", "IMAGE_TITLESCREEN", "IMAGE_LOADBAR_DIRT",
+    "IMAGE_LOADBAR_GRASS", "IMAGE_PVZ_LOGO", "IMAGE_REANIM_SODROLLCAP", "FONT_BRIANNETOD16", "SOUND_BUTTONCLICK",
+    "SOUND_LOADINGBAR_FLOWER", "SOUND_LOADINGBAR_ZOMBIE", "FONT_IMAGE_HOUSEOFTERROR28", "FONT_HOUSEOFTERROR28",
+    "FONT_HOUSEOFTERROR20", "FONT_HOUSEOFTERROR16", "FONT_TINYBOLD", "FONT_CONTINUUMBOLD14",
+    "FONT_CONTINUUMBOLD14OUTLINE", "FONT_DWARVENTODCRAFT12", "FONT_DWARVENTODCRAFT15", "FONT_DWARVENTODCRAFT18",
+    "FONT_DWARVENTODCRAFT18BRIGHTGREENINSET", "FONT_DWARVENTODCRAFT18GREENINSET", "FONT_DWARVENTODCRAFT18YELLOW",
+    "FONT_DWARVENTODCRAFT24", "FONT_DWARVENTODCRAFT36BRIGHTGREENINSET", "FONT_DWARVENTODCRAFT36GREENINSET",
+    "FONT_PICO129", "FONT_BRIANNETOD12", "IMAGE_EDITBOX", "IMAGE_DIALOG_TOPLEFT", "IMAGE_DIALOG_TOPMIDDLE",
+    "IMAGE_DIALOG_TOPRIGHT", "IMAGE_DIALOG_CENTERLEFT", "IMAGE_DIALOG_CENTERMIDDLE", "IMAGE_DIALOG_CENTERRIGHT",
+    "IMAGE_DIALOG_BOTTOMLEFT", "IMAGE_DIALOG_BOTTOMMIDDLE", "IMAGE_DIALOG_BOTTOMRIGHT", "IMAGE_DIALOG_BIGBOTTOMLEFT",
+    "IMAGE_DIALOG_BIGBOTTOMMIDDLE", "IMAGE_DIALOG_BIGBOTTOMRIGHT", "IMAGE_DIALOG_HEADER", "IMAGE_BUTTON_LEFT",
+    "IMAGE_BUTTON_MIDDLE", "IMAGE_BUTTON_RIGHT", "IMAGE_BUTTON_DOWN_LEFT", "IMAGE_BUTTON_DOWN_MIDDLE",
+    "IMAGE_BUTTON_DOWN_RIGHT", "IMAGE_SEEDCHOOSER_BACKGROUND", "IMAGE_SEEDCHOOSER_BUTTON",
+    "IMAGE_SEEDCHOOSER_BUTTON_DISABLED", "IMAGE_SEEDCHOOSER_BUTTON_GLOW", "IMAGE_SEEDCHOOSER_BUTTON2",
+    "IMAGE_SEEDCHOOSER_BUTTON2_GLOW", "IMAGE_SEEDCHOOSER_IMITATERADDON", "IMAGE_SEEDS", "IMAGE_SEEDPACKET_LARGER",
+    "IMAGE_SEEDPACKETSILHOUETTE", "IMAGE_FLAGMETER", "IMAGE_FLAGMETERLEVELPROGRESS", "IMAGE_FLAGMETERPARTS",
+    "IMAGE_TROPHY", "IMAGE_TROPHY_HI_RES", "IMAGE_MINIGAME_TROPHY", "IMAGE_ZOMBIE_NOTE_SMALL", "IMAGE_TACO",
+    "IMAGE_CARKEYS", "IMAGE_ALMANAC", "IMAGE_ICON_POOLCLEANER", "IMAGE_ICON_ROOFCLEANER", "IMAGE_ICON_RAKE",
+    "IMAGE_BRAIN", "IMAGE_MONEYBAG", "IMAGE_MONEYBAG_HI_RES", "IMAGE_CHOCOLATE", "IMAGE_OPTIONS_BACKTOGAMEBUTTON0",
+    "IMAGE_OPTIONS_BACKTOGAMEBUTTON2", "IMAGE_OPTIONS_CHECKBOX0", "IMAGE_OPTIONS_CHECKBOX1", "IMAGE_OPTIONS_MENUBACK",
+    "IMAGE_OPTIONS_SLIDERKNOB2", "IMAGE_OPTIONS_SLIDERSLOT", "IMAGE_SELECTORSCREEN_HELP1", "IMAGE_SELECTORSCREEN_HELP2",
+    "IMAGE_SELECTORSCREEN_OPTIONS1", "IMAGE_SELECTORSCREEN_OPTIONS2", "IMAGE_SELECTORSCREEN_QUIT1",
+    "IMAGE_SELECTORSCREEN_QUIT2", "IMAGE_SELECTORSCREEN_ALMANAC", "IMAGE_SELECTORSCREEN_ALMANACHIGHLIGHT",
+    "IMAGE_SELECTORSCREEN_STORE", "IMAGE_SELECTORSCREEN_STOREHIGHLIGHT", "IMAGE_SELECTORSCREEN_LEVELNUMBERS",
+    "IMAGE_SELECTORSCREEN_ZENGARDEN", "IMAGE_SELECTORSCREEN_ZENGARDENHIGHLIGHT", "IMAGE_STORE_SPEECHBUBBLE",
+    "IMAGE_STORE_SPEECHBUBBLE2", "IMAGE_SELECTORSCREEN_ACHIEVEMENTS_BG", "IMAGE_SELECTORSCREEN_MOREWAYSTOPLAY_BG",
+    "IMAGE_SELECTORSCREEN_ACHIEVEMENTS_PEDESTAL", "IMAGE_SELECTORSCREEN_ACHIEVEMENTS_PEDESTAL_PRESS",
+    "IMAGE_ACHEESEMENTS_BEJEWELED", "IMAGE_ACHEESEMENTS_BOOKWORM", "IMAGE_ACHEESEMENTS_CHINA",
+    "IMAGE_ACHEESEMENTS_CHUZZLE", "IMAGE_ACHEESEMENTS_HOLE_TILE", "IMAGE_ACHEESEMENTS_PEGGLE",
+    "IMAGE_ACHEESEMENTS_PIPE", "IMAGE_ACHEESEMENTS_ZUMA", "IMAGE_ACHEESEMENTS_ICONS",
+    "IMAGE_ACHEESEMENTS_BACK_HIGHLIGHT", "IMAGE_QUICKPLAY_MINIGAMES_BUTTON",
+    "IMAGE_QUICKPLAY_MINIGAMES_BUTTON_HIGHLIGHT", "IMAGE_QUICKPLAY_MINIGAMES_CLOUD", "IMAGE_QUICKPLAY_PUZZLES_BUTTON",
+    "IMAGE_QUICKPLAY_PUZZLES_BUTTON_HIGHLIGHT", "IMAGE_QUICKPLAY_PUZZLES_CLOUD", "IMAGE_QUICKPLAY_SURVIVAL_BUTTON",
+    "IMAGE_QUICKPLAY_SURVIVAL_BUTTON_HIGHLIGHT", "IMAGE_QUICKPLAY_SURVIVAL_CLOUD", "IMAGE_QUICKPLAY_BACK_BUTTON",
+    "IMAGE_QUICKPLAY_BACK_BUTTON_HIGHLIGHT", "IMAGE_ACHEESEMENTS_MORE_ROCK", "IMAGE_ACHEESEMENTS_MORE_BUTTON",
+    "IMAGE_ACHEESEMENTS_MORE_BUTTON_HIGHLIGHT", "IMAGE_ACHEESEMENTS_TOP_BUTTON",
+    "IMAGE_ACHEESEMENTS_TOP_BUTTON_HIGHLIGHT", "IMAGE_SHOVEL", "IMAGE_SHOVEL_HI_RES", "IMAGE_TOMBSTONES",
+    "IMAGE_TOMBSTONE_MOUNDS", "IMAGE_NIGHT_GRAVE_GRAPHIC", "IMAGE_CRATER", "IMAGE_CRATER_FADING",
+    "IMAGE_CRATER_ROOF_CENTER", "IMAGE_CRATER_ROOF_LEFT", "IMAGE_CRATER_WATER_DAY", "IMAGE_CRATER_WATER_NIGHT",
+    "IMAGE_COBCANNON_TARGET", "IMAGE_COBCANNON_POPCORN", "IMAGE_FERTILIZER", "IMAGE_WATERINGCAN",
+    "IMAGE_WATERINGCANGOLD", "IMAGE_PHONOGRAPH", "IMAGE_BEGHOULED_TWIST_OVERLAY", "IMAGE_ZEN_GOLDTOOLRETICLE",
+    "IMAGE_ZEN_GARDENGLOVE", "IMAGE_ZEN_MONEYSIGN", "IMAGE_ZEN_NEXTGARDEN", "IMAGE_ZEN_WHEELBARROW",
+    "IMAGE_ZENSHOPBUTTON", "IMAGE_ZENSHOPBUTTON_HIGHLIGHT", "IMAGE_PRESENT", "IMAGE_PRESENTOPEN",
+    "IMAGE_SUNFLOWER_TROPHY", "IMAGE_SLOTMACHINE_OVERLAY", "IMAGE_SCARY_POT", "IMAGE_BUG_SPRAY",
+    "IMAGE_PLANTSPEECHBUBBLE", "IMAGE_WATERDROP", "IMAGE_TREEFOOD", "IMAGE_PACKET_PLANTS", "IMAGE_ZEN_NEED_ICONS",
+    "IMAGE_PROJECTILEPEA", "IMAGE_PROJECTILESNOWPEA", "IMAGE_PROJECTILECACTUS", "IMAGE_DIRTSMALL", "IMAGE_DIRTBIG",
+    "IMAGE_ROCKSMALL", "IMAGE_WATERPARTICLE", "IMAGE_WHITEWATER", "IMAGE_WHITEWATER_SHADOW",
+    "IMAGE_MELONPULT_PARTICLES", "IMAGE_WINTERMELON_PARTICLES", "IMAGE_PROJECTILE_STAR", "IMAGE_SEEDBANK",
+    "IMAGE_CONVEYORBELT_BACKDROP", "IMAGE_CONVEYORBELT", "IMAGE_SHOVELBANK", "IMAGE_SUNBANK", "IMAGE_COINBANK",
+    "IMAGE_POOL", "IMAGE_POOL_NIGHT", "IMAGE_POOL_BASE", "IMAGE_POOL_BASE_NIGHT", "IMAGE_POOL_SHADING",
+    "IMAGE_POOL_SHADING_NIGHT", "IMAGE_PLANTSHADOW", "IMAGE_PLANTSHADOW2", "IMAGE_PEA_SHADOWS",
+    "IMAGE_WALLNUT_BOWLINGSTRIPE", "IMAGE_ICE", "IMAGE_ICE_CAP", "IMAGE_ICE_SPARKLES", "IMAGE_IMITATERSEED",
+    "IMAGE_ALMANAC_IMITATER", "IMAGE_IMITATERSEEDDISABLED", "IMAGE_ICETRAP", "IMAGE_ICETRAP2",
+    "IMAGE_ICETRAP_PARTICLES", "IMAGE_ZOMBIE_BOBSLED1", "IMAGE_ZOMBIE_BOBSLED2", "IMAGE_ZOMBIE_BOBSLED3",
+    "IMAGE_ZOMBIE_BOBSLED4", "IMAGE_ZOMBIE_BOBSLED_INSIDE", "IMAGE_BUNGEECORD", "IMAGE_BUNGEETARGET", "IMAGE_SPOTLIGHT",
+    "IMAGE_SPOTLIGHT2", "IMAGE_WHITEPIXEL", "IMAGE_ZOMBIEPOLEVAULTERHEAD", "IMAGE_ZOMBIEFOOTBALLHEAD",
+    "IMAGE_POOLSPARKLY", "IMAGE_WALLNUTPARTICLESSMALL", "IMAGE_WALLNUTPARTICLESLARGE", "IMAGE_PEA_SPLATS",
+    "IMAGE_STAR_PARTICLES", "IMAGE_STAR_SPLATS", "IMAGE_PEA_PARTICLES", "IMAGE_SNOWPEA_SPLATS",
+    "IMAGE_SNOWPEA_PARTICLES", "IMAGE_SNOWPEA_PUFF", "IMAGE_SNOWFLAKES", "IMAGE_POTATOMINE_PARTICLES",
+    "IMAGE_PUFFSHROOM_PUFF1", "IMAGE_ZAMBONISMOKE", "IMAGE_ZOMBIEDANCERHEAD", "IMAGE_ZOMBIEBALLOONHEAD",
+    "IMAGE_ZOMBIEIMPHEAD", "IMAGE_ZOMBIEDIGGERHEAD", "IMAGE_ZOMBIEDIGGERARM", "IMAGE_ZOMBIEDOLPHINRIDERHEAD",
+    "IMAGE_ZOMBIEPOGO", "IMAGE_ZOMBIEBACKUPDANCERHEAD", "IMAGE_ZOMBIEBOBSLEDHEAD", "IMAGE_ZOMBIELADDERHEAD",
+    "IMAGE_ZOMBIEYETIHEAD", "IMAGE_SEEDPACKETFLASH", "IMAGE_ZOMBIEJACKBOXARM", "IMAGE_IMITATERCLOUDS",
+    "IMAGE_IMITATERPUFFS", "IMAGE_ZOMBIE_BOSS_FIREBALL_PARTICLES", "IMAGE_ZOMBIE_BOSS_ICEBALL_PARTICLES",
+    "IMAGE_ZOMBIE_BOSS_FIREBALL_GROUNDPARTICLES", "IMAGE_ZOMBIE_BOSS_ICEBALL_GROUNDPARTICLES",
+    "IMAGE_DOOMSHROOM_EXPLOSION_BASE", "IMAGE_RAIN", "IMAGE_VASE_CHUNKS", "IMAGE_ZOMBOSS_PARTICLES",
+    "IMAGE_AWARDPICKUPGLOW", "IMAGE_ZOMBIE_SEAWEED", "IMAGE_PINATA", "IMAGE_ZOMBIEFUTUREGLASSES", "IMAGE_DUST_PUFFS",
+    "IMAGE_REANIM_WALLNUT_BODY", "IMAGE_REANIM_WALLNUT_CRACKED1", "IMAGE_REANIM_WALLNUT_CRACKED2",
+    "IMAGE_REANIM_TALLNUT_CRACKED1", "IMAGE_REANIM_TALLNUT_CRACKED2", "IMAGE_REANIM_PUMPKIN_DAMAGE1",
+    "IMAGE_REANIM_PUMPKIN_DAMAGE3", "IMAGE_REANIM_ZOMBIE_CONE1", "IMAGE_REANIM_ZOMBIE_CONE2",
+    "IMAGE_REANIM_ZOMBIE_CONE3", "IMAGE_REANIM_ZOMBIE_BUCKET1", "IMAGE_REANIM_ZOMBIE_BUCKET2",
+    "IMAGE_REANIM_ZOMBIE_BUCKET3", "IMAGE_REANIM_ZOMBIE_DIGGER_HARDHAT", "IMAGE_REANIM_ZOMBIE_DIGGER_HARDHAT2",
+    "IMAGE_REANIM_ZOMBIE_DIGGER_HARDHAT3", "IMAGE_REANIM_ZOMBIE_SCREENDOOR1", "IMAGE_REANIM_ZOMBIE_SCREENDOOR2",
+    "IMAGE_REANIM_ZOMBIE_SCREENDOOR3", "IMAGE_REANIM_ZOMBIE_FLAG1", "IMAGE_REANIM_ZOMBIE_FLAG3",
+    "IMAGE_REANIM_ZOMBIE_OUTERARM_UPPER2", "IMAGE_REANIM_ZOMBIE_FOOTBALL_HELMET",
+    "IMAGE_REANIM_ZOMBIE_FOOTBALL_HELMET2", "IMAGE_REANIM_ZOMBIE_FOOTBALL_HELMET3",
+    "IMAGE_REANIM_ZOMBIE_FOOTBALL_LEFTARM_HAND", "IMAGE_REANIM_ZOMBIE_FOOTBALL_LEFTARM_UPPER2",
+    "IMAGE_REANIM_ZOMBIE_PAPER_LEFTARM_UPPER2", "IMAGE_REANIM_ZOMBIE_PAPER_LEFTARM_LOWER",
+    "IMAGE_REANIM_ZOMBIE_PAPER_PAPER2", "IMAGE_REANIM_ZOMBIE_PAPER_PAPER3", "IMAGE_REANIM_ZOMBIE_PAPER_MADHEAD",
+    "IMAGE_REANIM_ZOMBIE_ZAMBONI_1_DAMAGE1", "IMAGE_REANIM_ZOMBIE_ZAMBONI_1_DAMAGE2",
+    "IMAGE_REANIM_ZOMBIE_ZAMBONI_2_DAMAGE1", "IMAGE_REANIM_ZOMBIE_ZAMBONI_2_DAMAGE2",
+    "IMAGE_REANIM_ZOMBIE_ZAMBONI_WHEEL_FLAT", "IMAGE_REANIM_COIN_SILVER_DOLLAR", "IMAGE_REANIM_COIN_GOLD_DOLLAR",
+    "IMAGE_REANIM_DIAMOND", "IMAGE_REANIM_COINGLOW", "IMAGE_REANIM_ZOMBIE_DISCO_OUTERARM_HAND",
+    "IMAGE_REANIM_ZOMBIE_DISCO_OUTERARM_UPPER2", "IMAGE_REANIM_ZOMBIE_BACKUP_INNERARM_HAND",
+    "IMAGE_REANIM_ZOMBIE_BACKUP_OUTERARM_UPPER2", "IMAGE_REANIM_ZOMBIE_POLEVAULTER_OUTERARM_UPPER2",
+    "IMAGE_REANIM_ZOMBIE_OUTERARM_HAND", "IMAGE_REANIM_ZOMBIE_BALLOON_OUTERARM_UPPER2",
+    "IMAGE_REANIM_ZOMBIE_IMP_ARM1_BONE", "IMAGE_REANIM_ZOMBIE_IMP_ARM2", "IMAGE_REANIM_ZOMBIE_GARGANTUAR_BODY1_2",
+    "IMAGE_REANIM_ZOMBIE_GARGANTUAR_BODY1_3", "IMAGE_REANIM_ZOMBIE_GARGANTUAR_DUCKXING",
+    "IMAGE_REANIM_ZOMBIE_GARGANTUAR_ZOMBIE", "IMAGE_REANIM_ZOMBIE_GARGANTUAR_FOOT2",
+    "IMAGE_REANIM_ZOMBIE_GARGANTUAR_HEAD2", "IMAGE_REANIM_ZOMBIE_GARGANTUAR_OUTERARM_LOWER2",
+    "IMAGE_REANIM_ZOMBIE_GARGANTUAR_HEAD2_REDEYE", "IMAGE_REANIM_ZOMBIE_GARGANTUAR_HEAD_REDEYE",
+    "IMAGE_REANIM_ZOMBIE_DIGGER_OUTERARM_UPPER2", "IMAGE_REANIM_ZOMBIE_DOLPHINRIDER_OUTERARM_UPPER2",
+    "IMAGE_REANIM_ZOMBIE_POGO_OUTERARM_UPPER2", "IMAGE_REANIM_ZOMBIE_POGO_STICKDAMAGE1",
+    "IMAGE_REANIM_ZOMBIE_POGO_STICKDAMAGE2", "IMAGE_REANIM_ZOMBIE_POGO_STICK2DAMAGE1",
+    "IMAGE_REANIM_ZOMBIE_POGO_STICK2DAMAGE2", "IMAGE_REANIM_ZOMBIE_POGO_STICKHANDS2",
+    "IMAGE_REANIM_ZOMBIE_BOBSLED_OUTERARM_UPPER2", "IMAGE_REANIM_ZOMBIE_BOBSLED_OUTERARM_HAND",
+    "IMAGE_REANIM_ZOMBIE_JACKBOX_BOX", "IMAGE_REANIM_ZOMBIE_JACKBOX_OUTERARM_LOWER2",
+    "IMAGE_REANIM_ZOMBIE_SNORKLE_OUTERARM_UPPER2", "IMAGE_REANIM_ZOMBIE_BUNGI_HEAD_SCARED",
+    "IMAGE_REANIM_ZOMBIE_CATAPULT_BASKETBALL", "IMAGE_REANIM_ZOMBIE_CATAPULT_POLE",
+    "IMAGE_REANIM_ZOMBIE_CATAPULT_POLE_DAMAGE", "IMAGE_REANIM_ZOMBIE_CATAPULT_POLE_WITHBALL",
+    "IMAGE_REANIM_ZOMBIE_CATAPULT_POLE_DAMAGE_WITHBALL", "IMAGE_REANIM_ZOMBIE_CATAPULT_SIDING_DAMAGE",
+    "IMAGE_REANIM_ZOMBIE_LADDER_1", "IMAGE_REANIM_ZOMBIE_LADDER_1_DAMAGE1", "IMAGE_REANIM_ZOMBIE_LADDER_1_DAMAGE2",
+    "IMAGE_REANIM_ZOMBIE_LADDER_5", "IMAGE_REANIM_ZOMBIE_LADDER_OUTERARM_UPPER2", "IMAGE_REANIM_ZOMBIE_BOSS_ICEBALL",
+    "IMAGE_REANIM_ZOMBIE_BOSS_HEAD_DAMAGE1", "IMAGE_REANIM_ZOMBIE_BOSS_HEAD_DAMAGE2",
+    "IMAGE_REANIM_ZOMBIE_BOSS_JAW_DAMAGE1", "IMAGE_REANIM_ZOMBIE_BOSS_JAW_DAMAGE2",
+    "IMAGE_REANIM_ZOMBIE_BOSS_OUTERARM_HAND_DAMAGE1", "IMAGE_REANIM_ZOMBIE_BOSS_OUTERARM_HAND_DAMAGE2",
+    "IMAGE_REANIM_ZOMBIE_BOSS_OUTERARM_THUMB_DAMAGE1", "IMAGE_REANIM_ZOMBIE_BOSS_OUTERARM_THUMB_DAMAGE2",
+    "IMAGE_REANIM_ZOMBIE_BOSS_FOOT_DAMAGE1", "IMAGE_REANIM_ZOMBIE_BOSS_FOOT_DAMAGE2",
+    "IMAGE_REANIM_ZOMBIE_BOSS_EYEGLOW_BLUE", "IMAGE_REANIM_ZOMBIE_BOSS_MOUTHGLOW_BLUE",
+    "IMAGE_REANIM_CABBAGEPULT_CABBAGE", "IMAGE_REANIM_CORNPULT_KERNAL", "IMAGE_REANIM_CORNPULT_BUTTER",
+    "IMAGE_REANIM_CORNPULT_BUTTER_SPLAT", "IMAGE_REANIM_MELONPULT_MELON", "IMAGE_REANIM_WINTERMELON_PROJECTILE",
+    "IMAGE_REANIM_ZOMBIE_DIGGER_PICKAXE", "IMAGE_REANIM_ZOMBIE_HEAD_GROSSOUT", "IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES1",
+    "IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES2", "IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES3",
+    "IMAGE_REANIM_ZOMBIE_HEAD_SUNGLASSES4", "IMAGE_REANIM_GARLIC_BODY2", "IMAGE_REANIM_GARLIC_BODY3",
+    "IMAGE_REANIM_COBCANNON_COB", "IMAGE_REANIM_ZOMBIE_YETI_OUTERARM_UPPER2", "IMAGE_REANIM_ZOMBIE_YETI_OUTERARM_HAND",
+    "IMAGE_REANIM_ZOMBIE_SNORKLE_HEAD", "IMAGE_REANIM_SELECTORSCREEN_ADVENTURE_BUTTON",
+    "IMAGE_REANIM_SELECTORSCREEN_ADVENTURE_HIGHLIGHT", "IMAGE_REANIM_SELECTORSCREEN_STARTADVENTURE_BUTTON",
+    "IMAGE_REANIM_SELECTORSCREEN_STARTADVENTURE_HIGHLIGHT", "IMAGE_REANIM_SELECTORSCREEN_SURVIVAL_BUTTON",
+    "IMAGE_REANIM_SELECTORSCREEN_SURVIVAL_HIGHLIGHT", "IMAGE_REANIM_SELECTORSCREEN_CHALLENGES_BUTTON",
+    "IMAGE_REANIM_SELECTORSCREEN_CHALLENGES_HIGHLIGHT", "IMAGE_REANIM_SELECTORSCREEN_VASEBREAKER_BUTTON",
+    "IMAGE_REANIM_SELECTORSCREEN_VASEBREAKER_HIGHLIGHT", "IMAGE_REANIM_SELECTORSCREEN_WOODSIGN2_PRESS",
+    "IMAGE_REANIM_SELECTORSCREEN_WOODSIGN3_PRESS", "IMAGE_REANIM_SELECTORSCREEN_BG",
+    "IMAGE_REANIM_SELECTORSCREEN_ALMANAC_SHADOW", "IMAGE_REANIM_SELECTORSCREEN_KEY_SHADOW", "IMAGE_REANIM_TREE_BG",
+    "IMAGE_REANIM_POT_TOP_DARK", "IMAGE_REANIM_ZENGARDEN_BUGSPRAY_BOTTLE", "IMAGE_REANIM_STINKY_TURN3",
+    "IMAGE_REANIM_CRAZYDAVE_MOUTH1", "IMAGE_REANIM_CRAZYDAVE_MOUTH4", "IMAGE_REANIM_CRAZYDAVE_MOUTH5",
+    "IMAGE_REANIM_CRAZYDAVE_MOUTH6", "IMAGE_REANIM_ZOMBIE_MUSTACHE2", "IMAGE_REANIM_ZOMBIE_MUSTACHE3",
+    "SOUND_ACHIEVEMENT", "SOUND_AWOOGA", "SOUND_BLEEP", "SOUND_BUZZER", "SOUND_CHOMP", "SOUND_CHOMP2",
+    "SOUND_CHOMPSOFT", "SOUND_EVILLAUGH", "SOUND_FLOOP", "SOUND_FROZEN", "SOUND_GULP", "SOUND_GROAN", "SOUND_GROAN2",
+    "SOUND_GROAN3", "SOUND_GROAN4", "SOUND_GROAN5", "SOUND_GROAN6", "SOUND_LOSEMUSIC", "SOUND_MINDCONTROLLED",
+    "SOUND_PAUSE", "SOUND_PLANT", "SOUND_PLANT2", "SOUND_POINTS", "SOUND_SEEDLIFT", "SOUND_SIREN", "SOUND_SLURP",
+    "SOUND_SPLAT", "SOUND_SPLAT2", "SOUND_SPLAT3", "SOUND_SUKHBIR", "SOUND_SUKHBIR2", "SOUND_SUKHBIR3",
+    "SOUND_SUKHBIR4", "SOUND_SUKHBIR5", "SOUND_SUKHBIR6", "SOUND_TAP", "SOUND_TAP2", "SOUND_THROW", "SOUND_THROW2",
+    "SOUND_BLOVER", "SOUND_WINMUSIC", "SOUND_LAWNMOWER", "SOUND_BOING", "SOUND_JACKINTHEBOX", "SOUND_DIAMOND",
+    "SOUND_DOLPHIN_APPEARS", "SOUND_DOLPHIN_BEFORE_JUMPING", "SOUND_POTATO_MINE", "SOUND_ZAMBONI", "SOUND_BALLOON_POP",
+    "SOUND_THUNDER", "SOUND_ZOMBIESPLASH", "SOUND_BOWLING", "SOUND_BOWLINGIMPACT", "SOUND_BOWLINGIMPACT2",
+    "SOUND_GRAVEBUSTERCHOMP", "SOUND_GRAVEBUTTON", "SOUND_LIMBS_POP", "SOUND_PLANTERN", "SOUND_POGO_ZOMBIE",
+    "SOUND_SNOW_PEA_SPARKLES", "SOUND_PLANT_WATER", "SOUND_ZOMBIE_ENTERING_WATER", "SOUND_ZOMBIE_FALLING_1",
+    "SOUND_ZOMBIE_FALLING_2", "SOUND_PUFF", "SOUND_FUME", "SOUND_HUGE_WAVE", "SOUND_SLOT_MACHINE", "SOUND_COIN",
+    "SOUND_ROLL_IN", "SOUND_DIGGER_ZOMBIE", "SOUND_HATCHBACK_CLOSE", "SOUND_HATCHBACK_OPEN", "SOUND_KERNELPULT",
+    "SOUND_KERNELPULT2", "SOUND_ZOMBAQUARIUM_DIE", "SOUND_BUNGEE_SCREAM", "SOUND_BUNGEE_SCREAM2",
+    "SOUND_BUNGEE_SCREAM3", "SOUND_BUTTER", "SOUND_JACK_SURPRISE", "SOUND_JACK_SURPRISE2", "SOUND_NEWSPAPER_RARRGH",
+    "SOUND_NEWSPAPER_RARRGH2", "SOUND_NEWSPAPER_RIP", "SOUND_SQUASH_HMM", "SOUND_SQUASH_HMM2", "SOUND_VASE_BREAKING",
+    "SOUND_POOL_CLEANER", "SOUND_MAGNETSHROOM", "SOUND_LADDER_ZOMBIE", "SOUND_GARGANTUAR_THUMP", "SOUND_BASKETBALL",
+    "SOUND_FIREPEA", "SOUND_IGNITE", "SOUND_IGNITE2", "SOUND_READYSETPLANT", "SOUND_DOOMSHROOM", "SOUND_EXPLOSION",
+    "SOUND_FINALWAVE", "SOUND_REVERSE_EXPLOSION", "SOUND_RVTHROW", "SOUND_SHIELDHIT", "SOUND_SHIELDHIT2",
+    "SOUND_BOSSEXPLOSION", "SOUND_CHERRYBOMB", "SOUND_BONK", "SOUND_SWING", "SOUND_RAIN", "SOUND_LIGHTFILL",
+    "SOUND_PLASTICHIT", "SOUND_PLASTICHIT2", "SOUND_JALAPENO", "SOUND_BALLOONINFLATE", "SOUND_BIGCHOMP",
+    "SOUND_MELONIMPACT", "SOUND_MELONIMPACT2", "SOUND_PLANTGROW", "SOUND_SHOOP", "SOUND_TAPGLASS", "SOUND_JUICY",
+    "SOUND_COFFEE", "SOUND_WAKEUP", "SOUND_LOWGROAN", "SOUND_LOWGROAN2", "SOUND_PRIZE", "SOUND_YUCK", "SOUND_YUCK2",
+    "SOUND_GRASSSTEP", "SOUND_SHOVEL", "SOUND_COBLAUNCH", "SOUND_WATERING", "SOUND_POLEVAULT",
+    "SOUND_GRAVESTONE_RUMBLE", "SOUND_DIRT_RISE", "SOUND_FERTILIZER", "SOUND_PORTAL", "SOUND_BUGSPRAY", "SOUND_SCREAM",
+    "SOUND_PAPER", "SOUND_MONEYFALLS", "SOUND_IMP", "SOUND_IMP2", "SOUND_HYDRAULIC_SHORT", "SOUND_HYDRAULIC",
+    "SOUND_GARGANTUDEATH", "SOUND_CERAMIC", "SOUND_BOSSBOULDERATTACK", "SOUND_CHIME", "SOUND_CRAZYDAVESHORT1",
+    "SOUND_CRAZYDAVESHORT2", "SOUND_CRAZYDAVESHORT3", "SOUND_CRAZYDAVELONG1", "SOUND_CRAZYDAVELONG2",
+    "SOUND_CRAZYDAVELONG3", "SOUND_CRAZYDAVEEXTRALONG1", "SOUND_CRAZYDAVEEXTRALONG2", "SOUND_CRAZYDAVEEXTRALONG3",
+    "SOUND_CRAZYDAVECRAZY", "SOUND_PHONOGRAPH", "SOUND_DANCER", "SOUND_FINALFANFARE", "SOUND_CRAZYDAVESCREAM",
+    "SOUND_CRAZYDAVESCREAM2", "IMAGE_BACKGROUND1", "IMAGE_BACKGROUND1_GAMEOVER_INTERIOR_OVERLAY",
+    "IMAGE_BACKGROUND1_GAMEOVER_MASK", "IMAGE_BACKGROUND1UNSODDED", "IMAGE_SOD1ROW", "IMAGE_SOD3ROW",
+    "IMAGE_BACKGROUND2", "IMAGE_BACKGROUND2_GAMEOVER_INTERIOR_OVERLAY", "IMAGE_BACKGROUND2_GAMEOVER_MASK",
+    "IMAGE_BACKGROUND3", "IMAGE_BACKGROUND3_GAMEOVER_INTERIOR_OVERLAY", "IMAGE_BACKGROUND3_GAMEOVER_MASK",
+    "IMAGE_BACKGROUND4", "IMAGE_BACKGROUND4_GAMEOVER_INTERIOR_OVERLAY", "IMAGE_BACKGROUND4_GAMEOVER_MASK", "IMAGE_FOG",
+    "IMAGE_FOG_SOFTWARE", "IMAGE_BACKGROUND5", "IMAGE_BACKGROUND5_GAMEOVER_MASK", "IMAGE_BACKGROUND6BOSS",
+    "IMAGE_BACKGROUND6_GAMEOVER_MASK", "IMAGE_BACKGROUND_MUSHROOMGARDEN", "IMAGE_BACKGROUND_GREENHOUSE",
+    "IMAGE_BACKGROUND_GREENHOUSE_OVERLAY", "IMAGE_AQUARIUM1", "IMAGE_WAVECENTER", "IMAGE_WAVESIDE",
+    "IMAGE_AWARDSCREEN_BACK", "IMAGE_CHALLENGE_BACKGROUND", "IMAGE_CHALLENGE_WINDOW",
+    "IMAGE_CHALLENGE_WINDOW_HIGHLIGHT", "IMAGE_CHALLENGE_BLANK", "IMAGE_CHALLENGE_THUMBNAILS",
+    "IMAGE_SURVIVAL_THUMBNAILS", "IMAGE_LOCK", "IMAGE_LOCK_OPEN", "IMAGE_ALMANAC_INDEXBACK", "IMAGE_ALMANAC_PLANTBACK",
+    "IMAGE_ALMANAC_ZOMBIEBACK", "IMAGE_ALMANAC_PLANTCARD", "IMAGE_ALMANAC_ZOMBIECARD", "IMAGE_ALMANAC_ZOMBIEWINDOW",
+    "IMAGE_ALMANAC_ZOMBIEWINDOW2", "IMAGE_ALMANAC_ZOMBIEBLANK", "IMAGE_ALMANAC_GROUNDDAY", "IMAGE_ALMANAC_GROUNDNIGHT",
+    "IMAGE_ALMANAC_GROUNDPOOL", "IMAGE_ALMANAC_GROUNDNIGHTPOOL", "IMAGE_ALMANAC_GROUNDROOF", "IMAGE_ALMANAC_GROUNDICE",
+    "IMAGE_ALMANAC_CLOSEBUTTON", "IMAGE_ALMANAC_CLOSEBUTTONHIGHLIGHT", "IMAGE_ALMANAC_INDEXBUTTON",
+    "IMAGE_ALMANAC_INDEXBUTTONHIGHLIGHT", "IMAGE_STORE_BACKGROUND", "IMAGE_STORE_BACKGROUNDNIGHT", "IMAGE_STORE_CAR",
+    "IMAGE_STORE_CAR_NIGHT", "IMAGE_STORE_CARCLOSED", "IMAGE_STORE_CARCLOSED_NIGHT", "IMAGE_STORE_HATCHBACKOPEN",
+    "IMAGE_STORE_SIGN", "IMAGE_STORE_MAINMENUBUTTON", "IMAGE_STORE_MAINMENUBUTTONDOWN",
+    "IMAGE_STORE_MAINMENUBUTTONHIGHLIGHT", "IMAGE_STORE_NEXTBUTTON", "IMAGE_STORE_NEXTBUTTONHIGHLIGHT",
+    "IMAGE_STORE_NEXTBUTTONDISABLED", "IMAGE_STORE_PREVBUTTON", "IMAGE_STORE_PREVBUTTONHIGHLIGHT",
+    "IMAGE_STORE_PREVBUTTONDISABLED", "IMAGE_STORE_PRICETAG", "IMAGE_STORE_PACKETUPGRADE",
+    "IMAGE_STORE_MUSHROOMGARDENICON", "IMAGE_STORE_AQUARIUMGARDENICON", "IMAGE_STORE_TREEOFWISDOMICON",
+    "IMAGE_STORE_FIRSTAIDWALLNUTICON", "IMAGE_STORE_PVZICON", "IMAGE_ZOMBIE_NOTE", "IMAGE_ZOMBIE_NOTE1",
+    "IMAGE_ZOMBIE_NOTE2", "IMAGE_ZOMBIE_NOTE3", "IMAGE_ZOMBIE_NOTE4", "IMAGE_ZOMBIE_FINAL_NOTE",
+    "IMAGE_ZOMBIE_NOTE_HELP", "FONT_BRIANNETOD32", "FONT_BRIANNETOD32BLACK", "IMAGE_REANIM_SUNFLOWER_HEAD_SING1",
+    "IMAGE_REANIM_SUNFLOWER_HEAD_SING2", "IMAGE_REANIM_SUNFLOWER_HEAD_SING3", "IMAGE_REANIM_SUNFLOWER_HEAD_SING4",
+    "IMAGE_REANIM_SUNFLOWER_HEAD_SING5", "IMAGE_REANIM_SUNFLOWER_HEAD_WINK", "IMAGE_REANIM_CREDITS_DISCOLIGHTS",
+    "IMAGE_REANIM_CREDITS_FOGMACHINE", "IMAGE_CREDITS_ZOMBIENOTE", "IMAGE_CREDITS_PLAYBUTTON",
+    "IMAGE_ZOMBATAR_ACCESSORY_BG", "IMAGE_ZOMBATAR_PREV_BUTTON", "IMAGE_ZOMBATAR_PREV_BUTTON_HIGHLIGHT",
+    "IMAGE_ZOMBATAR_NEXT_BUTTON", "IMAGE_ZOMBATAR_NEXT_BUTTON_HIGHLIGHT", "IMAGE_ZOMBATAR_ZOMBIE_BLANK",
+    "IMAGE_ZOMBATAR_ZOMBIE_BLANK_SKIN", "IMAGE_ZOMBATAR_BACKGROUND_CRAZYDAVE", "IMAGE_ZOMBATAR_BACKGROUND_MENU",
+    "IMAGE_ZOMBATAR_BACKGROUND_MENU_DOS", "IMAGE_ZOMBATAR_BACKGROUND_ROOF", "IMAGE_ZOMBATAR_WIDGET_BG",
+    "IMAGE_ZOMBATAR_WIDGET_INNER_BG", "IMAGE_ZOMBATAR_COLORS_BG", "IMAGE_ZOMBATAR_LOGO",
+    "IMAGE_ZOMBATAR_ACCESSORY_BUTTON", "IMAGE_ZOMBATAR_ACCESSORY_BUTTON_HIGHLIGHT",
+    "IMAGE_ZOMBATAR_ACCESSORY_BUTTON_OVER", "IMAGE_ZOMBATAR_BACKDROPS_BUTTON",
+    "IMAGE_ZOMBATAR_BACKDROPS_BUTTON_HIGHLIGHT", "IMAGE_ZOMBATAR_BACKDROPS_BUTTON_OVER",
+    "IMAGE_ZOMBATAR_CLOTHES_BUTTON", "IMAGE_ZOMBATAR_CLOTHES_BUTTON_HIGHLIGHT", "IMAGE_ZOMBATAR_CLOTHES_BUTTON_OVER",
+    "IMAGE_ZOMBATAR_EYEWEAR_BUTTON", "IMAGE_ZOMBATAR_EYEWEAR_BUTTON_HIGHLIGHT", "IMAGE_ZOMBATAR_EYEWEAR_BUTTON_OVER",
+    "IMAGE_ZOMBATAR_FACIAL_HAIR_BUTTON", "IMAGE_ZOMBATAR_FACIAL_HAIR_BUTTON_HIGHLIGHT",
+    "IMAGE_ZOMBATAR_FACIAL_HAIR_BUTTON_OVER", "IMAGE_ZOMBATAR_HAIR_BUTTON", "IMAGE_ZOMBATAR_HAIR_BUTTON_HIGHLIGHT",
+    "IMAGE_ZOMBATAR_HAIR_BUTTON_OVER", "IMAGE_ZOMBATAR_HATS_BUTTON", "IMAGE_ZOMBATAR_HATS_BUTTON_HIGHLIGHT",
+    "IMAGE_ZOMBATAR_HATS_BUTTON_OVER", "IMAGE_ZOMBATAR_SKIN_BUTTON", "IMAGE_ZOMBATAR_SKIN_BUTTON_HIGHLIGHT",
+    "IMAGE_ZOMBATAR_TIDBITS_BUTTON", "IMAGE_ZOMBATAR_TIDBITS_BUTTON_HIGHLIGHT", "IMAGE_ZOMBATAR_TIDBITS_BUTTON_OVER",
+    "IMAGE_ZOMBATAR_ACCESSORY_BG_HIGHLIGHT", "IMAGE_ZOMBATAR_TRIPTYCH", "IMAGE_ZOMBATAR_COLORPICKER",
+    "IMAGE_ZOMBATAR_COLORPICKER_HIGHLIGHT", "IMAGE_ZOMBATAR_COLORPICKER_NONE", "IMAGE_ZOMBATAR_ACCESSORY_BG_NONE",
+    "IMAGE_ZOMBATAR_COLORS_BG_SMALL", "IMAGE_ZOMBATAR_CLOTHES_1", "IMAGE_ZOMBATAR_CLOTHES_2",
+    "IMAGE_ZOMBATAR_CLOTHES_3", "IMAGE_ZOMBATAR_CLOTHES_4", "IMAGE_ZOMBATAR_CLOTHES_5", "IMAGE_ZOMBATAR_CLOTHES_6",
+    "IMAGE_ZOMBATAR_CLOTHES_7", "IMAGE_ZOMBATAR_CLOTHES_8", "IMAGE_ZOMBATAR_CLOTHES_9", "IMAGE_ZOMBATAR_CLOTHES_10",
+    "IMAGE_ZOMBATAR_CLOTHES_11", "IMAGE_ZOMBATAR_CLOTHES_12", "IMAGE_ZOMBATAR_HATS_1", "IMAGE_ZOMBATAR_HATS_2",
+    "IMAGE_ZOMBATAR_HATS_3", "IMAGE_ZOMBATAR_HATS_4", "IMAGE_ZOMBATAR_HATS_5", "IMAGE_ZOMBATAR_HATS_6",
+    "IMAGE_ZOMBATAR_HATS_7", "IMAGE_ZOMBATAR_HATS_8", "IMAGE_ZOMBATAR_HATS_9", "IMAGE_ZOMBATAR_HATS_10",
+    "IMAGE_ZOMBATAR_HATS_11", "IMAGE_ZOMBATAR_HATS_12", "IMAGE_ZOMBATAR_HATS_13", "IMAGE_ZOMBATAR_HATS_14",
+    "IMAGE_ZOMBATAR_HAIR_1", "IMAGE_ZOMBATAR_HAIR_2", "IMAGE_ZOMBATAR_HAIR_3", "IMAGE_ZOMBATAR_HAIR_4",
+    "IMAGE_ZOMBATAR_HAIR_5", "IMAGE_ZOMBATAR_HAIR_6", "IMAGE_ZOMBATAR_HAIR_7", "IMAGE_ZOMBATAR_HAIR_8",
+    "IMAGE_ZOMBATAR_HAIR_9", "IMAGE_ZOMBATAR_HAIR_10", "IMAGE_ZOMBATAR_HAIR_11", "IMAGE_ZOMBATAR_HAIR_12",
+    "IMAGE_ZOMBATAR_HAIR_13", "IMAGE_ZOMBATAR_HAIR_14", "IMAGE_ZOMBATAR_HAIR_15", "IMAGE_ZOMBATAR_HAIR_16",
+    "IMAGE_ZOMBATAR_EYEWEAR_1", "IMAGE_ZOMBATAR_EYEWEAR_2", "IMAGE_ZOMBATAR_EYEWEAR_3", "IMAGE_ZOMBATAR_EYEWEAR_4",
+    "IMAGE_ZOMBATAR_EYEWEAR_5", "IMAGE_ZOMBATAR_EYEWEAR_6", "IMAGE_ZOMBATAR_EYEWEAR_7", "IMAGE_ZOMBATAR_EYEWEAR_8",
+    "IMAGE_ZOMBATAR_EYEWEAR_9", "IMAGE_ZOMBATAR_EYEWEAR_10", "IMAGE_ZOMBATAR_EYEWEAR_11", "IMAGE_ZOMBATAR_EYEWEAR_12",
+    "IMAGE_ZOMBATAR_EYEWEAR_13", "IMAGE_ZOMBATAR_EYEWEAR_14", "IMAGE_ZOMBATAR_EYEWEAR_15", "IMAGE_ZOMBATAR_EYEWEAR_16",
+    "IMAGE_ZOMBATAR_FACIALHAIR_1", "IMAGE_ZOMBATAR_FACIALHAIR_2", "IMAGE_ZOMBATAR_FACIALHAIR_3",
+    "IMAGE_ZOMBATAR_FACIALHAIR_4", "IMAGE_ZOMBATAR_FACIALHAIR_5", "IMAGE_ZOMBATAR_FACIALHAIR_6",
+    "IMAGE_ZOMBATAR_FACIALHAIR_7", "IMAGE_ZOMBATAR_FACIALHAIR_8", "IMAGE_ZOMBATAR_FACIALHAIR_9",
+    "IMAGE_ZOMBATAR_FACIALHAIR_10", "IMAGE_ZOMBATAR_FACIALHAIR_11", "IMAGE_ZOMBATAR_FACIALHAIR_12",
+    "IMAGE_ZOMBATAR_FACIALHAIR_13", "IMAGE_ZOMBATAR_FACIALHAIR_14", "IMAGE_ZOMBATAR_FACIALHAIR_15",
+    "IMAGE_ZOMBATAR_FACIALHAIR_16", "IMAGE_ZOMBATAR_FACIALHAIR_17", "IMAGE_ZOMBATAR_FACIALHAIR_18",
+    "IMAGE_ZOMBATAR_FACIALHAIR_19", "IMAGE_ZOMBATAR_FACIALHAIR_20", "IMAGE_ZOMBATAR_FACIALHAIR_21",
+    "IMAGE_ZOMBATAR_FACIALHAIR_22", "IMAGE_ZOMBATAR_FACIALHAIR_23", "IMAGE_ZOMBATAR_FACIALHAIR_24",
+    "IMAGE_ZOMBATAR_TIDBITS_1", "IMAGE_ZOMBATAR_TIDBITS_2", "IMAGE_ZOMBATAR_TIDBITS_3", "IMAGE_ZOMBATAR_TIDBITS_4",
+    "IMAGE_ZOMBATAR_TIDBITS_5", "IMAGE_ZOMBATAR_TIDBITS_6", "IMAGE_ZOMBATAR_TIDBITS_7", "IMAGE_ZOMBATAR_TIDBITS_8",
+    "IMAGE_ZOMBATAR_TIDBITS_9", "IMAGE_ZOMBATAR_TIDBITS_10", "IMAGE_ZOMBATAR_TIDBITS_11", "IMAGE_ZOMBATAR_TIDBITS_12",
+    "IMAGE_ZOMBATAR_TIDBITS_13", "IMAGE_ZOMBATAR_TIDBITS_14", "IMAGE_ZOMBATAR_ACCESSORY_1",
+    "IMAGE_ZOMBATAR_ACCESSORY_2", "IMAGE_ZOMBATAR_ACCESSORY_3", "IMAGE_ZOMBATAR_ACCESSORY_4",
+    "IMAGE_ZOMBATAR_ACCESSORY_5", "IMAGE_ZOMBATAR_ACCESSORY_6", "IMAGE_ZOMBATAR_ACCESSORY_7",
+    "IMAGE_ZOMBATAR_ACCESSORY_8", "IMAGE_ZOMBATAR_ACCESSORY_9", "IMAGE_ZOMBATAR_ACCESSORY_10",
+    "IMAGE_ZOMBATAR_ACCESSORY_11", "IMAGE_ZOMBATAR_ACCESSORY_12", "IMAGE_ZOMBATAR_ACCESSORY_13",
+    "IMAGE_ZOMBATAR_ACCESSORY_14", "IMAGE_ZOMBATAR_HATS_1_MASK", "IMAGE_ZOMBATAR_HAIR_1_MASK",
+    "IMAGE_ZOMBATAR_HAIR_2_MASK", "IMAGE_ZOMBATAR_HAIR_11_MASK", "IMAGE_ZOMBATAR_HAIR_12_MASK",
+    "IMAGE_ZOMBATAR_HAIR_13_MASK", "IMAGE_ZOMBATAR_HAIR_14_MASK", "IMAGE_ZOMBATAR_HAIR_15_MASK",
+    "IMAGE_ZOMBATAR_FACIALHAIR_1_MASK", "IMAGE_ZOMBATAR_FACIALHAIR_4_MASK", "IMAGE_ZOMBATAR_FACIALHAIR_8_MASK",
+    "IMAGE_ZOMBATAR_FACIALHAIR_9_MASK", "IMAGE_ZOMBATAR_FACIALHAIR_10_MASK", "IMAGE_ZOMBATAR_FACIALHAIR_11_MASK",
+    "IMAGE_ZOMBATAR_FACIALHAIR_12_MASK", "IMAGE_ZOMBATAR_FACIALHAIR_14_MASK", "IMAGE_ZOMBATAR_FACIALHAIR_15_MASK",
+    "IMAGE_ZOMBATAR_FACIALHAIR_16_MASK", "IMAGE_ZOMBATAR_FACIALHAIR_18_MASK", "IMAGE_ZOMBATAR_FACIALHAIR_21_MASK",
+    "IMAGE_ZOMBATAR_FACIALHAIR_22_MASK", "IMAGE_ZOMBATAR_FACIALHAIR_23_MASK", "IMAGE_ZOMBATAR_FACIALHAIR_24_MASK",
+    "IMAGE_ZOMBATAR_EYEWEAR_1_MASK", "IMAGE_ZOMBATAR_EYEWEAR_2_MASK", "IMAGE_ZOMBATAR_EYEWEAR_3_MASK",
+    "IMAGE_ZOMBATAR_EYEWEAR_4_MASK", "IMAGE_ZOMBATAR_EYEWEAR_5_MASK", "IMAGE_ZOMBATAR_EYEWEAR_6_MASK",
+    "IMAGE_ZOMBATAR_EYEWEAR_7_MASK", "IMAGE_ZOMBATAR_EYEWEAR_8_MASK", "IMAGE_ZOMBATAR_EYEWEAR_9_MASK",
+    "IMAGE_ZOMBATAR_EYEWEAR_10_MASK", "IMAGE_ZOMBATAR_EYEWEAR_11_MASK", "IMAGE_ZOMBATAR_EYEWEAR_12_MASK",
+    "IMAGE_ZOMBATAR_HATS_3_MASK", "IMAGE_ZOMBATAR_HATS_6_MASK", "IMAGE_ZOMBATAR_HATS_7_MASK",
+    "IMAGE_ZOMBATAR_HATS_8_MASK", "IMAGE_ZOMBATAR_HATS_9_MASK", "IMAGE_ZOMBATAR_HATS_11_MASK",
+    "IMAGE_ZOMBATAR_BACKGROUND_BLANK", "IMAGE_ZOMBATAR_ACCESSORY_15", "IMAGE_ZOMBATAR_ACCESSORY_16",
+    "IMAGE_ZOMBATAR_ACCEPT_BUTTON", "IMAGE_ZOMBATAR_ACCEPT_BUTTON_HIGHLIGHT", "IMAGE_ZOMBATAR_FINISHED_BUTTON",
+    "IMAGE_ZOMBATAR_FINISHED_BUTTON_HIGHLIGHT", "IMAGE_ZOMBATAR_MAIN_BG", "IMAGE_ZOMBATAR_BACK_BUTTON",
+    "IMAGE_ZOMBATAR_BACK_BUTTON_HIGHLIGHT", "IMAGE_ZOMBATAR_NEWZOMBIE_BUTTON",
+    "IMAGE_ZOMBATAR_NEWZOMBIE_BUTTON_HIGHLIGHT", "IMAGE_ZOMBATAR_TOS_ARROW", "IMAGE_ZOMBATAR_BEGIN_BUTTON",
+    "IMAGE_ZOMBATAR_BEGIN_BUTTON_HIGHLIGHT", "IMAGE_ZOMBATAR_TOS_SLIDER", "IMAGE_ZOMBATAR_TOS_SLIDER_THUMB",
+    "IMAGE_ZOMBATAR_DISPLAY_WINDOW", "IMAGE_ZOMBATAR_MAINMENUBACK_HIGHLIGHT", "IMAGE_ZOMBATAR_VIEW_BUTTON",
+    "IMAGE_ZOMBATAR_VIEW_BUTTON_HIGHLIGHT"
+};
+
 Sexy::Image *Sexy::GetImageById(ResourceId theId) { return *static_cast<Sexy::Image **>(gResources[(int)theId]); }
 
 Sexy::_Font *Sexy::GetFontById(ResourceId theId) { return *static_cast<Sexy::_Font **>(gResources[(int)theId]); }
@@ -2531,6 +2869,8 @@ _Font *&Sexy::GetFontRefById(ResourceId theId) { return *static_cast<_Font **>(g
 
 int &Sexy::GetSoundRefById(ResourceId theId) { return *static_cast<int *>(gResources[(intptr_t)theId]); }
 
+const char *Sexy::GetStringIdById(ResourceId theId) { return gResourceStringIds[(int)theId]; }
+
 Sexy::ResourceId Sexy::GetIdByImage(Image *theImage) { return GetIdByVariable(theImage); }
 
 Sexy::ResourceId Sexy::GetIdByFont(_Font *theFont) { return GetIdByVariable(theFont); }
@@ -1883,12 +1883,14 @@ ResourceId GetIdByImage(Image *theImage);
 ResourceId GetIdByFont(_Font *theFont);
 ResourceId GetIdBySound(intptr_t theSound);
 
-// const char*         GetStringIdById(ResourceId theId);
+const char *GetStringIdById(ResourceId theId);
 // ResourceId          GetIdByString(const char* theStringId);
 }; // namespace Sexy
 
 extern bool (*gExtractResourcesByName)(Sexy::ResourceManager *theResourceManager, const char *theName);
 
 extern void *gResources[static_cast<int>(Sexy::ResourceId::RESOURCE_ID_MAX)];
+// The string id of every resource in ResourceId order, which makes the ids usable as ResourceManager handles.
+extern const char *const gResourceStringIds[static_cast<int>(Sexy::ResourceId::RESOURCE_ID_MAX)];
 
 #endif
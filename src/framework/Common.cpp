@@ -19,6 +19,13 @@
 
 #include "misc/PerfTimer.h"
 
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#endif
+
 // HINSTANCE Sexy::gHInstance;
 bool Sexy::gDebug = false;
 static Sexy::MTRand gMTRand;
@@ -677,6 +684,39 @@ bool Sexy::Deltree(const std::string &thePath) {
     return success;*/
 }
 
+bool Sexy::GetProcessMemory(size_t *theResident, size_t *thePeak) {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS aCounters{};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &aCounters, sizeof(aCounters))) return false;
+
+    *theResident = aCounters.WorkingSetSize;
+    *thePeak = aCounters.PeakWorkingSetSize;
+    return true;
+#elif defined(__linux__)
+    FILE *aFP = fopen("/proc/self/status", "r");
+    if (aFP == nullptr) return false;
+
+    int aFound = 0;
+    char aLine[256];
+    while (fgets(aLine, sizeof(aLine), aFP) != nullptr) {
+        unsigned long aKB = 0;
+        if (sscanf(aLine, "VmRSS: %lu kB", &aKB) == 1) {
+            *theResident = static_cast<size_t>(aKB) * 1024;
+            aFound++;
+        } else if (sscanf(aLine, "VmHWM: %lu kB", &aKB) == 1) {
+            *thePeak = static_cast<size_t>(aKB) * 1024;
+            aFound++;
+        }
+    }
+    fclose(aFP);
+    return aFound == 2;
+#else
+    (void)theResident;
+    (void)thePeak;
+    return false;
+#endif
+}
+
 bool Sexy::FileExists(const std::string &theFileName) {
     return std::filesystem::exists(theFileName);
     /*
@@ -94,6 +94,8 @@ void SRand(uint32_t theSeed);
 // extern std::wstring StrFormat(const wchar_t *fmt...);
 bool CheckFor98Mill();
 bool CheckForVista();
+// The resident memory of this process and its peak so far, in bytes. False where the platform doesn't tell.
+bool GetProcessMemory(size_t *theResident, size_t *thePeak);
 std::string GetAppDataFolder();
 void SetAppDataFolder(const std::string &thePath);
 std::string URLEncode(const std::string &theString);
@@ -3,6 +3,7 @@
 #include "Common.h"
 
 #include "graphics/Color.h"
+#include "graphics/UpscaleCache.h"
 #include "graphics/VkImage.h"
 #include "graphics/WindowInterface.h"
 
@@ -22,6 +23,7 @@
 #include "misc/PropertiesParser.h"
 #include "misc/Rect.h"
 #include "misc/ResourceManager.h"
+#include "misc/WorkerPool.h"
 
 #include "sound/BassMusicInterface.h"
 #include "sound/DummyMusicInterface.h"
@@ -535,7 +537,7 @@ bool SexyAppBase::ReadDemoBuffer(std::string &theError) {
     fread(aStr, 1, aStrLen, aFP);
     aStr[aStrLen] = '\0';
 
-    unreachable(); // FIXME
+    // mProductVersion isn't tracked, so the version string is read but not checked.
     /*
     DBG_ASSERTE(mProductVersion == aStr);
     if (mProductVersion != aStr)
@@ -619,7 +621,9 @@ void SexyAppBase::WriteDemoBuffer() {
 
             fwrite(&mRandSeed, 4, 1, aFP);
 
-            unreachable();
+            // mProductVersion isn't tracked, write an empty version string.
+            constexpr uint16_t aStrLen = 0;
+            fwrite(&aStrLen, 2, 1, aFP);
             /* FIXME
             uint16_t aStrLen = mProductVersion.length();
             fwrite(&aStrLen, 2, 1, aFP);
@@ -2029,6 +2033,7 @@ void SexyAppBase::Redraw() {
     if (gScreenSaverActive) return;
 
     mWindowInterface->Draw();
+    mResourceManager->EnforceImageBudget();
 
     /*==================================================*
      |     Here lies a bunch of error recovery code     |
@@ -3555,72 +3560,22 @@ void SexyAppBase::ProcessDemo() {
     }
 }
 
-void SexyAppBase::ShowMemoryUsage() {
-    unreachable();
-    /* TODO
-    DWORD aTotal = 0;
-    DWORD aFree = 0;
-
-    if (mDDInterface->mDD7 != NULL)
-    {
-        DDSCAPS2 aCaps;
-        ZeroMemory(&aCaps,sizeof(aCaps));
-        aCaps.dwCaps = DDSCAPS_VIDEOMEMORY;
-        mDDInterface->mDD7->GetAvailableVidMem(&aCaps,&aTotal,&aFree);
-    }
-
-    MemoryImageSet::iterator anItr = mMemoryImageSet.begin();
-    typedef std::pair<int,int> FormatUsage;
-    typedef std::map<PixelFormat,FormatUsage> FormatMap;
-    FormatMap aFormatMap;
-    int aTextureMemory = 0;
-    while (anItr != mMemoryImageSet.end())
-    {
-        MemoryImage* aMemoryImage = *anItr;
-        if (aMemoryImage->mD3DData != NULL)
-        {
-            TextureData *aData = (TextureData*)aMemoryImage->mD3DData;
-            aTextureMemory += aData->mTexMemSize;
+void SexyAppBase::CaptureGoldenFrame() {
+    auto aScreenImage = dynamic_cast<Vk::VkImage *>(mWindowInterface->GetScreenImage());
+    if (aScreenImage == nullptr) return;
 
-            FormatUsage &aUsage = aFormatMap[aData->mPixelFormat];
-            aUsage.first++;
-            aUsage.second += aData->mTexMemSize;
-        }
+    const auto aFrame = aScreenImage->ReadPixels();
+    mGoldenFrames.ProcessFrame(mUpdateCount, aFrame.get());
 
-        ++anItr;
+    if (mGoldenFrames.IsDone(mUpdateCount)) {
+        fmt::println("{}", mGoldenFrames.GetSummary());
+        if (mGoldenFrames.mExitWhenDone) DoExit(mGoldenFrames.mNumMismatched > 0 ? 1 : 0);
     }
+}
 
-    std::string aStr;
-
-    const char *aDesc;
-    if (Is3DAccelerationRecommended())
-        aDesc = "Recommended";
-    else if (Is3DAccelerationSupported())
-        aDesc = "Supported";
-    else
-        aDesc = "Unsupported";
-
-    aStr += StrFormat("3D-Mode is %s (3D is %s on this system)\r\n\r\n",Is3DAccelerated()?"On":"Off",aDesc);
-
-    aStr += StrFormat("Num Images: %d\r\n",(int)mMemoryImageSet.size());
-    aStr += StrFormat("Num Sounds: %d\r\n",mSoundManager->GetNumSounds());
-    aStr += StrFormat("Video Memory: %s/%s KB\r\n", SexyStringToString(CommaSeperate((aTotal-aFree)/1024)).c_str(),
-    SexyStringToString(CommaSeperate(aTotal/1024)).c_str()); aStr += StrFormat("Texture Memory: %s
-    KB\r\n",CommaSeperate(aTextureMemory/1024).c_str());
-
-    FormatUsage aUsage = aFormatMap[PixelFormat_A8R8G8B8];
-    aStr += StrFormat("A8R8G8B8: %d - %s
-    KB\r\n",aUsage.first,SexyStringToString(CommaSeperate(aUsage.second/1024)).c_str()); aUsage =
-    aFormatMap[PixelFormat_A4R4G4B4]; aStr += StrFormat("A4R4G4B4: %d - %s
-    KB\r\n",aUsage.first,SexyStringToString(CommaSeperate(aUsage.second/1024)).c_str()); aUsage =
-    aFormatMap[PixelFormat_R5G6B5]; aStr += StrFormat("R5G6B5: %d - %s
-    KB\r\n",aUsage.first,SexyStringToString(CommaSeperate(aUsage.second/1024)).c_str()); aUsage =
-    aFormatMap[PixelFormat_Palette8]; aStr += StrFormat("Palette8: %d - %s
-    KB\r\n",aUsage.first,SexyStringToString(CommaSeperate(aUsage.second/1024)).c_str());
-
-    MsgBox(aStr,"Video Stats",MB_OK);
-    mLastTime = timeGetTime();
-    */
+void SexyAppBase::ShowMemoryUsage() {
+    fmt::println("Num Sounds: {}", mSoundManager->GetNumSounds());
+    fmt::print("{}", Vk::getMemoryStatsString());
 }
 
 /*
@@ -4705,11 +4660,16 @@ bool SexyAppBase::UpdateAppStep(bool *updated) {
 
         // Make sure we're not paused
         if (!mPaused) {
+            ProcessDemo();
             DoUpdateFrames();
 
-            if (drawFrame) {
+            // Golden frames must be drawn even if the frame skipper would have dropped them.
+            const bool aCaptureGoldenFrame = mGoldenFrames.WantsFrame(mUpdateCount);
+            if (drawFrame || aCaptureGoldenFrame) {
                 DrawDirtyStuff();
             }
+
+            if (aCaptureGoldenFrame) CaptureGoldenFrame();
         }
     } else if (mUpdateAppState == UPDATESTATE_PROCESS_2) {
         mUpdateAppState = UPDATESTATE_PROCESS_DONE;
@@ -5090,6 +5050,23 @@ void SexyAppBase::HandleCmdLineParam(const std::string &theParamName, const std:
         if (mDemoFileName.length() < 2 || (mDemoFileName[1] != ':' && mDemoFileName[2] != '\\')) {
             mDemoFileName = GetAppDataFolder() + mDemoFileName;
         }
+    } else if (theParamName == "-imagebudget") {
+        int aMegabytes = 0;
+        if (StringToInt(theParamValue, &aMegabytes) && aMegabytes > 0) {
+            mResourceManager->SetImageBudget(static_cast<size_t>(aMegabytes) * 1024 * 1024);
+        }
+    } else if (theParamName == "-goldenframes") {
+        mGoldenFrames.SetFrameList(theParamValue);
+    } else if (theParamName == "-goldendir") {
+        mGoldenFrames.mGoldenDir = theParamValue;
+    } else if (theParamName == "-goldentolerance") {
+        StringToInt(theParamValue, &mGoldenFrames.mTolerance);
+    } else if (theParamName == "-goldenupdate") {
+        mGoldenFrames.mUpdateGoldens = true;
+    } else if (theParamName == "-goldennoexit") {
+        mGoldenFrames.mExitWhenDone = false;
+    } else if (theParamName == "-upscalecachesize") {
+        StringToInt(theParamValue, &mUpscaleCacheSizeMB);
     } else if (theParamName == "-crash") {
         // Try to access NULL
         char *a = nullptr;
@@ -5205,6 +5182,12 @@ void SexyAppBase::Init() {
 
     gPakInterface->AddPakFile("main.pak");
 
+    // Also holds finished image resources, so it's used at any SCALE
+    Vk::initUpscaleCache(
+        GetAppDataFolder() + "cache/upscale", gPakInterface->mPakSignature,
+        static_cast<uint64_t>(std::max(mUpscaleCacheSizeMB, 0)) * 1024 * 1024
+    );
+
     /* TODO
     // Create a message we can use to talk to ourselves inter-process
     mNotifyGameMessage = RegisterWindowMessage((_S("Notify") + StringToSexyString(mProdName)).c_str());
@@ -5462,18 +5445,90 @@ void SexyAppBase::EnableCustomCursors(bool enabled) { mCustomCursorsEnabled = en
 
 std::unordered_map<std::string, std::unique_ptr<Vk::VkImage>> gBaseImageMap;
 
+PreparedImage SexyAppBase::LoadPreparedImage(const ResourceManager::ImageRes &theRes) {
+    PreparedImage anImage;
+
+    const uint64_t aCacheKey = Vk::getImageResCacheKey(theRes, ImageLib::gAlphaComposeColor);
+    if (auto aCached = Vk::loadImageRes(aCacheKey)) {
+        if constexpr (SCALE == 1) {
+            anImage.first = std::move(aCached);
+        } else {
+            anImage.first = std::make_unique<ImageLib::Image>(
+                aCached->mWidth / SCALE, aCached->mHeight / SCALE, std::unique_ptr<uint32_t[]>()
+            );
+            anImage.second = std::move(aCached);
+        }
+        return anImage;
+    }
+
+    anImage.first = ImageLib::GetImage(theRes, true);
+    if (anImage.first == nullptr) return anImage;
+
+    anImage.second = Vk::VkImage::upscale(*anImage.first);
+    Vk::storeImageRes(aCacheKey, anImage.second ? *anImage.second : *anImage.first);
+    return anImage;
+}
+
 std::unique_ptr<Sexy::Image> SexyAppBase::GetImage(const ResourceManager::ImageRes &theRes) {
     // printf("new image to load: %s\n", theFileName.c_str());
-    std::unique_ptr<ImageLib::Image> aLoadedImage = ImageLib::GetImage(theRes, true);
+    std::optional<std::future<PreparedImage>> aPrepared;
+    {
+        std::lock_guard aLock(mPreparedImageMutex);
+        auto anItr = mPreparedImageMap.find(GetPreparedImageKey(theRes));
+        if (anItr != mPreparedImageMap.end()) {
+            aPrepared = std::move(anItr->second);
+            mPreparedImageMap.erase(anItr);
+        }
+    }
 
-    if (aLoadedImage == nullptr) return nullptr;
+    PreparedImage anImage;
+    if (aPrepared.has_value()) {
+        // Help out with queued work instead of idling until this image is ready.
+        while (aPrepared->wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            if (!GetWorkerPool().RunPendingTask()) aPrepared->wait();
+        }
+        anImage = aPrepared->get();
+    } else {
+        anImage = LoadPreparedImage(theRes);
+    }
+
+    if (anImage.first == nullptr) return nullptr;
 
-    auto ret = std::make_unique<Vk::VkImage>(*aLoadedImage);
+    // Only the upload happens here, it has to be serialized with rendering anyway.
+    auto ret = std::make_unique<Vk::VkImage>(*anImage.first, anImage.second.get());
     ret->mFilePath = theRes.mPath;
 
     return ret;
 }
 
+std::string SexyAppBase::GetPreparedImageKey(const ResourceManager::ImageRes &theRes) {
+    return fmt::format(
+        "{}|{}|{}|{:x}", StringToUpper(theRes.mPath), StringToUpper(theRes.mAlphaImage),
+        StringToUpper(theRes.mAlphaGridImage), theRes.mAlphaColor
+    );
+}
+
+void SexyAppBase::PrepareImage(const ResourceManager::ImageRes &theRes) {
+    if (mSharedImageMap.contains(StringToUpper(theRes.mPath))) return;
+
+    const std::string aKey = GetPreparedImageKey(theRes);
+    std::lock_guard aLock(mPreparedImageMutex);
+    if (mPreparedImageMap.contains(aKey)) return;
+
+    mPreparedImageMap[aKey] = GetWorkerPool().Submit([aRes = theRes] {
+        ImageLib::gAlphaComposeColor = aRes.mAlphaColor;
+        PreparedImage anImage = LoadPreparedImage(aRes);
+        ImageLib::gAlphaComposeColor = 0xFFFFFF;
+        return anImage;
+    });
+}
+
+void SexyAppBase::DiscardPreparedImage(const ResourceManager::ImageRes &theRes) {
+    // The task keeps running if it already started, its result just goes nowhere.
+    std::lock_guard aLock(mPreparedImageMutex);
+    mPreparedImageMap.erase(GetPreparedImageKey(theRes));
+}
+
 /*
 Sexy::DDImage* SexyAppBase::CreateCrossfadeImage(Sexy::Image* theImage1, const Rect& theRect1, Sexy::Image* theImage2,
 const Rect& theRect2, double theFadeFactor)
@@ -6071,6 +6126,8 @@ Image *SexyAppBase::GetSharedImage(const std::string &theFileName) {
     // declaring this static means we only ever need to make one of these
     static ResourceManager::ImageRes aRes = {};
     aRes.mPath = theFileName;
+    // What the image gets decoded with on this thread, so it matches the key of an image prepared for it
+    aRes.mAlphaColor = ImageLib::gAlphaComposeColor;
     return GetSharedImage(aRes);
 }
 
@@ -6078,7 +6135,9 @@ Image *SexyAppBase::GetSharedImage(const ResourceManager::ImageRes &theRes) {
     std::string anUpperFileName = StringToUpper(theRes.mPath);
 
     // Get the image and add it to the map if it doesn't exist.
-    std::unique_ptr<Image> &aResult = mSharedImageMap.try_emplace(anUpperFileName, GetImage(theRes)).first->second;
+    auto anItr = mSharedImageMap.find(anUpperFileName);
+    if (anItr == mSharedImageMap.end()) anItr = mSharedImageMap.emplace(anUpperFileName, GetImage(theRes)).first;
+    std::unique_ptr<Image> &aResult = anItr->second;
 
     // This represents an old path which is not implemented.
     // Pass in a '!' as the first char of the file name to create a new image
@@ -3,6 +3,7 @@
 
 #include "framework/Common.h"
 #include "graphics/Color.h"
+#include "graphics/GoldenFrame.h"
 #include "graphics/VkInterface.h"
 #include "graphics/WindowInterface.h"
 #include "misc/Buffer.h"
@@ -15,7 +16,9 @@
 
 #include <atomic>
 #include <chrono>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <unordered_map>
 
@@ -104,6 +107,11 @@ enum {
 // typedef std::map<HANDLE, int> HandleToIntMap;
 using SharedImageMap = std::map<std::string, std::unique_ptr<Image>>;
 
+// Decoded image and its upscaled copy (null when SCALE is 1), produced on the worker pool ahead of the upload.
+using PreparedImage = std::pair<std::unique_ptr<ImageLib::Image>, std::unique_ptr<ImageLib::Image>>;
+// Keyed by SexyAppBase::GetPreparedImageKey, the same path can be loaded with different alpha settings.
+using PreparedImageMap = std::map<std::string, std::future<PreparedImage>>;
+
 class SexyAppBase : public ButtonListener, public DialogListener {
 public:
     uint32_t mRandSeed;
@@ -184,6 +192,8 @@ public:
     //	MemoryImageSet			mMemoryImageSet;
     SharedImageMap mSharedImageMap;
     bool mCleanupSharedImages;
+    PreparedImageMap mPreparedImageMap;
+    std::mutex mPreparedImageMutex;
 
     //	int						mNonDrawCount;
     std::chrono::high_resolution_clock::duration mFrameTime;
@@ -276,6 +286,12 @@ public:
     using DemoMarkerList = std::list<DemoMarker>;
     DemoMarkerList mDemoMarkerList;
 
+    // Frame capture for comparing rendering output (-goldenframes=...)
+    GoldenFrameHarness mGoldenFrames;
+
+    // Size cap of the on-disk cache of upscaled images, 0 disables it (-upscalecachesize=...)
+    int mUpscaleCacheSizeMB = 512;
+
     bool mDebugKeysEnabled;
     bool mEnableMaximizeButton;
     bool mCtrlDown;
@@ -339,6 +355,7 @@ protected:
     void DoExit(int theCode);
 
     void TakeScreenshot();
+    void CaptureGoldenFrame();
     void DumpProgramInfo();
     void ShowMemoryUsage();
 
@@ -428,6 +445,15 @@ public:
     Image *GetSharedImage(const std::string &theRes);
     void DeleteSharedImage(const std::string &theFileName);
     Image *GetSharedImage(const ResourceManager::ImageRes &theRes);
+    // Starts decoding and upscaling the image on the worker pool, GetImage then only has to upload it.
+    void PrepareImage(const ResourceManager::ImageRes &theRes);
+    // Drops the prepared image of theRes if GetImage never picked it up, e.g. when its group load was aborted.
+    void DiscardPreparedImage(const ResourceManager::ImageRes &theRes);
+    // Everything besides the files that the prepared pixels depend on.
+    static std::string GetPreparedImageKey(const ResourceManager::ImageRes &theRes);
+    // Decodes and upscales theRes with the current ImageLib::gAlphaComposeColor, or reads the finished pixels back
+    // from the cache. On a hit with SCALE != 1 only the upscaled image has pixels, the other one just carries the size.
+    static PreparedImage LoadPreparedImage(const ResourceManager::ImageRes &theRes);
 
     void CleanSharedImages();
     //	void					PrecacheAdditive(MemoryImage* theImage);
@@ -0,0 +1,100 @@
+#include "GoldenFrame.h"
+
+#include "imagelib/ImageLib.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+
+using namespace Sexy;
+
+void GoldenFrameHarness::SetFrameList(const std::string &theFrameList) {
+    mCaptureFrames.clear();
+
+    std::stringstream aStream(theFrameList);
+    std::string aFrame;
+    while (std::getline(aStream, aFrame, ',')) {
+        int aFrameNum;
+        if (StringToInt(Trim(aFrame), &aFrameNum) && aFrameNum > 0) mCaptureFrames.insert(aFrameNum);
+    }
+}
+
+std::string GoldenFrameHarness::GetFramePath(
+    int theUpdateCount, const ImageLib::Image *theFrame, const std::string &theSuffix
+) const {
+    return fmt::format(
+        "{}frame_{:06}_{}x{}{}.png", AddTrailingSlash(mGoldenDir), theUpdateCount, theFrame->mWidth, theFrame->mHeight,
+        theSuffix
+    );
+}
+
+static int GetMaxChannelDiff(uint32_t theColor1, uint32_t theColor2) {
+    int aMaxDiff = 0;
+    for (int aShift = 0; aShift < 32; aShift += 8) {
+        const int aChannel1 = (theColor1 >> aShift) & 0xFF;
+        const int aChannel2 = (theColor2 >> aShift) & 0xFF;
+        const int aDiff = abs(aChannel1 - aChannel2);
+        aMaxDiff = std::max(aMaxDiff, aDiff);
+    }
+    return aMaxDiff;
+}
+
+bool GoldenFrameHarness::ProcessFrame(int theUpdateCount, const ImageLib::Image *theFrame) {
+    const std::string aGoldenPath = GetFramePath(theUpdateCount, theFrame, "");
+
+    if (mUpdateGoldens) {
+        MkDir(mGoldenDir);
+        ImageLib::WritePNGImage(aGoldenPath, theFrame);
+        fmt::println("golden:   wrote {}", aGoldenPath);
+        return true;
+    }
+
+    mNumCompared++;
+
+    const auto aGolden = ImageLib::ReadImageFile(aGoldenPath);
+    if (aGolden == nullptr || aGolden->mWidth != theFrame->mWidth || aGolden->mHeight != theFrame->mHeight) {
+        fmt::println("golden:   frame {} has no golden of matching size at {}", theUpdateCount, aGoldenPath);
+        ImageLib::WritePNGImage(GetFramePath(theUpdateCount, theFrame, ".actual"), theFrame);
+        mNumMismatched++;
+        return false;
+    }
+
+    const int aSize = theFrame->mWidth * theFrame->mHeight;
+    ImageLib::Image aDiffImage(theFrame->mWidth, theFrame->mHeight);
+
+    int aNumBadPixels = 0;
+    int aWorstDiff = 0;
+    for (int i = 0; i < aSize; i++) {
+        const uint32_t aGoldenColor = aGolden->mBits[i];
+        const int aDiff = GetMaxChannelDiff(aGoldenColor, theFrame->mBits[i]);
+        aWorstDiff = std::max(aWorstDiff, aDiff);
+
+        if (aDiff > mTolerance) {
+            aNumBadPixels++;
+            aDiffImage.mBits[i] = 0xFFFF0000;
+        } else {
+            // Dim the golden so the red pixels stand out while the frame stays recognisable.
+            aDiffImage.mBits[i] = 0xFF000000 | ((aGoldenColor >> 2) & 0x003F3F3F);
+        }
+    }
+
+    if (aNumBadPixels == 0) {
+        fmt::println("golden:   frame {} matches (max channel diff {})", theUpdateCount, aWorstDiff);
+        return true;
+    }
+
+    fmt::println(
+        "golden:   frame {} MISMATCH: {} of {} pixels differ by more than {} (max channel diff {})", theUpdateCount,
+        aNumBadPixels, aSize, mTolerance, aWorstDiff
+    );
+    ImageLib::WritePNGImage(GetFramePath(theUpdateCount, theFrame, ".actual"), theFrame);
+    ImageLib::WritePNGImage(GetFramePath(theUpdateCount, theFrame, ".diff"), &aDiffImage);
+    mNumMismatched++;
+    return false;
+}
+
+std::string GoldenFrameHarness::GetSummary() const {
+    if (mUpdateGoldens) return fmt::format("golden:   wrote {} frames to {}", mCaptureFrames.size(), mGoldenDir);
+
+    return fmt::format("golden:   {} of {} frames matched", mNumCompared - mNumMismatched, mNumCompared);
+}
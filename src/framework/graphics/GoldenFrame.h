@@ -0,0 +1,53 @@
+#ifndef __GOLDENFRAME_H__
+#define __GOLDENFRAME_H__
+
+#include "framework/Common.h"
+
+#include <set>
+
+namespace ImageLib {
+class Image;
+};
+
+namespace Sexy {
+/*
+ * Captures the screen image at chosen update counts and compares it against stored PNG goldens. Combined with
+ * demo playback (-play -demofile=...) the update count is deterministic, so the same frame numbers always land on the
+ * same game state and any rendering change that alters the output shows up as a mismatch.
+ *
+ * Goldens are named after the frame number and the captured resolution, so debug (SCALE 1) and release (SCALE 2)
+ * builds keep separate sets. On a mismatch the actual frame and a diff image (bad pixels in red over a dimmed copy of
+ * the golden) are written next to the golden.
+ *
+ * There is no software renderer in the tree, so on a headless box run the Vulkan backend on a software driver
+ * (Mesa lavapipe) inside a virtual X server, e.g.
+ *   xvfb-run ./PlantsVsZombies -play -demofile=lawn.dmo -goldenframes=500,1000,2000 -goldentolerance=2
+ */
+class GoldenFrameHarness {
+public:
+    std::string mGoldenDir = "goldens";
+    std::set<int> mCaptureFrames;
+    int mTolerance = 0;          // Largest per-channel difference still considered equal
+    bool mUpdateGoldens = false; // Write the captured frames as the new goldens instead of comparing
+    bool mExitWhenDone = true;
+
+    int mNumCompared = 0;
+    int mNumMismatched = 0;
+
+public:
+    void SetFrameList(const std::string &theFrameList); // "120,240,600"
+
+    bool IsActive() const { return !mCaptureFrames.empty(); }
+    bool WantsFrame(int theUpdateCount) const { return mCaptureFrames.contains(theUpdateCount); }
+    bool IsDone(int theUpdateCount) const { return IsActive() && theUpdateCount >= *mCaptureFrames.rbegin(); }
+
+    // Returns false if the frame did not match its golden.
+    bool ProcessFrame(int theUpdateCount, const ImageLib::Image *theFrame);
+    std::string GetSummary() const;
+
+protected:
+    std::string GetFramePath(int theUpdateCount, const ImageLib::Image *theFrame, const std::string &theSuffix) const;
+};
+} // namespace Sexy
+
+#endif // __GOLDENFRAME_H__
@@ -426,6 +426,10 @@ bool FontData::HandleCommand(const ListDataElement &theParams) {
             if ((DataToLayer(theParams.mElementVector[1], &aLayer)) &&
                 (DataToString(theParams.mElementVector[2], &aFileNameString))) {
                 std::string aFileName = GetPathFrom(aFileNameString, GetFileDir(mSourceFile));
+                if (mScanImages) {
+                    mScannedImages.push_back(std::move(aFileName));
+                    return true;
+                }
 
                 Image *anImage = mApp->GetSharedImage(aFileName);
 
@@ -725,6 +729,15 @@ bool FontData::Load(SexyAppBase *theSexyApp, const std::string &theFontDescFileN
     return !hasErrors;
 }
 
+StringVector FontData::ScanImageFiles(const std::string &theFontDescFileName) {
+    // No mApp, so errors don't pop up from the worker thread. The real load reports them.
+    FontData aFontData;
+    aFontData.mScanImages = true;
+    aFontData.mSourceFile = theFontDescFileName;
+    aFontData.LoadDescriptor(theFontDescFileName);
+    return std::move(aFontData.mScannedImages);
+}
+
 bool FontData::LoadLegacy(Image * /*theFontImage*/, const std::string & /*theFontDescFileName*/) {
     if (mInitialized) return false;
 
@@ -106,6 +106,10 @@ public:
     std::string mSourceFile;
     std::string mFontErrorHeader;
 
+    // Set while ScanImageFiles runs: LayerSetImage only records its file in mScannedImages.
+    bool mScanImages = false;
+    StringVector mScannedImages;
+
 public:
     bool Error(const std::string &theError) override;
 
@@ -122,6 +126,9 @@ public:
     void DeRef();
 
     bool Load(SexyAppBase *theSexyApp, const std::string &theFontDescFileName);
+    // The image files the layers of theFontDescFileName use, without loading any of them, so it can run on the worker
+    // pool.
+    static StringVector ScanImageFiles(const std::string &theFontDescFileName);
     bool LoadLegacy(Image *theFontImage, const std::string &theFontDescFileName);
 };
 
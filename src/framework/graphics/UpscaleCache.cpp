@@ -0,0 +1,376 @@
+#include "UpscaleCache.h"
+
+#include "VkCommon.h"
+#include "imagelib/ImageLib.h"
+#include "misc/fcaseopen.h"
+#include "paklib/PakInterface.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fmt/core.h>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace fs = std::filesystem;
+
+namespace Vk {
+constexpr uint32_t upscaleCacheMagic = 0x43535055; // "UPSC"
+constexpr uint32_t upscaleCacheVersion = 2;
+
+struct UpscaleCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t width;
+    uint32_t height;
+    uint64_t checksum; // hashBytes of the pixels
+};
+
+struct UpscaleCacheEntry {
+    uint64_t size;
+    uint64_t lastUse;
+};
+
+fs::path upscaleCacheDir;
+uint64_t upscaleCacheMaxBytes = 0;
+uint64_t upscaleCacheBytes = 0;
+uint64_t upscaleCacheClock = 0;
+std::unordered_map<uint64_t, UpscaleCacheEntry> upscaleCacheEntries;
+std::mutex upscaleCacheMutex;
+bool upscaleCacheEnabled = false;
+
+std::atomic<uint32_t> upscaleCacheHits = 0;
+std::atomic<uint32_t> upscaleCacheMisses = 0;
+std::atomic<uint32_t> upscaleCacheEvictions = 0;
+std::atomic<uint32_t> imageResCacheHits = 0;
+std::atomic<uint32_t> imageResCacheMisses = 0;
+std::atomic<int64_t> upscaleCacheLoadNs = 0;
+std::atomic<int64_t> upscaleNs = 0;
+
+static constexpr uint64_t fnvPrime = 1099511628211ull;
+static constexpr uint64_t fnvBasis = 14695981039346656037ull;
+
+static uint64_t hashBytes(uint64_t theHash, const void *theData, size_t theSize) {
+    // FNV-1a, but over 8 byte words for the pixel data so hashing stays well below the cost of the resampler.
+    const auto *aBytes = static_cast<const uint8_t *>(theData);
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= theSize; i += sizeof(uint64_t)) {
+        uint64_t aWord;
+        memcpy(&aWord, aBytes + i, sizeof(uint64_t));
+        theHash = (theHash ^ aWord) * fnvPrime;
+    }
+    for (; i < theSize; i++) {
+        theHash = (theHash ^ aBytes[i]) * fnvPrime;
+    }
+    return theHash;
+}
+
+static fs::path getEntryPath(uint64_t theKey) { return upscaleCacheDir / fmt::format("{:016x}.bin", theKey); }
+
+static bool parseEntryKey(const fs::path &thePath, uint64_t &theKey) {
+    if (thePath.extension() != ".bin") return false;
+
+    const std::string aStem = thePath.stem().string();
+    if (aStem.size() != 16) return false;
+
+    char *anEnd;
+    theKey = strtoull(aStem.c_str(), &anEnd, 16);
+    return *anEnd == '\0';
+}
+
+// this function must be behind the upscaleCacheMutex.
+static void evictUpscaleEntries() {
+    // Trim to 90% so a full cache doesn't evict on every single store.
+    const uint64_t aTarget = upscaleCacheMaxBytes / 10 * 9;
+
+    while (upscaleCacheBytes > aTarget && !upscaleCacheEntries.empty()) {
+        auto anOldest = upscaleCacheEntries.begin();
+        for (auto anItr = upscaleCacheEntries.begin(); anItr != upscaleCacheEntries.end(); ++anItr) {
+            if (anItr->second.lastUse < anOldest->second.lastUse) anOldest = anItr;
+        }
+
+        std::error_code anError;
+        fs::remove(getEntryPath(anOldest->first), anError);
+        upscaleCacheBytes -= anOldest->second.size;
+        upscaleCacheEntries.erase(anOldest);
+        ++upscaleCacheEvictions;
+    }
+}
+
+void initUpscaleCache(const std::string &theDir, uint64_t theSourceSignature, uint64_t theMaxBytes) {
+    std::lock_guard aLock(upscaleCacheMutex);
+
+    upscaleCacheEnabled = false;
+    upscaleCacheEntries.clear();
+    upscaleCacheBytes = 0;
+    upscaleCacheDir = theDir;
+    upscaleCacheMaxBytes = theMaxBytes;
+
+    if (theMaxBytes == 0) return;
+
+    std::error_code anError;
+    const fs::path aSignaturePath = upscaleCacheDir / "signature";
+    const std::string aSignature = fmt::format("{:016x} {} {}", theSourceSignature, SCALE, upscaleCacheVersion);
+
+    std::string anOldSignature;
+    if (FILE *aFile = fopen(aSignaturePath.string().c_str(), "rb")) {
+        char aBuffer[64] = {};
+        anOldSignature = std::string(aBuffer, fread(aBuffer, 1, sizeof(aBuffer) - 1, aFile));
+        fclose(aFile);
+    }
+
+    if (anOldSignature != aSignature) {
+        fs::remove_all(upscaleCacheDir, anError);
+        fs::create_directories(upscaleCacheDir, anError);
+
+        FILE *aFile = fopen(aSignaturePath.string().c_str(), "wb");
+        if (aFile == nullptr) {
+            fmt::println("warning: can't write the upscale cache at {}, caching disabled", upscaleCacheDir.string());
+            return;
+        }
+        fwrite(aSignature.data(), 1, aSignature.size(), aFile);
+        fclose(aFile);
+    }
+
+    for (const auto &anEntry : fs::directory_iterator(upscaleCacheDir, anError)) {
+        uint64_t aKey;
+        if (!anEntry.is_regular_file() || !parseEntryKey(anEntry.path(), aKey)) continue;
+
+        // Use order across runs is approximated by the file times, which loadUpscaled refreshes on every hit.
+        const uint64_t aSize = anEntry.file_size();
+        const auto aTime = anEntry.last_write_time().time_since_epoch().count();
+        upscaleCacheEntries[aKey] = {aSize, static_cast<uint64_t>(aTime)};
+        upscaleCacheBytes += aSize;
+        upscaleCacheClock = std::max(upscaleCacheClock, static_cast<uint64_t>(aTime));
+    }
+
+    upscaleCacheEnabled = true;
+    evictUpscaleEntries();
+}
+
+uint64_t getUpscaleCacheKey(const ImageLib::Image &theImage, const char *theResamplerParams) {
+    const uint32_t aParams[] = {static_cast<uint32_t>(theImage.mWidth), static_cast<uint32_t>(theImage.mHeight), SCALE};
+
+    uint64_t aHash = hashBytes(fnvBasis, aParams, sizeof(aParams));
+    aHash = hashBytes(aHash, theResamplerParams, strlen(theResamplerParams));
+    return hashBytes(aHash, theImage.mBits.get(), theImage.mWidth * theImage.mHeight * sizeof(uint32_t));
+}
+
+// Reads the entry for theKey into the buffer theGetDest returns for its size, which may refuse it by returning null.
+// Entries that can't be read back intact are removed.
+template <typename GetDest> static bool loadEntry(uint64_t theKey, GetDest &&theGetDest) {
+    {
+        std::lock_guard aLock(upscaleCacheMutex);
+        if (!upscaleCacheEnabled || !upscaleCacheEntries.contains(theKey)) return false;
+    }
+
+    const fs::path aPath = getEntryPath(theKey);
+
+    bool aValid = false;
+    if (FILE *aFile = fopen(aPath.string().c_str(), "rb")) {
+        // The pixels are read straight into the destination, stdio's buffer would only add a copy.
+        setvbuf(aFile, nullptr, _IONBF, 0);
+
+        UpscaleCacheHeader aHeader;
+        if (fread(&aHeader, sizeof(aHeader), 1, aFile) == 1 && aHeader.magic == upscaleCacheMagic &&
+            aHeader.version == upscaleCacheVersion) {
+            const size_t aSize = static_cast<size_t>(aHeader.width) * aHeader.height * sizeof(uint32_t);
+            uint32_t *aDest = theGetDest(static_cast<int>(aHeader.width), static_cast<int>(aHeader.height));
+            aValid = aDest != nullptr && fread(aDest, 1, aSize, aFile) == aSize &&
+                     hashBytes(fnvBasis, aDest, aSize) == aHeader.checksum;
+        }
+        fclose(aFile);
+    }
+
+    std::lock_guard aLock(upscaleCacheMutex);
+
+    auto anItr = upscaleCacheEntries.find(theKey);
+    if (!aValid) {
+        // Truncated, corrupt or foreign file, drop it and let the caller produce the pixels again.
+        std::error_code anError;
+        fs::remove(aPath, anError);
+        if (anItr != upscaleCacheEntries.end()) {
+            upscaleCacheBytes -= anItr->second.size;
+            upscaleCacheEntries.erase(anItr);
+        }
+        return false;
+    }
+
+    if (anItr != upscaleCacheEntries.end()) {
+        std::error_code anError;
+        fs::last_write_time(aPath, fs::file_time_type::clock::now(), anError);
+        anItr->second.lastUse = ++upscaleCacheClock;
+    }
+    return true;
+}
+
+static void storeEntry(uint64_t theKey, const uint32_t *theSrc, int theWidth, int theHeight) {
+    {
+        std::lock_guard aLock(upscaleCacheMutex);
+        if (!upscaleCacheEnabled || upscaleCacheEntries.contains(theKey)) return;
+    }
+
+    const size_t aSize = static_cast<size_t>(theWidth) * theHeight * sizeof(uint32_t);
+    const UpscaleCacheHeader aHeader{
+        upscaleCacheMagic, upscaleCacheVersion, static_cast<uint32_t>(theWidth), static_cast<uint32_t>(theHeight),
+        hashBytes(fnvBasis, theSrc, aSize)
+    };
+
+    // Written under a temporary name and renamed so a crash or a second instance never sees a half written entry.
+    const fs::path aPath = getEntryPath(theKey);
+    fs::path aTempPath = aPath;
+    aTempPath += fmt::format(".{}", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+
+    FILE *aFile = fopen(aTempPath.string().c_str(), "wb");
+    if (aFile == nullptr) return;
+
+    const bool aWritten = fwrite(&aHeader, sizeof(aHeader), 1, aFile) == 1 && fwrite(theSrc, 1, aSize, aFile) == aSize;
+    fclose(aFile);
+
+    std::error_code anError;
+    if (aWritten) fs::rename(aTempPath, aPath, anError);
+    if (!aWritten || anError) {
+        fs::remove(aTempPath, anError);
+        return;
+    }
+
+    std::lock_guard aLock(upscaleCacheMutex);
+    const uint64_t anEntrySize = sizeof(aHeader) + aSize;
+    if (upscaleCacheEntries.try_emplace(theKey, UpscaleCacheEntry{anEntrySize, ++upscaleCacheClock}).second) {
+        upscaleCacheBytes += anEntrySize;
+    }
+    evictUpscaleEntries();
+}
+
+bool loadUpscaled(uint64_t theKey, uint32_t *theDest, int theWidth, int theHeight) {
+    const auto aStart = std::chrono::steady_clock::now();
+
+    const bool aLoaded = loadEntry(theKey, [&](int aWidth, int aHeight) {
+        return aWidth == theWidth && aHeight == theHeight ? theDest : nullptr;
+    });
+    if (!aLoaded) {
+        ++upscaleCacheMisses;
+        return false;
+    }
+
+    ++upscaleCacheHits;
+    const auto aLoadTime = std::chrono::steady_clock::now() - aStart;
+    upscaleCacheLoadNs += std::chrono::duration_cast<std::chrono::nanoseconds>(aLoadTime).count();
+    return true;
+}
+
+void storeUpscaled(uint64_t theKey, const uint32_t *theSrc, int theWidth, int theHeight) {
+    storeEntry(theKey, theSrc, theWidth, theHeight);
+}
+
+// Appends the path, size and time of the file ImageLib would read for theName, looking the way GetAnImage does: a loose
+// file before a pak entry, and each image extension in turn when theName has none.
+static void appendSourceStamp(std::string &theParams, const std::string &theName) {
+    const size_t aLastDotPos = theName.rfind('.');
+    const size_t aLastSlashPos = theName.find_last_of("\\/");
+    const bool aHasExtension =
+        aLastDotPos != std::string::npos && (aLastSlashPos == std::string::npos || aLastDotPos > aLastSlashPos);
+
+    for (const char *anExtension : ImageLib::gImageExtensions) {
+        const std::string aFileName = aHasExtension ? theName : theName + anExtension;
+
+        const std::string aFilePath = casepath(aFileName);
+        std::error_code anError;
+        if (!aFilePath.empty() && fs::is_regular_file(aFilePath, anError)) {
+            const auto aWriteTime = fs::last_write_time(aFilePath, anError).time_since_epoch().count();
+            theParams += fmt::format("|{}|{}|{}", aFilePath, fs::file_size(aFilePath, anError), aWriteTime);
+            return;
+        }
+        if (const PakRecord *aPakRecord = gPakInterface->FindPakRecord(aFileName.c_str())) {
+            const uint64_t aWriteTime =
+                static_cast<uint64_t>(aPakRecord->mFileTime.dwHighDateTime) << 32 | aPakRecord->mFileTime.dwLowDateTime;
+            theParams += fmt::format("|{}|{}|{}", aPakRecord->mFileName, aPakRecord->mSize, aWriteTime);
+            return;
+        }
+
+        if (aHasExtension) break;
+    }
+    theParams += "|-";
+}
+
+// The alpha image names ImageLib::GetAlphaImage tries for theName
+static void appendAlphaSourceStamps(std::string &theParams, const std::string &theName) {
+    const size_t aLastSlashPos = theName.find_last_of("\\/");
+    const size_t aBasePos = aLastSlashPos == std::string::npos ? 0 : aLastSlashPos + 1;
+    appendSourceStamp(theParams, theName + "_");
+    appendSourceStamp(theParams, theName.substr(0, aBasePos) + "_" + theName.substr(aBasePos));
+}
+
+uint64_t getImageResCacheKey(const Sexy::ResourceManager::ImageRes &theRes, uint32_t theAlphaComposeColor) {
+    // Everything ImageLib::GetImage and the upscale depend on, the source files included.
+    std::string aParams = fmt::format(
+        "res|{}|{}|{}|{}|{}|{}|{:x}|{}|{}", theRes.mPath, theRes.mAlphaImage, theRes.mAlphaGridImage, theRes.mRows,
+        theRes.mCols, ImageLib::gAutoLoadAlpha, theAlphaComposeColor, SCALE, upscaleResamplerParams
+    );
+    appendSourceStamp(aParams, theRes.mPath);
+    if (ImageLib::gAutoLoadAlpha) appendAlphaSourceStamps(aParams, theRes.mPath);
+    if (!theRes.mAlphaImage.empty()) appendSourceStamp(aParams, theRes.mAlphaImage);
+    if (!theRes.mAlphaGridImage.empty()) {
+        appendSourceStamp(aParams, theRes.mAlphaGridImage);
+        appendAlphaSourceStamps(aParams, theRes.mAlphaGridImage);
+    }
+    return hashBytes(fnvBasis, aParams.data(), aParams.size());
+}
+
+std::unique_ptr<ImageLib::Image> loadImageRes(uint64_t theKey) {
+    const auto aStart = std::chrono::steady_clock::now();
+
+    std::unique_ptr<ImageLib::Image> anImage;
+    const bool aLoaded = loadEntry(theKey, [&](int aWidth, int aHeight) -> uint32_t * {
+        if (aWidth <= 0 || aHeight <= 0 || aWidth % SCALE != 0 || aHeight % SCALE != 0) return nullptr;
+
+        anImage = std::make_unique<ImageLib::Image>(
+            aWidth, aHeight, std::make_unique_for_overwrite<uint32_t[]>(static_cast<size_t>(aWidth) * aHeight)
+        );
+        return anImage->mBits.get();
+    });
+    if (!aLoaded) {
+        ++imageResCacheMisses;
+        return nullptr;
+    }
+
+    ++imageResCacheHits;
+    const auto aLoadTime = std::chrono::steady_clock::now() - aStart;
+    upscaleCacheLoadNs += std::chrono::duration_cast<std::chrono::nanoseconds>(aLoadTime).count();
+    return anImage;
+}
+
+void storeImageRes(uint64_t theKey, const ImageLib::Image &theImage) {
+    storeEntry(theKey, theImage.mBits.get(), theImage.mWidth, theImage.mHeight);
+}
+
+void addUpscaleTime(std::chrono::steady_clock::duration theTime) {
+    upscaleNs += std::chrono::duration_cast<std::chrono::nanoseconds>(theTime).count();
+}
+
+std::string getUpscaleCacheStatsString() {
+    const uint32_t aHits = upscaleCacheHits;
+    const uint32_t aMisses = upscaleCacheMisses;
+    const uint32_t aTotal = aHits + aMisses;
+
+    uint64_t aBytes;
+    {
+        std::lock_guard aLock(upscaleCacheMutex);
+        aBytes = upscaleCacheBytes;
+    }
+
+    const uint32_t aResHits = imageResCacheHits;
+    const uint32_t aResTotal = aResHits + imageResCacheMisses;
+
+    return fmt::format(
+        "upscale cache: {}/{} image hits, {}/{} upscale hits ({:.1f}%), {:.1f} ms loading cached, {:.1f} ms upscaling, "
+        "{} evictions, {} MB on disk",
+        aResHits, aResTotal, aHits, aTotal, aTotal ? 100.0 * aHits / aTotal : 0.0, upscaleCacheLoadNs / 1e6,
+        upscaleNs / 1e6, upscaleCacheEvictions.load(), aBytes / (1024 * 1024)
+    );
+}
+} // namespace Vk
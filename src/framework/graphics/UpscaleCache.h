@@ -0,0 +1,50 @@
+#ifndef UPSCALE_CACHE_H
+#define UPSCALE_CACHE_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "misc/ResourceManager.h"
+
+namespace ImageLib {
+class Image;
+};
+
+namespace Vk {
+/*
+ * On-disk cache for upscaled texture data. Running the resampler on every image is the biggest part of startup in
+ * release builds, so the result is stored under a key made of the source pixels, SCALE and the resampler settings and
+ * read straight back on the next run.
+ *
+ * It also keeps whole image resources: the pixels that get uploaded for an ImageRes (after decoding, alpha merging,
+ * premultiplying and upscaling), keyed by the resource's parameters alone, so a hit skips all of that work including
+ * hashing the source pixels.
+ *
+ * Resource keys include the path, size and time of every file the resource is read from, so a changed or newly added
+ * loose file misses on its own. The cache directory remembers the signature of the paks it was filled from and is
+ * wiped when that changes, which stops entries of replaced art from lingering until eviction. Every entry carries a
+ * checksum of its pixels; entries that don't match are dropped. Past the size cap the least recently used entries are
+ * removed. All functions are safe to call from multiple loading threads.
+ */
+// Part of the upscale cache keys, change it whenever the resampler setup in VkImage::upscale changes.
+constexpr const char *upscaleResamplerParams = "avir 8 resize2";
+
+void initUpscaleCache(const std::string &theDir, uint64_t theSourceSignature, uint64_t theMaxBytes);
+
+uint64_t getUpscaleCacheKey(const ImageLib::Image &theImage, const char *theResamplerParams);
+bool loadUpscaled(uint64_t theKey, uint32_t *theDest, int theWidth, int theHeight);
+void storeUpscaled(uint64_t theKey, const uint32_t *theSrc, int theWidth, int theHeight);
+void addUpscaleTime(std::chrono::steady_clock::duration theTime);
+
+// theAlphaComposeColor is the ImageLib::gAlphaComposeColor the resource gets loaded with.
+uint64_t getImageResCacheKey(const Sexy::ResourceManager::ImageRes &theRes, uint32_t theAlphaComposeColor);
+// The uploaded pixels of the resource, upscaled unless SCALE is 1, or nullptr on a miss.
+std::unique_ptr<ImageLib::Image> loadImageRes(uint64_t theKey);
+void storeImageRes(uint64_t theKey, const ImageLib::Image &theImage);
+
+std::string getUpscaleCacheStatsString();
+} // namespace Vk
+
+#endif // UPSCALE_CACHE_H
@@ -2,7 +2,9 @@
 #define VK_COMMON_H
 
 #include "Color.h"
+#include "VkMemory.h"
 #include "compiler/array.h"
+#include <atomic>
 #include <memory>
 #include <vector>
 #include <vulkan/vulkan_core.h>
@@ -45,6 +47,7 @@ extern VkSampler textureSampler;
 extern VkSampler textureSamplerRepeat;
 
 extern uint32_t currentFrame;
+extern std::atomic<uint64_t> presentedFrames;
 // extern VkImage* otherCachedImage;
 
 extern const std::vector<uint16_t> indices;
@@ -73,14 +76,15 @@ struct UniformBufferObject {
 
 void createBuffer(
     VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer &buffer,
-    VkDeviceMemory &bufferMemory
+    MemoryAllocation &bufferMemory
 );
 
 uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
 
 void flushCommandBuffer();
 void copyBufferToImage(
-    VkCommandBuffer commandBuffer, VkBuffer buffer, ::VkImage image, uint32_t width, uint32_t height
+    VkCommandBuffer commandBuffer, VkBuffer buffer, ::VkImage image, uint32_t width, uint32_t height,
+    VkDeviceSize bufferOffset = 0
 );
 void beginCommandBuffer();
 
@@ -88,13 +92,14 @@ struct deleteInfo {
     std::optional<::VkImage> image;
     std::optional<VkImageView> view;
     std::optional<VkFramebuffer> framebuffer;
-    std::optional<VkDeviceMemory> memory;
+    std::optional<MemoryAllocation> memory;
     std::optional<VkDescriptorSet> set;
     std::optional<VkBuffer> buffer;
 };
 
 void doDeleteInfo(deleteInfo info);
 void deferredDelete(size_t idx);
+void destroyStagingRing();
 } // namespace Vk
 
 #endif // VK_COMMON_H
@@ -1,17 +1,24 @@
 #include "VkImage.h"
 
+#include "UpscaleCache.h"
 #include "VkCommon.h"
 
 #include "TriVertex.h"
 #include "graphics/Color.h"
 #include "misc/SexyMatrix.h"
+#include "misc/WorkerPool.h"
 #include "todlib/FilterEffect.h"
 #include <tuple>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <chrono>
+#include <deque>
+#include <fmt/core.h>
+#include <future>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <unordered_map>
 #include <vulkan/vulkan_core.h>
@@ -53,21 +60,12 @@ namespace Vk {
     return ret;
 }
 
-VkDeviceMemory createImageMemory(::VkImage theImage) {
+MemoryAllocation createImageMemory(::VkImage theImage) {
     VkMemoryRequirements memRequirements;
     vkGetImageMemoryRequirements(device, theImage, &memRequirements);
 
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-
-    VkDeviceMemory ret;
-    if (vkAllocateMemory(device, &allocInfo, nullptr, &ret) != VK_SUCCESS) {
-        throw std::runtime_error("failed to allocate image memory!");
-    }
-
-    vkBindImageMemory(device, theImage, ret, 0);
+    const MemoryAllocation ret = allocateMemory(memRequirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, false);
+    vkBindImageMemory(device, theImage, ret.memory, ret.offset);
 
     return ret;
 }
@@ -137,12 +135,57 @@ VkFramebuffer createFramebuffer(VkImageView theView, int theWidth, int theHeight
 std::atomic imageBufferIdx = 0;
 std::array<std::vector<deleteInfo>, NUM_IMAGE_SWAPS> deleteList;
 
+/*=====================*
+ | STAGING RING BUFFER |
+ *=====================*/
+
+// Every image upload shares one persistently mapped staging buffer instead of allocating its own. Regions are handed
+// out in order and are recycled together with the delete list of the image command buffer that recorded their copy,
+// so the image fences that already guard deferredDelete also guard the ring.
+constexpr VkDeviceSize stagingRingSize = 64 * 1024 * 1024;
+constexpr VkDeviceSize stagingRingAlignment = 256;
+
+struct StagingRegion {
+    VkDeviceSize offset;
+    VkDeviceSize size;
+    size_t bufferIdx;
+};
+
+VkBuffer stagingRingBuffer = VK_NULL_HANDLE;
+MemoryAllocation stagingRingMemory{};
+uint8_t *stagingRingData = nullptr;
+VkDeviceSize stagingRingHead = 0;
+std::deque<StagingRegion> stagingRingRegions;
+
+void retireStagingRegions(size_t idx) {
+    while (!stagingRingRegions.empty() && stagingRingRegions.front().bufferIdx == idx) {
+        stagingRingRegions.pop_front();
+    }
+
+    if (stagingRingRegions.empty()) stagingRingHead = 0;
+}
+
+void destroyStagingRing() {
+    if (stagingRingBuffer == VK_NULL_HANDLE) return;
+
+    vkDestroyBuffer(device, stagingRingBuffer, nullptr);
+    freeMemory(stagingRingMemory);
+
+    stagingRingBuffer = VK_NULL_HANDLE;
+    stagingRingMemory = {};
+    stagingRingData = nullptr;
+    stagingRingRegions.clear();
+    stagingRingHead = 0;
+}
+
 void deferredDelete(size_t idx) {
+    retireStagingRegions(idx);
+
     for (auto &i : deleteList[idx]) {
         if (i.view.has_value()) vkDestroyImageView(device, i.view.value(), nullptr);
         if (i.image.has_value()) vkDestroyImage(device, i.image.value(), nullptr);
         if (i.framebuffer.has_value()) vkDestroyFramebuffer(device, i.framebuffer.value(), nullptr);
-        if (i.memory.has_value()) vkFreeMemory(device, i.memory.value(), nullptr);
+        if (i.memory.has_value()) freeMemory(i.memory.value());
         if (i.set.has_value()) vkFreeDescriptorSets(device, descriptorPool, 1, &i.set.value());
         if (i.buffer.has_value()) vkDestroyBuffer(device, i.buffer.value(), nullptr);
     }
@@ -176,62 +219,183 @@ void endRenderPass() {
 
 void doDeleteInfo(deleteInfo info) { deleteList[imageBufferIdx].emplace_back(info); }
 
-avir::CImageResizer<> ImageResizer(8);
-avir::CImageResizerVars resizeVars;
+std::optional<VkDeviceSize> tryAllocateStagingRegion(VkDeviceSize size) {
+    auto place = [size](VkDeviceSize offset) {
+        stagingRingRegions.push_back({offset, size, static_cast<size_t>(imageBufferIdx)});
+        stagingRingHead = offset + size;
+        return offset;
+    };
+
+    if (stagingRingRegions.empty()) return place(0);
+
+    // The comparisons against the tail are strict so that head == tail always means the ring is empty.
+    const VkDeviceSize tail = stagingRingRegions.front().offset;
+    if (stagingRingHead > tail) {
+        if (stagingRingHead + size <= stagingRingSize) return place(stagingRingHead);
+        if (size < tail) return place(0);
+    } else if (stagingRingHead + size < tail) {
+        return place(stagingRingHead);
+    }
+
+    return std::nullopt;
+}
+
+// this function must be behind the renderMutex.
+VkDeviceSize allocateStagingRegion(VkDeviceSize size) {
+    if (stagingRingBuffer == VK_NULL_HANDLE) {
+        createBuffer(
+            stagingRingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingRingBuffer,
+            stagingRingMemory
+        );
+        stagingRingData = static_cast<uint8_t *>(stagingRingMemory.mapped);
+    }
+
+    size = (size + stagingRingAlignment - 1) & ~(stagingRingAlignment - 1);
+
+    // The ring is full, submit what we have so far. Every flush retires the oldest command buffer's regions, so
+    // after NUM_IMAGE_SWAPS flushes at the latest the whole ring is free again.
+    std::optional<VkDeviceSize> offset;
+    while (!(offset = tryAllocateStagingRegion(size)).has_value()) {
+        flushCommandBuffer();
+    }
+
+    return offset.value();
+}
+
+// Images with more source pixels than this get resampled in row bands spread over the worker pool.
+constexpr int upscaleBandMinPixels = 256 * 256;
+constexpr int upscaleBandMinRows = 64;
+// Set while an evicted image is reloaded under the renderMutex, so its upscale stays on the calling thread rather
+// than waiting on, and helping with, whatever else is queued on the worker pool.
+thread_local bool upscaleOnCallingThread = false;
+
+// Hands avir's row bands to the worker pool. The calling thread takes the first band itself and then helps with
+// whatever else is queued, so a worker resampling a large image never blocks the pool waiting on its own bands.
+class UpscaleThreadPool : public avir::CImageResizerThreadPool {
+public:
+    explicit UpscaleThreadPool(int theWorkloadCount) : mWorkloadCount(theWorkloadCount) {}
+
+    int getSuggestedWorkloadCount() const override { return mWorkloadCount; }
+
+    void addWorkload(CWorkload *const theWorkload) override { mWorkloads.push_back(theWorkload); }
+
+    void startAllWorkloads() override {
+        for (size_t i = 1; i < mWorkloads.size(); i++) {
+            CWorkload *aWorkload = mWorkloads[i];
+            mPending.push_back(GetWorkerPool().Submit([aWorkload] { aWorkload->process(); }));
+        }
+    }
 
-VkImage::VkImage(const ImageLib::Image &theImage) {
+    void waitAllWorkloadsToFinish() override {
+        if (!mWorkloads.empty()) mWorkloads[0]->process();
+
+        for (auto &aFuture : mPending) {
+            while (aFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                if (!GetWorkerPool().RunPendingTask()) aFuture.wait();
+            }
+        }
+        mPending.clear();
+    }
+
+    void removeAllWorkloads() override {
+        mWorkloads.clear();
+        mPending.clear();
+    }
+
+protected:
+    int mWorkloadCount;
+    std::vector<CWorkload *> mWorkloads;
+    std::vector<std::future<void>> mPending;
+};
+
+// Safe to call from any thread, it doesn't touch Vulkan.
+std::unique_ptr<ImageLib::Image> VkImage::upscale(const ImageLib::Image &theImage) {
+    if constexpr (SCALE == 1) return nullptr;
+
+    const int aWidth = theImage.mWidth * SCALE;
+    const int aHeight = theImage.mHeight * SCALE;
+    auto aBits = std::make_unique<uint32_t[]>(aWidth * aHeight);
+    auto anUpscaled = std::make_unique<ImageLib::Image>(aWidth, aHeight, std::move(aBits));
+
+    const uint64_t aCacheKey = getUpscaleCacheKey(theImage, upscaleResamplerParams);
+    if (loadUpscaled(aCacheKey, anUpscaled->mBits.get(), aWidth, aHeight)) return anUpscaled;
+
+    const auto aStart = std::chrono::steady_clock::now();
+
+    // The resampler keeps scratch state, so every thread gets its own.
+    thread_local avir::CImageResizer<> aResizer(8);
+    avir::CImageResizerVars aVars;
+    aVars.IsResize2 = SCALE == 2;
+
+    int aBands = 1;
+    if (!upscaleOnCallingThread && theImage.mWidth * theImage.mHeight >= upscaleBandMinPixels) {
+        aBands = std::clamp(theImage.mHeight / upscaleBandMinRows, 1, GetWorkerPool().GetNumThreads() + 1);
+    }
+
+    UpscaleThreadPool aThreadPool(aBands);
+    if (aBands > 1) aVars.ThreadPool = &aThreadPool;
+
+    aResizer.resizeImage(
+        reinterpret_cast<uint8_t *>(theImage.mBits.get()), theImage.mWidth, theImage.mHeight, 0,
+        reinterpret_cast<uint8_t *>(anUpscaled->mBits.get()), aWidth, aHeight, 4, 0, &aVars
+    );
+    addUpscaleTime(std::chrono::steady_clock::now() - aStart);
+
+    storeUpscaled(aCacheKey, anUpscaled->mBits.get(), aWidth, aHeight);
+    return anUpscaled;
+}
+
+VkImage::VkImage(const ImageLib::Image &theImage) : VkImage(theImage, upscale(theImage).get()) {}
+
+VkImage::VkImage(const ImageLib::Image &theImage, const ImageLib::Image *theUpscaledImage) {
     mWidth = theImage.mWidth;
     mHeight = theImage.mHeight;
 
     if (!mWidth || !mHeight) throw std::runtime_error("Images with no size are not supported.");
+    if (SCALE != 1 && theUpscaledImage == nullptr) throw std::runtime_error("Image was not upscaled.");
 
-    constexpr VkImageUsageFlags flags = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
-                                        VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_STORAGE_BIT;
+    CreateGpuImage(textureSampler);
 
-    image = createImage(mWidth, mHeight, flags);
-    memory = createImageMemory(image);
-    view = createImageView(image, pixelFormat);
-    framebuffer = createFramebuffer(view, mWidth, mHeight);
-    descriptor = createDescriptorSet(view, textureSampler);
+    renderMutex.lock();
+    uploadPixels(theUpscaledImage ? theUpscaledImage->mBits.get() : theImage.mBits.get());
+    renderMutex.unlock();
+}
 
+// this function must be behind the renderMutex.
+void VkImage::uploadPixels(const uint32_t *thePixels) {
     const VkDeviceSize imageSize = mWidth * mHeight * SCALE * SCALE * sizeof(uint32_t);
+
+    if (imageSize <= stagingRingSize) {
+        const VkDeviceSize offset = allocateStagingRegion(imageSize);
+        memcpy(stagingRingData + offset, thePixels, imageSize);
+        uploadNewData(stagingRingBuffer, offset);
+        return;
+    }
+
+    // Too big to ever fit in the ring, give it a staging buffer of its own.
     VkBuffer stagingBuffer;
-    VkDeviceMemory stagingBufferMemory;
+    MemoryAllocation stagingBufferMemory;
 
     createBuffer(
         imageSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, stagingBuffer, stagingBufferMemory
     );
 
-    void *data;
-    vkMapMemory(device, stagingBufferMemory, 0, imageSize, 0, &data);
-    if constexpr (SCALE != 1) {
-        if constexpr (SCALE == 2) {
-            resizeVars.IsResize2 = true;
-        }
+    memcpy(stagingBufferMemory.mapped, thePixels, imageSize);
 
-        // Upscaling is done here
-        ImageResizer.resizeImage(
-            reinterpret_cast<uint8_t *>(theImage.mBits.get()), mWidth, mHeight, 0, static_cast<uint8_t *>(data),
-            mWidth * SCALE, mHeight * SCALE, 4, 0, &resizeVars
-        );
-    } else {
-        memcpy(data, theImage.mBits.get(), imageSize);
-    }
-    vkUnmapMemory(device, stagingBufferMemory);
-
-    renderMutex.lock();
     uploadNewData(stagingBuffer);
     doDeleteInfo(deleteInfo{{}, {}, {}, stagingBufferMemory, {}, stagingBuffer});
-    renderMutex.unlock();
 }
 
 // this function must be behind the renderMutex.
-void VkImage::uploadNewData(VkBuffer stagingBuffer) {
+void VkImage::uploadNewData(VkBuffer stagingBuffer, VkDeviceSize stagingOffset) {
     endRenderPass();
 
     TransitionLayout(imageCommandBuffers[imageBufferIdx], VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-    copyBufferToImage(imageCommandBuffers[imageBufferIdx], stagingBuffer, image, mWidth * SCALE, mHeight * SCALE);
+    copyBufferToImage(
+        imageCommandBuffers[imageBufferIdx], stagingBuffer, image, mWidth * SCALE, mHeight * SCALE, stagingOffset
+    );
 };
 
 VkImage::VkImage(VkImage &theImage) : VkImage(theImage.mWidth, theImage.mHeight, false) {
@@ -244,19 +408,7 @@ VkImage::VkImage(int width, int height, bool initialise, bool textureRepeat) {
 
     if (!mWidth || !mHeight) throw std::runtime_error("Images with no size are not supported.");
 
-    constexpr VkImageUsageFlags flags = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
-                                        VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_STORAGE_BIT;
-
-    image = createImage(mWidth, mHeight, flags);
-    memory = createImageMemory(image);
-    view = createImageView(image, pixelFormat);
-    framebuffer = createFramebuffer(view, mWidth, mHeight);
-
-    if (textureRepeat) {
-        descriptor = createDescriptorSet(view, textureSamplerRepeat);
-    } else {
-        descriptor = createDescriptorSet(view, textureSampler);
-    }
+    CreateGpuImage(textureRepeat ? textureSamplerRepeat : textureSampler);
 
     renderMutex.lock();
 
@@ -280,22 +432,143 @@ VkImage::VkImage(int width, int height, bool initialise, bool textureRepeat) {
 VkImage::~VkImage() {
     renderMutex.lock();
 
-    doDeleteInfo(deleteInfo{image, view, framebuffer, memory, descriptor, {}});
+    if (IsResident()) doDeleteInfo(deleteInfo{image, view, framebuffer, memory, descriptor, {}});
 
     renderMutex.unlock();
 }
 
+void VkImage::CreateGpuImage(VkSampler theSampler) {
+    constexpr VkImageUsageFlags flags = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
+                                        VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_SAMPLED_BIT |
+                                        VK_IMAGE_USAGE_STORAGE_BIT;
+
+    image = createImage(mWidth, mHeight, flags);
+    memory = createImageMemory(image);
+    view = createImageView(image, pixelFormat);
+    framebuffer = createFramebuffer(view, mWidth, mHeight);
+    descriptor = createDescriptorSet(view, theSampler);
+
+    // A new image shouldn't be the first thing the budget evicts, it is about to be drawn.
+    mLastUsedFrame = presentedFrames;
+}
+
+/*=================*
+ | IMAGE RESIDENCY |
+ *=================*/
+
+std::atomic<uint32_t> residentImageHits = 0;
+std::atomic<uint32_t> residentImageMisses = 0;
+std::atomic<uint32_t> residentImageEvictions = 0;
+
+size_t VkImage::GetMemorySize() const {
+    return static_cast<size_t>(mWidth) * mHeight * SCALE * SCALE * sizeof(uint32_t);
+}
+
+bool VkImage::SetReload(std::function<std::unique_ptr<ImageLib::Image>()> theReload) {
+    std::lock_guard aLock(renderMutex);
+    if (mReload) return false;
+
+    mReload = std::move(theReload);
+    return true;
+}
+
+// this function must be behind the renderMutex.
+void VkImage::MakeResident() {
+    if (!mReload) return;
+
+    const uint64_t aLastUsedFrame = mLastUsedFrame.exchange(presentedFrames, std::memory_order_relaxed);
+    if (IsResident()) {
+        // Counted once per frame, not per draw.
+        if (aLastUsedFrame != presentedFrames) ++residentImageHits;
+        return;
+    }
+
+    ++residentImageMisses;
+
+    // Reloaded right here so the draw never shows a wrong frame. It is normally a read from the image cache.
+    upscaleOnCallingThread = true;
+    const std::unique_ptr<ImageLib::Image> aPixels = mReload();
+    upscaleOnCallingThread = false;
+    CreateGpuImage(textureSampler);
+
+    if (aPixels == nullptr || aPixels->mWidth != mWidth * SCALE || aPixels->mHeight != mHeight * SCALE) {
+        // Carry on with a transparent image, and keep it, rather than failing every draw.
+        fmt::println("warning: failed to reload an evicted {}x{} image", mWidth, mHeight);
+        mReload = nullptr;
+        uploadPixels(std::vector<uint32_t>(GetMemorySize() / sizeof(uint32_t)).data());
+        return;
+    }
+
+    uploadPixels(aPixels->mBits.get());
+}
+
+// this function must be behind the renderMutex.
+void VkImage::Evict() {
+    // The open render pass may sample this image, the next draw has to bind the reloaded one.
+    endRenderPass();
+
+    doDeleteInfo(deleteInfo{image, view, framebuffer, memory, descriptor, {}});
+    image = VK_NULL_HANDLE;
+    view = VK_NULL_HANDLE;
+    memory = {};
+    framebuffer = VK_NULL_HANDLE;
+    descriptor = VK_NULL_HANDLE;
+    layout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    ++residentImageEvictions;
+}
+
+void VkImage::EvictToBudget(const std::vector<std::pair<VkImage *, bool>> &theImages, size_t theBudget) {
+    std::lock_guard aLock(renderMutex);
+
+    size_t aResidentBytes = 0;
+    std::vector<VkImage *> aCandidates;
+    for (const auto &[anImage, aPinned] : theImages) {
+        if (!anImage->IsResident()) continue;
+
+        aResidentBytes += anImage->GetMemorySize();
+        if (!aPinned && anImage->mReload && anImage->mLastUsedFrame + 1 < presentedFrames) {
+            aCandidates.push_back(anImage);
+        }
+    }
+
+    if (aResidentBytes <= theBudget) return;
+
+    // Goes down to a low-water mark rather than to the budget itself, so the next few loads don't each evict one
+    // image only to have it drawn and reloaded again.
+    const size_t aLowWater = theBudget / 4 * 3;
+    std::ranges::sort(aCandidates, {}, [](const VkImage *theImage) { return theImage->mLastUsedFrame.load(); });
+    for (VkImage *anImage : aCandidates) {
+        if (aResidentBytes <= aLowWater) break;
+
+        aResidentBytes -= anImage->GetMemorySize();
+        anImage->Evict();
+    }
+}
+
+std::string getImageResidencyStatsString() {
+    const uint32_t aHits = residentImageHits;
+    const uint32_t aMisses = residentImageMisses;
+    const uint32_t aTotal = aHits + aMisses;
+
+    return fmt::format(
+        "image budget: {}/{} resident hits ({:.1f}%), {} reloads, {} evictions", aHits, aTotal,
+        aTotal ? 100.0 * aHits / aTotal : 0.0, aMisses, residentImageEvictions.load()
+    );
+}
+
 /*====================*
  | GRAPHICS FUNCTIONS |
  *====================*/
 
 constexpr auto accessMaskMap =
-    compiler::SparseArray<std::array<std::pair<VkImageLayout, std::pair<VkAccessFlags, VkPipelineStageFlags>>, 5>{
+    compiler::SparseArray<std::array<std::pair<VkImageLayout, std::pair<VkAccessFlags, VkPipelineStageFlags>>, 6>{
         {
          {VK_IMAGE_LAYOUT_UNDEFINED, {0, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT}},
          {VK_IMAGE_LAYOUT_GENERAL,
              {VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT}},
          {VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, {VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT}},
+         {VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, {VK_ACCESS_TRANSFER_READ_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT}},
          {VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
              {VK_ACCESS_SHADER_READ_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT}},
          {VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
@@ -378,6 +651,12 @@ void flushCommandBuffer() {
 void VkImage::applyEffects(VkImage *theSrcImage, VkImage *theDestImage, FilterEffect theFilterEffect) {
     renderMutex.lock();
 
+    if (theDestImage->mReload) {
+        theDestImage->MakeResident();
+        theDestImage->mReload = nullptr;
+    }
+    theSrcImage->MakeResident();
+
     endRenderPass();
 
     constexpr auto newLayout = VK_IMAGE_LAYOUT_GENERAL;
@@ -416,6 +695,48 @@ void VkImage::applyEffects(VkImage *theSrcImage, VkImage *theDestImage, FilterEf
     renderMutex.unlock();
 }
 
+// Copies the image back to the host at its native (SCALE'd) resolution. This stalls the GPU, so it is only meant for
+// debugging tools like the golden frame harness, never for the regular draw path.
+std::unique_ptr<ImageLib::Image> VkImage::ReadPixels() {
+    const uint32_t aWidth = mWidth * SCALE;
+    const uint32_t aHeight = mHeight * SCALE;
+    const VkDeviceSize aSize = aWidth * aHeight * sizeof(uint32_t);
+
+    VkBuffer aReadbackBuffer;
+    MemoryAllocation aReadbackMemory;
+    createBuffer(
+        aSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, aReadbackBuffer, aReadbackMemory
+    );
+
+    renderMutex.lock();
+
+    MakeResident();
+    endRenderPass();
+    TransitionLayout(imageCommandBuffers[imageBufferIdx], VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+
+    VkBufferImageCopy region{};
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.layerCount = 1;
+    region.imageExtent = {aWidth, aHeight, 1};
+    vkCmdCopyImageToBuffer(
+        imageCommandBuffers[imageBufferIdx], image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, aReadbackBuffer, 1, &region
+    );
+
+    flushCommandBuffer();
+    vkQueueWaitIdle(graphicsQueue);
+
+    renderMutex.unlock();
+
+    auto aBits = std::make_unique<uint32_t[]>(aWidth * aHeight);
+    memcpy(aBits.get(), aReadbackMemory.mapped, aSize);
+
+    vkDestroyBuffer(device, aReadbackBuffer, nullptr);
+    freeMemory(aReadbackMemory);
+
+    return std::make_unique<ImageLib::Image>(aWidth, aHeight, std::move(aBits));
+}
+
 std::unique_ptr<VkImage> VkImage::applyEffectsToNewImage(FilterEffect theFilterEffect) {
     auto newImage = std::make_unique<VkImage>(mWidth, mHeight, false);
     newImage->CopyAttributes(this);
@@ -446,6 +767,14 @@ void VkImage::BeginDraw(Image *theImage, int theDrawMode) {
     VkImage *otherImage = nullptr;
 
     otherImage = dynamic_cast<VkImage *>(theImage);
+
+    // Both before anything is recorded, a reload ends the render pass.
+    if (mReload) {
+        MakeResident();
+        mReload = nullptr;
+    }
+    otherImage->MakeResident();
+
     otherCacheMiss = (otherImage != otherCachedImage);
     otherCachedImage = otherImage;
     otherLayoutSuboptimal = (otherImage->layout != VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
@@ -1,12 +1,18 @@
 #ifndef __VK_IMAGE_H__
 #define __VK_IMAGE_H__
 
+#include <atomic>
 #include <cstdio>
+#include <functional>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 #include <vulkan/vulkan.h>
 #include <vulkan/vulkan_core.h>
 
 #include "Image.h"
+#include "VkMemory.h"
 #include "imagelib/ImageLib.h"
 #include "todlib/FilterEffect.h"
 
@@ -16,6 +22,8 @@ namespace Vk {
 class VkImage : public Image {
 public:
     VkImage(const ImageLib::Image &theImage);
+    // theUpscaledImage is the result of upscale(theImage), prepared ahead of time. Only null when SCALE is 1.
+    VkImage(const ImageLib::Image &theImage, const ImageLib::Image *theUpscaledImage);
     VkImage(int width, int height, bool initialise = true, bool textureRepeat = false);
     VkImage(const Image &theImage) = delete;
     VkImage(VkImage &theImage);
@@ -28,16 +36,33 @@ public:
     VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED;
     ::VkImage image = VK_NULL_HANDLE;
     VkImageView view = VK_NULL_HANDLE;
-    VkDeviceMemory memory = VK_NULL_HANDLE;
+    MemoryAllocation memory{};
     VkFramebuffer framebuffer = VK_NULL_HANDLE;
     VkDescriptorSet descriptor = VK_NULL_HANDLE;
 
+    // Lets the image be evicted to keep under the ResourceManager's memory budget. Eviction only drops the GPU copy,
+    // theReload gives back the (upscaled) pixels the next time the image is drawn from. Drawing into the image makes
+    // it permanent again, its contents no longer match the file. Returns false if the image already had a reload.
+    bool SetReload(std::function<std::unique_ptr<ImageLib::Image>()> theReload);
+
+    bool IsResident() const { return image != VK_NULL_HANDLE; }
+    size_t GetMemorySize() const;
+
+    // Once the resident ones go over theBudget bytes, evicts the least recently drawn of theImages until they are back
+    // under three quarters of it. The bool marks pinned images, which count towards the budget but stay, as does
+    // anything drawn in the last frame.
+    static void EvictToBudget(const std::vector<std::pair<VkImage *, bool>> &theImages, size_t theBudget);
+
     void TransitionLayout(VkCommandBuffer commandBuffer, VkImageLayout newLayout);
 
     std::unique_ptr<VkImage> applyEffectsToNewImage(FilterEffect theFilterEffect);
     static void applyEffects(VkImage *theSrcImage, VkImage *theDestImage, FilterEffect theFilterEffect);
     void applyEffectsToSelf(FilterEffect theFilterEffect);
-    void uploadNewData(VkBuffer stagingBuffer);
+    void uploadNewData(VkBuffer stagingBuffer, VkDeviceSize stagingOffset = 0);
+    void uploadPixels(const uint32_t *thePixels);
+    std::unique_ptr<ImageLib::Image> ReadPixels();
+
+    static std::unique_ptr<ImageLib::Image> upscale(const ImageLib::Image &theImage);
 
     bool PolyFill3D(
         const Point theVertices[], int theNumVertices, const Rect *theClipRect, const Color &theColor, int theDrawMode,
@@ -85,6 +110,13 @@ public:
     ) override;
 
 private:
+    std::function<std::unique_ptr<ImageLib::Image>()> mReload;
+    std::atomic<uint64_t> mLastUsedFrame = 0;
+
+    void CreateGpuImage(VkSampler theSampler);
+    void MakeResident();
+    void Evict();
+
     void BltEx(
         Image *theImage, const std::array<glm::vec4, 4> &vertices, const glm::vec4 &theClipRect, const Color &theColor,
         const int theDrawMode, bool blend
@@ -96,6 +128,7 @@ private:
     void BeginDraw(Image *theImage, int theDrawMode);
     void SetViewportAndScissor(const glm::vec4 &theClipRect) const;
 };
+std::string getImageResidencyStatsString();
 } // namespace Vk
 
 #endif // __VK_IMAGE_H__
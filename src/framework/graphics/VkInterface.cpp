@@ -88,7 +88,7 @@ void createDescriptorSetLayouts();
 
 void createImage(
     uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage,
-    VkMemoryPropertyFlags properties, ::VkImage &image, VkDeviceMemory &imageMemory
+    VkMemoryPropertyFlags properties, ::VkImage &image, MemoryAllocation &imageMemory
 );
 
 VkImageView createImageView(::VkImage image, VkFormat format);
@@ -97,7 +97,7 @@ void createTextureImageView();
 
 void createBuffer(
     VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer &buffer,
-    VkDeviceMemory &bufferMemory
+    MemoryAllocation &bufferMemory
 );
 
 void createDescriptorSets();
@@ -221,6 +221,7 @@ double windowImageScale;
 bool framebufferResized = false;
 
 uint32_t currentFrame = 0;
+std::atomic<uint64_t> presentedFrames = 0;
 
 class sdlCursor {
 public:
@@ -444,7 +445,7 @@ void createDescriptorSetLayouts() {
 
 void createImage(
     uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage,
-    VkMemoryPropertyFlags properties, ::VkImage &image, VkDeviceMemory &imageMemory
+    VkMemoryPropertyFlags properties, ::VkImage &image, MemoryAllocation &imageMemory
 ) {
     VkImageCreateInfo imageInfo{};
     imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
@@ -468,16 +469,8 @@ void createImage(
     VkMemoryRequirements memRequirements;
     vkGetImageMemoryRequirements(device, image, &memRequirements);
 
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
-
-    if (vkAllocateMemory(device, &allocInfo, nullptr, &imageMemory) != VK_SUCCESS) {
-        throw std::runtime_error("failed to allocate image memory!");
-    }
-
-    vkBindImageMemory(device, image, imageMemory, 0);
+    imageMemory = allocateMemory(memRequirements, properties, tiling == VK_IMAGE_TILING_LINEAR);
+    vkBindImageMemory(device, image, imageMemory.memory, imageMemory.offset);
 }
 
 VkImageView createImageView(::VkImage image, VkFormat format) {
@@ -534,7 +527,7 @@ void createTextureSampler() {
 
 void createBuffer(
     VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties, VkBuffer &buffer,
-    VkDeviceMemory &bufferMemory
+    MemoryAllocation &bufferMemory
 ) {
     VkBufferCreateInfo bufferInfo{};
     bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -549,16 +542,8 @@ void createBuffer(
     VkMemoryRequirements memRequirements;
     vkGetBufferMemoryRequirements(device, buffer, &memRequirements);
 
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = findMemoryType(memRequirements.memoryTypeBits, properties);
-
-    if (vkAllocateMemory(device, &allocInfo, nullptr, &bufferMemory) != VK_SUCCESS) {
-        throw std::runtime_error("failed to allocate buffer memory!");
-    }
-
-    vkBindBufferMemory(device, buffer, bufferMemory, 0);
+    bufferMemory = allocateMemory(memRequirements, properties, true);
+    vkBindBufferMemory(device, buffer, bufferMemory.memory, bufferMemory.offset);
 }
 
 void createDescriptorSets() {
@@ -640,10 +625,11 @@ void createCommandBuffers() {
 }
 
 void copyBufferToImage(
-    VkCommandBuffer commandBuffer, VkBuffer buffer, ::VkImage image, uint32_t width, uint32_t height
+    VkCommandBuffer commandBuffer, VkBuffer buffer, ::VkImage image, uint32_t width, uint32_t height,
+    VkDeviceSize bufferOffset
 ) {
     VkBufferImageCopy region{};
-    region.bufferOffset = 0;
+    region.bufferOffset = bufferOffset;
     region.bufferRowLength = 0;
     region.bufferImageHeight = 0;
 
@@ -1471,12 +1457,17 @@ VkInterface::~VkInterface() {
     for (int i = 0; i < NUM_IMAGE_SWAPS; ++i) {
         deferredDelete(i);
     }
+    destroyStagingRing();
 
     cleanupSwapChain();
 
     vkDestroySampler(device, textureSampler, nullptr);
 
     delete windowImage;
+    for (int i = 0; i < NUM_IMAGE_SWAPS; ++i) {
+        deferredDelete(i);
+    }
+    destroyMemoryBlocks();
 
     vkDestroyDescriptorPool(device, descriptorPool, nullptr);
     vkDestroyDescriptorSetLayout(device, descriptorSetLayout, nullptr);
@@ -1858,6 +1849,7 @@ void VkInterface::Draw() {
     }
 
     currentFrame = (currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+    ++presentedFrames;
 
     renderMutex.unlock();
 }
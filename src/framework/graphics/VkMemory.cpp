@@ -0,0 +1,244 @@
+#include "VkMemory.h"
+
+#include "VkCommon.h"
+
+#include <algorithm>
+#include <array>
+#include <fmt/core.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace Vk {
+constexpr VkDeviceSize memoryBlockSize = 32 * 1024 * 1024;
+constexpr uint32_t dedicatedBlock = UINT32_MAX;
+
+struct MemoryBlock {
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    uint8_t *mapped = nullptr;
+    std::map<VkDeviceSize, VkDeviceSize> freeRanges; // offset -> size
+    VkDeviceSize used = 0;
+    uint32_t allocationCount = 0;
+};
+
+// Pools are indexed by memory type, linear resources live in the second half.
+std::array<std::vector<std::unique_ptr<MemoryBlock>>, VK_MAX_MEMORY_TYPES * 2> memoryPools;
+std::mutex memoryMutex;
+
+uint32_t liveDeviceAllocations = 0;
+uint32_t deviceAllocationCalls = 0;
+uint32_t dedicatedAllocations = 0;
+VkDeviceSize dedicatedBytes = 0;
+
+static VkDeviceMemory allocateDeviceMemory(VkDeviceSize size, uint32_t memoryType) {
+    VkMemoryAllocateInfo allocInfo{};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = size;
+    allocInfo.memoryTypeIndex = memoryType;
+
+    VkDeviceMemory ret;
+    if (vkAllocateMemory(device, &allocInfo, nullptr, &ret) != VK_SUCCESS) {
+        throw std::runtime_error("failed to allocate device memory!");
+    }
+
+    ++liveDeviceAllocations;
+    ++deviceAllocationCalls;
+
+    return ret;
+}
+
+static void freeDeviceMemory(VkDeviceMemory memory) {
+    vkFreeMemory(device, memory, nullptr);
+    --liveDeviceAllocations;
+}
+
+static std::optional<VkDeviceSize> allocateFromBlock(MemoryBlock &block, VkDeviceSize size, VkDeviceSize alignment) {
+    // First fit. The padding in front of an aligned offset stays in the free list.
+    for (auto it = block.freeRanges.begin(); it != block.freeRanges.end(); ++it) {
+        const auto [rangeOffset, rangeSize] = *it;
+        const VkDeviceSize alignedOffset = (rangeOffset + alignment - 1) / alignment * alignment;
+        if (alignedOffset + size > rangeOffset + rangeSize) continue;
+
+        block.freeRanges.erase(it);
+        if (alignedOffset > rangeOffset) block.freeRanges[rangeOffset] = alignedOffset - rangeOffset;
+        if (alignedOffset + size < rangeOffset + rangeSize)
+            block.freeRanges[alignedOffset + size] = rangeOffset + rangeSize - alignedOffset - size;
+
+        block.used += size;
+        ++block.allocationCount;
+        return alignedOffset;
+    }
+
+    return std::nullopt;
+}
+
+static void freeToBlock(MemoryBlock &block, VkDeviceSize offset, VkDeviceSize size) {
+    block.used -= size;
+    --block.allocationCount;
+
+    auto next = block.freeRanges.lower_bound(offset);
+
+    // Merge with the following range.
+    if (next != block.freeRanges.end() && offset + size == next->first) {
+        size += next->second;
+        next = block.freeRanges.erase(next);
+    }
+
+    // Merge with the preceding range.
+    if (next != block.freeRanges.begin()) {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == offset) {
+            prev->second += size;
+            return;
+        }
+    }
+
+    block.freeRanges[offset] = size;
+}
+
+MemoryAllocation
+allocateMemory(const VkMemoryRequirements &requirements, VkMemoryPropertyFlags properties, bool linear) {
+    const uint32_t memoryType = findMemoryType(requirements.memoryTypeBits, properties);
+    const bool hostVisible = properties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+
+    std::lock_guard aLock(memoryMutex);
+
+    MemoryAllocation ret;
+    ret.size = requirements.size;
+    ret.pool = memoryType + (linear ? VK_MAX_MEMORY_TYPES : 0);
+
+    if (requirements.size > memoryBlockSize / 2) {
+        ret.memory = allocateDeviceMemory(requirements.size, memoryType);
+        ret.block = dedicatedBlock;
+        if (hostVisible) vkMapMemory(device, ret.memory, 0, VK_WHOLE_SIZE, 0, &ret.mapped);
+
+        ++dedicatedAllocations;
+        dedicatedBytes += requirements.size;
+        return ret;
+    }
+
+    auto &aPool = memoryPools[ret.pool];
+
+    for (uint32_t i = 0; i < aPool.size(); ++i) {
+        if (aPool[i] == nullptr) continue;
+
+        auto anOffset = allocateFromBlock(*aPool[i], requirements.size, requirements.alignment);
+        if (anOffset.has_value()) {
+            ret.memory = aPool[i]->memory;
+            ret.offset = anOffset.value();
+            ret.block = i;
+            if (aPool[i]->mapped != nullptr) ret.mapped = aPool[i]->mapped + ret.offset;
+            return ret;
+        }
+    }
+
+    auto aBlock = std::make_unique<MemoryBlock>();
+    aBlock->memory = allocateDeviceMemory(memoryBlockSize, memoryType);
+    aBlock->freeRanges[0] = memoryBlockSize;
+    if (hostVisible) {
+        vkMapMemory(device, aBlock->memory, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void **>(&aBlock->mapped));
+    }
+
+    ret.memory = aBlock->memory;
+    ret.offset = allocateFromBlock(*aBlock, requirements.size, requirements.alignment).value();
+    if (aBlock->mapped != nullptr) ret.mapped = aBlock->mapped + ret.offset;
+
+    // Reuse a slot of a released block so the indices held by live allocations stay valid.
+    auto aFreeSlot = std::find_if(aPool.begin(), aPool.end(), [](auto &b) { return b == nullptr; });
+    ret.block = aFreeSlot - aPool.begin();
+    if (aFreeSlot != aPool.end()) *aFreeSlot = std::move(aBlock);
+    else aPool.push_back(std::move(aBlock));
+
+    return ret;
+}
+
+void freeMemory(const MemoryAllocation &allocation) {
+    if (allocation.memory == VK_NULL_HANDLE) return;
+
+    std::lock_guard aLock(memoryMutex);
+
+    if (allocation.block == dedicatedBlock) {
+        freeDeviceMemory(allocation.memory);
+        --dedicatedAllocations;
+        dedicatedBytes -= allocation.size;
+        return;
+    }
+
+    auto &aPool = memoryPools[allocation.pool];
+    auto &aBlock = aPool[allocation.block];
+    freeToBlock(*aBlock, allocation.offset, allocation.size);
+
+    // Give empty blocks back to the driver, but keep the last one around to avoid thrashing.
+    const auto aLiveBlocks = std::count_if(aPool.begin(), aPool.end(), [](auto &b) { return b != nullptr; });
+    if (aBlock->allocationCount == 0 && aLiveBlocks > 1) {
+        freeDeviceMemory(aBlock->memory);
+        aBlock = nullptr;
+    }
+}
+
+MemoryStats getMemoryStats() {
+    std::lock_guard aLock(memoryMutex);
+
+    MemoryStats ret;
+    ret.deviceAllocations = liveDeviceAllocations;
+    ret.deviceAllocationCalls = deviceAllocationCalls;
+    ret.dedicatedAllocations = dedicatedAllocations;
+    ret.dedicatedBytes = dedicatedBytes;
+
+    VkDeviceSize aLargestFreeTotal = 0;
+    for (auto &aPool : memoryPools) {
+        for (auto &aBlock : aPool) {
+            if (aBlock == nullptr) continue;
+
+            ++ret.blocks;
+            ret.subAllocations += aBlock->allocationCount;
+            ret.bytesReserved += memoryBlockSize;
+            ret.bytesUsed += aBlock->used;
+            ret.freeRanges += aBlock->freeRanges.size();
+
+            VkDeviceSize aLargestFree = 0;
+            for (auto &[anOffset, aSize] : aBlock->freeRanges) {
+                aLargestFree = std::max(aLargestFree, aSize);
+            }
+            aLargestFreeTotal += aLargestFree;
+            ret.largestFreeRange = std::max(ret.largestFreeRange, aLargestFree);
+        }
+    }
+
+    const VkDeviceSize aFreeBytes = ret.bytesReserved - ret.bytesUsed;
+    if (aFreeBytes > 0) {
+        ret.fragmentation = 1.0 - static_cast<double>(aLargestFreeTotal) / static_cast<double>(aFreeBytes);
+    }
+
+    return ret;
+}
+
+std::string getMemoryStatsString() {
+    const MemoryStats aStats = getMemoryStats();
+
+    return fmt::format(
+        "Device Allocations: {} live, {} total vkAllocateMemory calls\n"
+        "Memory Blocks: {} holding {} suballocations\n"
+        "Dedicated Allocations: {} ({} KB)\n"
+        "Block Memory: {}/{} KB used\n"
+        "Fragmentation: {:.1f}% ({} free ranges, largest {} KB)\n",
+        aStats.deviceAllocations, aStats.deviceAllocationCalls, aStats.blocks, aStats.subAllocations,
+        aStats.dedicatedAllocations, aStats.dedicatedBytes / 1024, aStats.bytesUsed / 1024, aStats.bytesReserved / 1024,
+        aStats.fragmentation * 100.0, aStats.freeRanges, aStats.largestFreeRange / 1024
+    );
+}
+
+void destroyMemoryBlocks() {
+    std::lock_guard aLock(memoryMutex);
+
+    for (auto &aPool : memoryPools) {
+        for (auto &aBlock : aPool) {
+            if (aBlock != nullptr) freeDeviceMemory(aBlock->memory);
+        }
+        aPool.clear();
+    }
+}
+} // namespace Vk
@@ -0,0 +1,48 @@
+#ifndef VK_MEMORY_H
+#define VK_MEMORY_H
+
+#include <cstdint>
+#include <string>
+#include <vulkan/vulkan_core.h>
+
+namespace Vk {
+/*
+ * Device memory suballocator. Drivers only guarantee a few thousand live vkAllocateMemory objects and every one is
+ * a kernel call, so images and buffers are carved out of large per memory type blocks instead. Linear (buffer) and
+ * optimal (image) resources get separate blocks so bufferImageGranularity never has to be considered. Requests
+ * bigger than half a block get a dedicated allocation.
+ */
+struct MemoryAllocation {
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkDeviceSize offset = 0;
+    VkDeviceSize size = 0;
+    void *mapped = nullptr; // Only set for host visible memory, which stays mapped for its whole lifetime.
+    uint32_t pool = 0;
+    uint32_t block = 0;
+};
+
+struct MemoryStats {
+    uint32_t deviceAllocations = 0;     // Live VkDeviceMemory objects
+    uint32_t deviceAllocationCalls = 0; // vkAllocateMemory calls since startup
+    uint32_t blocks = 0;
+    uint32_t dedicatedAllocations = 0;
+    uint32_t subAllocations = 0;
+    uint32_t freeRanges = 0;
+    VkDeviceSize dedicatedBytes = 0;
+    VkDeviceSize bytesReserved = 0;
+    VkDeviceSize bytesUsed = 0;
+    VkDeviceSize largestFreeRange = 0;
+
+    // 0 when the free space of every block is one contiguous range, approaching 1 as it gets chopped up.
+    double fragmentation = 0.0;
+};
+
+MemoryAllocation
+allocateMemory(const VkMemoryRequirements &requirements, VkMemoryPropertyFlags properties, bool linear);
+void freeMemory(const MemoryAllocation &allocation);
+MemoryStats getMemoryStats();
+std::string getMemoryStatsString();
+void destroyMemoryBlocks();
+} // namespace Vk
+
+#endif // VK_MEMORY_H
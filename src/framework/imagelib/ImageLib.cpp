@@ -12,22 +12,124 @@
 #include <SDL.h>
 #include <SDL_image.h>
 
+#include <atomic>
+#include <chrono>
 #include <cmath>
+#include <mutex>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
 
 using namespace ImageLib;
 
-std::unique_ptr<Image> GetImageWithSDL(const std::string &theFileName) {
-    PFILE *aPFile = gPakInterface->FOpen(theFileName.c_str(), "rb");
-    if (!aPFile) return nullptr;
+// SDL_RWops reading through the pak interface, so an encrypted pak entry streams into the decoder in the chunks it
+// asks for instead of being copied whole first.
+static SDL_RWops *RWFromPFile(PFILE *thePFile) {
+    SDL_RWops *aRwops = SDL_AllocRW();
+    if (aRwops == nullptr) return nullptr;
+
+    aRwops->type = SDL_RWOPS_UNKNOWN;
+    aRwops->hidden.unknown.data1 = thePFile;
+    aRwops->size = [](SDL_RWops *theContext) -> Sint64 {
+        return static_cast<PFILE *>(theContext->hidden.unknown.data1)->mRecord->mSize;
+    };
+    aRwops->seek = [](SDL_RWops *theContext, Sint64 theOffset, int theWhence) -> Sint64 {
+        PFILE *aPFile = static_cast<PFILE *>(theContext->hidden.unknown.data1);
+        // FSeek takes an unsigned offset, resolve it to an absolute position here
+        Sint64 aPos = theOffset;
+        if (theWhence == RW_SEEK_CUR) aPos += gPakInterface->FTell(aPFile);
+        else if (theWhence == RW_SEEK_END) aPos += aPFile->mRecord->mSize;
+        if (aPos < 0) return SDL_SetError("Seek before the start of %s", aPFile->mRecord->mFileName.c_str());
+
+        gPakInterface->FSeek(aPFile, static_cast<uint32_t>(std::min<Sint64>(aPos, aPFile->mRecord->mSize)), SEEK_SET);
+        return gPakInterface->FTell(aPFile);
+    };
+    aRwops->read = [](SDL_RWops *theContext, void *thePtr, size_t theSize, size_t theCount) -> size_t {
+        PFILE *aPFile = static_cast<PFILE *>(theContext->hidden.unknown.data1);
+        if (theSize == 0 || theCount == 0) return 0;
+        // Whole elements only, like fread
+        const size_t aCount = std::min<size_t>(theCount, (aPFile->mRecord->mSize - aPFile->mPos) / theSize);
+        return gPakInterface->FRead(thePtr, static_cast<int>(theSize), static_cast<int>(aCount), aPFile);
+    };
+    aRwops->write = [](SDL_RWops *, const void *, size_t, size_t) -> size_t {
+        SDL_SetError("Pak files are read only");
+        return 0;
+    };
+    aRwops->close = [](SDL_RWops *theContext) -> int {
+        SDL_FreeRW(theContext);
+        return 0;
+    };
+    return aRwops;
+}
+
+// theDest[i] = thePalette[theIndices[i]], for palettized surfaces. AVX2 gathers eight entries at a time, SSE2 has no
+// gather and leaves them all to the scalar loop.
+static void
+ExpandIndexed(uint32_t *theDest, const uint8_t *theIndices, const uint32_t *thePalette, const int theCount) {
+    int i = 0;
+#if defined(__AVX2__)
+    for (; i + 8 <= theCount; i += 8) {
+        const __m128i anIndexBytes = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(theIndices + i));
+        const __m256i anIndices = _mm256_cvtepu8_epi32(anIndexBytes);
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i *>(theDest + i),
+            _mm256_i32gather_epi32(reinterpret_cast<const int *>(thePalette), anIndices, 4)
+        );
+    }
+#endif
+    for (; i < theCount; i++)
+        theDest[i] = thePalette[theIndices[i]];
+}
+
+// Clears the alpha of the pixels whose color is theKey, which is what SDL_ConvertSurfaceFormat does to a color keyed
+// surface that isn't palettized.
+static void ClearColorKey(uint32_t *theBits, const uint32_t theKey, const int theCount) {
+    int i = 0;
+#if defined(__AVX2__)
+    const __m256i aColorMask8 = _mm256_set1_epi32(0x00FFFFFF);
+    const __m256i anAlphaMask8 = _mm256_set1_epi32(static_cast<int>(0xFF000000));
+    const __m256i aKey8 = _mm256_set1_epi32(static_cast<int>(theKey & 0x00FFFFFF));
+    for (; i + 8 <= theCount; i += 8) {
+        const __m256i aPixels = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(theBits + i));
+        const __m256i aKeyed = _mm256_cmpeq_epi32(_mm256_and_si256(aPixels, aColorMask8), aKey8);
+        const __m256i aKeyedAlpha = _mm256_and_si256(aKeyed, anAlphaMask8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(theBits + i), _mm256_andnot_si256(aKeyedAlpha, aPixels));
+    }
+#endif
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+    const __m128i aColorMask = _mm_set1_epi32(0x00FFFFFF);
+    const __m128i anAlphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000));
+    const __m128i aKey = _mm_set1_epi32(static_cast<int>(theKey & 0x00FFFFFF));
+    for (; i + 4 <= theCount; i += 4) {
+        const __m128i aPixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(theBits + i));
+        const __m128i aKeyed = _mm_cmpeq_epi32(_mm_and_si128(aPixels, aColorMask), aKey);
+        const __m128i aKeyedAlpha = _mm_and_si128(aKeyed, anAlphaMask);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(theBits + i), _mm_andnot_si128(aKeyedAlpha, aPixels));
+    }
+#endif
+    for (; i < theCount; i++)
+        if ((theBits[i] & 0x00FFFFFF) == (theKey & 0x00FFFFFF)) theBits[i] &= 0x00FFFFFF;
+}
+
+// Decodes and closes aPFile
+static std::unique_ptr<Image> GetImageWithSDL(PFILE *aPFile) {
+    // SDL_image initializes its decoders lazily and not thread safely, images are loaded from several threads.
+    static std::once_flag aInitFlag;
+    std::call_once(aInitFlag, [] { IMG_Init(IMG_INIT_JPG | IMG_INIT_PNG); });
 
     SDL_RWops *aRwops = nullptr;
 
-    if (aPFile->mRecord != nullptr) {
-        const auto aDst = alloca(aPFile->mRecord->mSize);
-        gPakInterface->FRead(aDst, aPFile->mRecord->mSize, 1, aPFile);
-        aRwops = SDL_RWFromConstMem(aDst, aPFile->mRecord->mSize);
-    } else {
+    if (aPFile->mRecord == nullptr) {
         aRwops = SDL_RWFromFP(aPFile->mFP, SDL_FALSE);
+    } else if (const void *aData = gPakInterface->GetPlainFileData(aPFile)) {
+        // pak2 entries and inflated ones can be decoded in place
+        aRwops = SDL_RWFromConstMem(aData, aPFile->mRecord->mSize);
+    } else {
+        aRwops = RWFromPFile(aPFile);
     }
 
     if (!aRwops) {
@@ -40,23 +142,73 @@ std::unique_ptr<Image> GetImageWithSDL(const std::string &theFileName) {
 
     if (!aSurface) return nullptr;
 
-    const auto aSurface32 = SDL_ConvertSurfaceFormat(aSurface, SDL_PIXELFORMAT_ARGB8888, 0);
-    SDL_FreeSurface(aSurface);
-
-    if (!aSurface32) return nullptr;
+    // Every pixel gets written below, so skip Image's clearing
+    auto anImage = std::make_unique<Image>(
+        aSurface->w, aSurface->h, std::make_unique_for_overwrite<uint32_t[]>(aSurface->w * aSurface->h)
+    );
 
-    auto anImage = std::make_unique<Image>(aSurface32->w, aSurface32->h);
+    // Convert straight into the image's buffer (a plain copy when the decoder already produced ARGB8888). The color
+    // key is applied the way SDL_ConvertSurfaceFormat would: its pixels keep their color and lose their alpha. 8 bit
+    // palettes are expanded here through a table with the key's entry made transparent, other palettized formats and
+    // RLE surfaces still go through SDL_ConvertSurfaceFormat.
+    bool aConverted = false;
+    uint32_t aColorKey = 0;
+    const bool aHasColorKey = SDL_GetColorKey(aSurface, &aColorKey) == 0;
+    if (SDL_MUSTLOCK(aSurface)) {
+        // Left to SDL_ConvertSurfaceFormat
+    } else if (aSurface->format->format == SDL_PIXELFORMAT_INDEX8) {
+        uint32_t aPalette[256] = {};
+        const SDL_Palette *aSourcePalette = aSurface->format->palette;
+        for (int i = 0; i < std::min(aSourcePalette->ncolors, 256); i++) {
+            const SDL_Color &aColor = aSourcePalette->colors[i];
+            aPalette[i] = aColor.a << 24 | aColor.r << 16 | aColor.g << 8 | aColor.b;
+        }
+        if (aHasColorKey && aColorKey < 256) aPalette[aColorKey] &= 0x00FFFFFF;
 
-    const auto bufferSize = aSurface32->w * aSurface32->h;
+        for (int y = 0; y < aSurface->h; y++) {
+            const auto aRow = static_cast<const uint8_t *>(aSurface->pixels) + y * aSurface->pitch;
+            ExpandIndexed(anImage->mBits.get() + y * aSurface->w, aRow, aPalette, aSurface->w);
+        }
+        aConverted = true;
+    } else if (!SDL_ISPIXELFORMAT_INDEXED(aSurface->format->format)) {
+        aConverted = SDL_ConvertPixels(
+                         aSurface->w, aSurface->h, aSurface->format->format, aSurface->pixels, aSurface->pitch,
+                         SDL_PIXELFORMAT_ARGB8888, anImage->mBits.get(), aSurface->w * sizeof(uint32_t)
+                     ) == 0;
+        if (aConverted && aHasColorKey) {
+            uint8_t r, g, b;
+            SDL_GetRGB(aColorKey, aSurface->format, &r, &g, &b);
+            ClearColorKey(anImage->mBits.get(), r << 16 | g << 8 | b, aSurface->w * aSurface->h);
+        }
+    }
 
-    // Copy the pixels
-    SDL_memcpy(anImage->mBits.get(), aSurface32->pixels, bufferSize * sizeof(uint32_t));
+    if (!aConverted) {
+        const auto aSurface32 = SDL_ConvertSurfaceFormat(aSurface, SDL_PIXELFORMAT_ARGB8888, 0);
+        if (!aSurface32) {
+            SDL_FreeSurface(aSurface);
+            return nullptr;
+        }
 
-    SDL_FreeSurface(aSurface32);
+        for (int y = 0; y < aSurface32->h; y++) {
+            const auto aRow = static_cast<const uint8_t *>(aSurface32->pixels) + y * aSurface32->pitch;
+            SDL_memcpy(anImage->mBits.get() + y * aSurface32->w, aRow, aSurface32->w * sizeof(uint32_t));
+        }
+        SDL_FreeSurface(aSurface32);
+    }
 
+    SDL_FreeSurface(aSurface);
     return anImage;
 }
 
+std::unique_ptr<Image> GetImageWithSDL(const std::string &theFileName) {
+    PFILE *aPFile = gPakInterface->FOpen(theFileName.c_str(), "rb");
+    if (!aPFile) return nullptr;
+
+    return GetImageWithSDL(aPFile);
+}
+
+std::unique_ptr<Image> ImageLib::ReadImageFile(const std::string &theFileName) { return GetImageWithSDL(theFileName); }
+
 bool ImageLib::WriteJPEGImage(const std::string &theFileName, const Image *theImage) {
     const auto aSurface = SDL_CreateRGBSurfaceFrom(
         theImage->mBits.get(), theImage->mWidth, theImage->mHeight, 32, theImage->mWidth * 4, 0x00FF0000, 0x0000FF00,
@@ -195,7 +347,7 @@ bool ImageLib::WriteBMPImage(const std::string &theFileName, const Image *theIma
     return true;
 }
 
-int ImageLib::gAlphaComposeColor = 0xFFFFFF;
+thread_local int ImageLib::gAlphaComposeColor = 0xFFFFFF;
 bool ImageLib::gAutoLoadAlpha = true;
 bool ImageLib::gIgnoreJPEG2000Alpha = true;
 
@@ -223,6 +375,152 @@ template <typename T, size_t N> constexpr std::array<T, N> createLUT(auto fn) {
 const auto sRGBToLinearLut = createLUT<uint16_t, 256>(sRGBToLinear);
 const auto linearToSRGBLut = createLUT<uint8_t, 1024>(linearToSRGB);
 
+// Premultiplied channel for every (alpha, channel) pair, [alpha << 8 | channel], going through the two tables above.
+// Padded so the AVX2 path can gather 32 bits at the last entry.
+static std::array<uint8_t, 256 * 256 + 3> createPremultiplyLUT() {
+    std::array<uint8_t, 256 * 256 + 3> ret{};
+    for (uint32_t alpha = 0; alpha < 256; alpha++) {
+        for (uint32_t c = 0; c < 256; c++) {
+            // 16 bit fixed * 16 bit fixed = 32 bit fixed.
+            // Shift 22 places to fit in a 10 bit LUT.
+            ret[alpha << 8 | c] = linearToSRGBLut[(uint32_t{sRGBToLinearLut[alpha]} * sRGBToLinearLut[c]) >> 22];
+        }
+    }
+    return ret;
+}
+
+const auto premultiplyLut = createPremultiplyLUT();
+
+// The per pixel loops below run over every image while loading. Each has an SSE2/AVX2 body and a scalar tail that
+// also serves builds without either.
+
+// theDest's alpha = theAlpha's blue, as the separate alpha images store it
+static void MergeAlpha(uint32_t *theDest, const uint32_t *theAlpha, const int theCount) {
+    int i = 0;
+#if defined(__AVX2__)
+    for (; i + 8 <= theCount; i += 8) {
+        const __m256i aColor = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(theDest + i));
+        const __m256i anAlpha = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(theAlpha + i));
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i *>(theDest + i),
+            _mm256_or_si256(_mm256_and_si256(aColor, _mm256_set1_epi32(0x00FFFFFF)), _mm256_slli_epi32(anAlpha, 24))
+        );
+    }
+#endif
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+    for (; i + 4 <= theCount; i += 4) {
+        const __m128i aColor = _mm_loadu_si128(reinterpret_cast<const __m128i *>(theDest + i));
+        const __m128i anAlpha = _mm_loadu_si128(reinterpret_cast<const __m128i *>(theAlpha + i));
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i *>(theDest + i),
+            _mm_or_si128(_mm_and_si128(aColor, _mm_set1_epi32(0x00FFFFFF)), _mm_slli_epi32(anAlpha, 24))
+        );
+    }
+#endif
+    for (; i < theCount; i++)
+        theDest[i] = (theDest[i] & 0x00FFFFFF) | ((theAlpha[i] & 0xFF) << 24);
+}
+
+// An alpha image on its own: alpha = its blue, color = theColor
+static void ColorFromAlpha(uint32_t *theBits, const uint32_t theColor, const int theCount) {
+    int i = 0;
+#if defined(__AVX2__)
+    for (; i + 8 <= theCount; i += 8) {
+        const __m256i anAlpha = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(theBits + i));
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i *>(theBits + i),
+            _mm256_or_si256(_mm256_set1_epi32(static_cast<int>(theColor)), _mm256_slli_epi32(anAlpha, 24))
+        );
+    }
+#endif
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+    for (; i + 4 <= theCount; i += 4) {
+        const __m128i anAlpha = _mm_loadu_si128(reinterpret_cast<const __m128i *>(theBits + i));
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i *>(theBits + i),
+            _mm_or_si128(_mm_set1_epi32(static_cast<int>(theColor)), _mm_slli_epi32(anAlpha, 24))
+        );
+    }
+#endif
+    for (; i < theCount; i++)
+        theBits[i] = theColor | ((theBits[i] & 0xFF) << 24);
+}
+
+static uint32_t PremultiplyPixel(const uint32_t thePixel) {
+    const uint8_t *aRow = premultiplyLut.data() + ((thePixel >> 24) << 8);
+    return aRow[(thePixel >> 16) & 0xFF] << 16 | aRow[(thePixel >> 8) & 0xFF] << 8 | aRow[thePixel & 0xFF] |
+           (thePixel & 0xFF000000);
+}
+
+// Fully transparent pixels premultiply to 0, and sprite sheets are mostly made of them, so the SIMD bodies clear runs
+// of those without any lookup. SSE2 has no gather, so its other pixels go through the table one at a time.
+static void PremultiplyAlpha(uint32_t *theBits, const int theCount) {
+    int i = 0;
+#if defined(__AVX2__)
+    const auto aLut = reinterpret_cast<const int *>(premultiplyLut.data());
+    const __m256i aByteMask = _mm256_set1_epi32(0xFF);
+    const __m256i anAlphaMask = _mm256_set1_epi32(static_cast<int>(0xFF000000));
+    for (; i + 8 <= theCount; i += 8) {
+        const __m256i aPixels = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(theBits + i));
+        if (_mm256_testz_si256(aPixels, anAlphaMask)) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(theBits + i), _mm256_setzero_si256());
+            continue;
+        }
+        const __m256i anAlphaRow = _mm256_slli_epi32(_mm256_srli_epi32(aPixels, 24), 8);
+        const __m256i r = _mm256_or_si256(anAlphaRow, _mm256_and_si256(_mm256_srli_epi32(aPixels, 16), aByteMask));
+        const __m256i g = _mm256_or_si256(anAlphaRow, _mm256_and_si256(_mm256_srli_epi32(aPixels, 8), aByteMask));
+        const __m256i b = _mm256_or_si256(anAlphaRow, _mm256_and_si256(aPixels, aByteMask));
+        // Gathers read 32 bits at a byte offset, only the low byte is the entry
+        const __m256i aR = _mm256_and_si256(_mm256_i32gather_epi32(aLut, r, 1), aByteMask);
+        const __m256i aG = _mm256_and_si256(_mm256_i32gather_epi32(aLut, g, 1), aByteMask);
+        const __m256i aB = _mm256_and_si256(_mm256_i32gather_epi32(aLut, b, 1), aByteMask);
+        const __m256i aResult = _mm256_or_si256(
+            _mm256_and_si256(aPixels, anAlphaMask),
+            _mm256_or_si256(_mm256_slli_epi32(aR, 16), _mm256_or_si256(_mm256_slli_epi32(aG, 8), aB))
+        );
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(theBits + i), aResult);
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    const __m128i anAlphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000));
+    for (; i + 4 <= theCount; i += 4) {
+        const __m128i aPixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(theBits + i));
+        const __m128i anAlphas = _mm_and_si128(aPixels, anAlphaMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(anAlphas, _mm_setzero_si128())) == 0xFFFF) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(theBits + i), _mm_setzero_si128());
+            continue;
+        }
+        for (int j = i; j < i + 4; j++)
+            theBits[j] = PremultiplyPixel(theBits[j]);
+    }
+#endif
+    for (; i < theCount; i++)
+        theBits[i] = PremultiplyPixel(theBits[i]);
+}
+
+// Time spent in the kernels above while loading, summed over the threads that load images.
+static std::atomic<uint32_t> imagesLoaded = 0;
+static std::atomic<int64_t> imageLoadNs = 0;
+static std::atomic<int64_t> imageKernelNs = 0;
+
+namespace {
+class KernelTimer {
+    std::chrono::steady_clock::time_point mStart = std::chrono::steady_clock::now();
+
+public:
+    ~KernelTimer() {
+        const auto aTime = std::chrono::steady_clock::now() - mStart;
+        imageKernelNs += std::chrono::duration_cast<std::chrono::nanoseconds>(aTime).count();
+    }
+};
+} // namespace
+
+std::string ImageLib::GetImageLoadStatsString() {
+    return fmt::format(
+        "image loading: {} images, {:.1f} ms in GetImage, {:.1f} ms of it merging and premultiplying alpha",
+        imagesLoaded.load(), imageLoadNs / 1e6, imageKernelNs / 1e6
+    );
+}
+
 std::unique_ptr<ImageLib::Image> GetAnImage(const std::string &theFilename) {
     const int aLastDotPos = theFilename.rfind('.');
     const int aLastSlashPos =
@@ -238,17 +536,31 @@ std::unique_ptr<ImageLib::Image> GetAnImage(const std::string &theFilename) {
 
     std::unique_ptr<Image> anImage = nullptr;
 
-    const std::array<const std::string, 7> supportImageExtensions = {".bmp", ".tga", ".jpg", ".png",
-                                                                     ".gif", ".j2k", ".jp2"};
-
     if (anExt.empty()) {
-        for (const auto &ext : supportImageExtensions) {
-            anImage = GetImageWithSDL(aFilename + ext);
+        // Same order as FOpen for every extension: a loose file first, then the pak. The pak entries sharing this name
+        // come from a single lookup instead of one per extension.
+        const std::vector<PakRecord *> *aPakRecords = gPakInterface->FindPakRecordsByBaseName(aFilename.c_str());
+        for (const char *ext : gImageExtensions) {
+            PFILE *aPFile = gPakInterface->OpenDirectFile((aFilename + ext).c_str(), "rb");
+            if (aPFile == nullptr && aPakRecords != nullptr) {
+                const size_t anExtLength = strlen(ext);
+                for (PakRecord *aPakRecord : *aPakRecords) {
+                    const std::string &aName = aPakRecord->mFileName;
+                    if (aName.size() > anExtLength &&
+                        strcasecmp(aName.c_str() + aName.size() - anExtLength, ext) == 0) {
+                        aPFile = gPakInterface->OpenPakRecord(aPakRecord);
+                        break;
+                    }
+                }
+            }
+            if (aPFile == nullptr) continue;
+
+            anImage = GetImageWithSDL(aPFile);
             if (anImage) break;
         }
     } else {
-        for (const auto &ext : supportImageExtensions) {
-            if (strcasecmp(anExt.c_str(), ext.c_str()) == 0) {
+        for (const char *ext : gImageExtensions) {
+            if (strcasecmp(anExt.c_str(), ext) == 0) {
                 anImage = GetImageWithSDL(theFilename);
                 break;
             }
@@ -281,40 +593,14 @@ std::unique_ptr<ImageLib::Image>
 composeAlphaImage(std::unique_ptr<ImageLib::Image> theImage, std::unique_ptr<ImageLib::Image> theAlphaImage) {
     if (theImage != nullptr) {
         if ((theImage->mWidth == theAlphaImage->mWidth) && (theImage->mHeight == theAlphaImage->mHeight)) {
-            uint32_t *aBits1 = theImage->mBits.get();
-            const uint32_t *aBits2 = theAlphaImage->mBits.get();
-            const int aSize = theImage->mWidth * theImage->mHeight;
-
-            for (int i = 0; i < aSize; i++) {
-                *aBits1 = (*aBits1 & 0x00FFFFFF) | ((*aBits2 & 0xFF) << 24);
-                //*aBits1 = (*aBits1 & 0x00FFFFFF) | (sRGBTolinearLut[(*aBits2 & 0xFF)] << 24);
-                ++aBits1;
-                ++aBits2;
-            }
-        }
-    } else if (gAlphaComposeColor == 0xFFFFFF) {
-        theImage = std::move(theAlphaImage);
-
-        uint32_t *aBits1 = theImage->mBits.get();
-
-        const int aSize = theImage->mWidth * theImage->mHeight;
-        for (int i = 0; i < aSize; i++) {
-            *aBits1 = (0x00FFFFFF) | ((*aBits1 & 0xFF) << 24);
-            //*aBits1 = (0x00FFFFFF) | (sRGBTolinearLut[(*aBits1 & 0xFF)] << 24);
-            ++aBits1;
+            KernelTimer aTimer;
+            MergeAlpha(theImage->mBits.get(), theAlphaImage->mBits.get(), theImage->mWidth * theImage->mHeight);
         }
     } else {
-        const int aColor = gAlphaComposeColor;
+        const uint32_t aColor = gAlphaComposeColor;
         theImage = std::move(theAlphaImage);
-
-        uint32_t *aBits1 = theImage->mBits.get();
-
-        const int aSize = theImage->mWidth * theImage->mHeight;
-        for (int i = 0; i < aSize; i++) {
-            *aBits1 = aColor | ((*aBits1 & 0xFF) << 24);
-            //*aBits1 = aColor | (sRGBTolinearLut[(*aBits1 & 0xFF)] << 24);
-            ++aBits1;
-        }
+        KernelTimer aTimer;
+        ColorFromAlpha(theImage->mBits.get(), aColor, theImage->mWidth * theImage->mHeight);
     }
 
     return theImage;
@@ -325,6 +611,8 @@ ImageLib::GetImage(const Sexy::ResourceManager::ImageRes &theRes, bool lookForAl
     const std::string &theFilename = theRes.mPath;
     if (!gAutoLoadAlpha) lookForAlphaImage = false;
 
+    const auto aStart = std::chrono::steady_clock::now();
+
     std::unique_ptr<Image> anImage = GetAnImage(theFilename);
 
     // Check for alpha images
@@ -348,15 +636,8 @@ ImageLib::GetImage(const Sexy::ResourceManager::ImageRes &theRes, bool lookForAl
         if (anAlphaImage->mWidth != anImage->mWidth || anAlphaImage->mHeight != anImage->mHeight)
             throw std::runtime_error("AlphaImage size mismatch between " + theRes.mPath + " and " + theRes.mAlphaImage);
 
-        uint32_t *aBits1 = anImage->mBits.get();
-        const uint32_t *aBits2 = anAlphaImage->mBits.get();
-        const int aSize = anImage->mWidth * anImage->mHeight;
-
-        for (int i = 0; i < aSize; i++) {
-            *aBits1 = (*aBits1 & 0x00FFFFFF) | ((*aBits2 & 0xFF) << 24);
-            ++aBits1;
-            ++aBits2;
-        }
+        KernelTimer aTimer;
+        MergeAlpha(anImage->mBits.get(), anAlphaImage->mBits.get(), anImage->mWidth * anImage->mHeight);
     }
 
     if (!theRes.mAlphaGridImage.empty()) {
@@ -378,6 +659,7 @@ ImageLib::GetImage(const Sexy::ResourceManager::ImageRes &theRes, bool lookForAl
                 "GridAlphaImage size mismatch between " + theRes.mPath + "and" + theRes.mAlphaGridImage
             );
 
+        KernelTimer aTimer;
         uint32_t *aMasterRowPtr = anImage->mBits.get();
         for (int i = 0; i < aNumRows; i++) {
             uint32_t *aMasterColPtr = aMasterRowPtr;
@@ -385,12 +667,8 @@ ImageLib::GetImage(const Sexy::ResourceManager::ImageRes &theRes, bool lookForAl
                 uint32_t *aRowPtr = aMasterColPtr;
                 const uint32_t *anAlphaBits = anAlphaImage->mBits.get();
                 for (int y = 0; y < aCelHeight; y++) {
-                    uint32_t *aDestPtr = aRowPtr;
-                    for (int x = 0; x < aCelWidth; x++) {
-                        *aDestPtr = (*aDestPtr & 0x00FFFFFF) | ((*anAlphaBits & 0xFF) << 24);
-                        ++anAlphaBits;
-                        ++aDestPtr;
-                    }
+                    MergeAlpha(aRowPtr, anAlphaBits, aCelWidth);
+                    anAlphaBits += aCelWidth;
                     aRowPtr += anImage->mWidth;
                 }
 
@@ -402,27 +680,143 @@ ImageLib::GetImage(const Sexy::ResourceManager::ImageRes &theRes, bool lookForAl
 
     // Premultiply the alpha channel.
     if (anImage != nullptr) {
-        // Premultiply alpha
-        uint32_t *aBitsPtr = anImage->mBits.get();
-
-        for (int y = 0; y < anImage->mHeight; y++) {
-            for (int x = 0; x < anImage->mWidth; x++) {
-                const uint32_t pixel = *aBitsPtr;
-                // sRGBToLinearLut
-                const uint32_t r = sRGBToLinearLut[(pixel & 0x00FF0000) >> 16];
-                const uint32_t g = sRGBToLinearLut[(pixel & 0x0000FF00) >> 8];
-                const uint32_t b = sRGBToLinearLut[pixel & 0x000000FF];
-                const uint32_t alpha = sRGBToLinearLut[((*aBitsPtr & 0xFF000000) >> 24)];
-                *aBitsPtr =
-                    // 16 bit fixed * 16 bit fixed = 32 bit fixed.
-                    // Shift 22 places to fit in a 10 bit LUT.
-                    linearToSRGBLut[((alpha * r) >> 22)] << 16 | linearToSRGBLut[((alpha * g) >> 22)] << 8 |
-                    linearToSRGBLut[((alpha * b) >> 22)] | (*aBitsPtr & 0xFF000000);
-
-                ++aBitsPtr;
+        KernelTimer aTimer;
+        PremultiplyAlpha(anImage->mBits.get(), anImage->mWidth * anImage->mHeight);
+    }
+
+    imagesLoaded++;
+    imageLoadNs +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - aStart).count();
+    return anImage;
+}
+
+// The kernels as they were before they got SIMD bodies, one pixel at a time.
+static uint32_t ScalarMergeAlpha(const uint32_t theColor, const uint32_t theAlpha) {
+    return (theColor & 0x00FFFFFF) | ((theAlpha & 0xFF) << 24);
+}
+
+static uint32_t ScalarColorFromAlpha(const uint32_t theAlpha, const uint32_t theColor) {
+    return theColor | ((theAlpha & 0xFF) << 24);
+}
+
+static uint32_t ScalarClearColorKey(const uint32_t thePixel, const uint32_t theKey) {
+    return (thePixel & 0x00FFFFFF) == (theKey & 0x00FFFFFF) ? thePixel & 0x00FFFFFF : thePixel;
+}
+
+static uint32_t ScalarPremultiply(const uint32_t thePixel) {
+    const uint32_t alpha = sRGBToLinearLut[thePixel >> 24];
+    const uint32_t r = linearToSRGBLut[(alpha * sRGBToLinearLut[(thePixel >> 16) & 0xFF]) >> 22];
+    const uint32_t g = linearToSRGBLut[(alpha * sRGBToLinearLut[(thePixel >> 8) & 0xFF]) >> 22];
+    const uint32_t b = linearToSRGBLut[(alpha * sRGBToLinearLut[thePixel & 0xFF]) >> 22];
+    return (thePixel & 0xFF000000) | r << 16 | g << 8 | b;
+}
+
+bool ImageLib::ImageLibSelfTest() {
+    // Every pair of 8 bit inputs, each pair once in every channel, with the other channels and the run lengths varied
+    // so that the SIMD bodies, the transparent runs and the scalar tails all get their turn.
+    constexpr int PAIRS = 256 * 256;
+    uint32_t aSeed = 0x2545F491;
+    const auto aRand = [&aSeed] {
+        aSeed ^= aSeed << 13;
+        aSeed ^= aSeed >> 17;
+        aSeed ^= aSeed << 5;
+        return aSeed;
+    };
+
+    std::vector<uint32_t> aColors(PAIRS);
+    std::vector<uint32_t> anAlphas(PAIRS);
+    std::vector<uint32_t> aBits(PAIRS);
+    std::vector<uint32_t> anExpected(PAIRS);
+    int aFailures = 0;
+    const auto aCheck = [&](const char *theKernel, const int theChannel) {
+        for (int i = 0; i < PAIRS; i++) {
+            if (aBits[i] == anExpected[i]) continue;
+            if (aFailures++ < 10)
+                fmt::println(
+                    "imagelibselftest: {} channel {} pixel {}: {:08X}, expected {:08X}", theKernel, theChannel, i,
+                    aBits[i], anExpected[i]
+                );
+        }
+    };
+    // Runs theKernel over aBits in runs of 1 to 37 pixels
+    const auto aRunInPieces = [&](auto theKernel) {
+        for (int i = 0, aLength = 1; i < PAIRS; i += aLength, aLength = aLength % 37 + 1)
+            theKernel(i, std::min(aLength, PAIRS - i));
+    };
+
+    for (int aChannel = 0; aChannel < 4; aChannel++) {
+        const int aShift = aChannel * 8;
+        for (int i = 0; i < PAIRS; i++) {
+            const uint32_t aFirst = i >> 8;
+            const uint32_t aSecond = i & 0xFF;
+            // The first byte goes in aChannel of the color, the second in aChannel of the alpha image, other bytes
+            // random
+            aColors[i] = (aRand() & ~(0xFFu << aShift)) | aFirst << aShift;
+            anAlphas[i] = (aRand() & ~(0xFFu << aShift)) | aSecond << aShift;
+        }
+
+        aBits = aColors;
+        for (int i = 0; i < PAIRS; i++)
+            anExpected[i] = ScalarMergeAlpha(aColors[i], anAlphas[i]);
+        aRunInPieces([&](const int theStart, const int theCount) {
+            MergeAlpha(aBits.data() + theStart, anAlphas.data() + theStart, theCount);
+        });
+        aCheck("MergeAlpha", aChannel);
+
+        const uint32_t aColor = aColors[aChannel] & 0x00FFFFFF;
+        aBits = anAlphas;
+        for (int i = 0; i < PAIRS; i++)
+            anExpected[i] = ScalarColorFromAlpha(anAlphas[i], aColor);
+        aRunInPieces([&](const int theStart, const int theCount) {
+            ColorFromAlpha(aBits.data() + theStart, aColor, theCount);
+        });
+        aCheck("ColorFromAlpha", aChannel);
+
+        // (key, pixel) pairs: each key in turn over the 256 pixels that differ from it in aChannel only
+        const uint32_t aKeyBase = aRand() & ~(0xFFu << aShift);
+        for (int i = 0; i < PAIRS; i++) {
+            aBits[i] = (aKeyBase & 0x00FFFFFF) | (aRand() & 0xFF000000);
+            aBits[i] = (aBits[i] & ~(0xFFu << aShift)) | (i & 0xFF) << aShift;
+            anExpected[i] = ScalarClearColorKey(aBits[i], aKeyBase | (i >> 8) << aShift);
+        }
+        aRunInPieces([&](const int theStart, const int theCount) {
+            // Pieces don't cross from one key to the next
+            for (int i = theStart; i < theStart + theCount;) {
+                const int aCount = std::min(theStart + theCount, (i | 0xFF) + 1) - i;
+                ClearColorKey(aBits.data() + i, aKeyBase | (i >> 8) << aShift, aCount);
+                i += aCount;
             }
+        });
+        aCheck("ClearColorKey", aChannel);
+
+        // (alpha, color) pairs in each color channel, alpha first so that runs of transparent pixels come up
+        if (aChannel == 3) continue;
+        for (int i = 0; i < PAIRS; i++) {
+            const uint32_t anAlpha = i >> 8;
+            const uint32_t aValue = i & 0xFF;
+            aBits[i] = (aRand() & ~(0xFFu << aShift) & 0x00FFFFFF) | aValue << aShift | anAlpha << 24;
+            anExpected[i] = ScalarPremultiply(aBits[i]);
         }
+        aRunInPieces([&](const int theStart, const int theCount) {
+            PremultiplyAlpha(aBits.data() + theStart, theCount);
+        });
+        aCheck("PremultiplyAlpha", aChannel);
     }
 
-    return anImage;
+    // Every index through random palettes, some of them with transparent entries
+    std::vector<uint8_t> anIndices(PAIRS);
+    uint32_t aPalette[256];
+    for (uint32_t &anEntry : aPalette)
+        anEntry = aRand() & (aRand() & 1 ? 0xFFFFFFFF : 0x00FFFFFF);
+    for (int i = 0; i < PAIRS; i++) {
+        anIndices[i] = static_cast<uint8_t>(i * 7 + (i >> 8));
+        anExpected[i] = aPalette[anIndices[i]];
+    }
+    aRunInPieces([&](const int theStart, const int theCount) {
+        ExpandIndexed(aBits.data() + theStart, anIndices.data() + theStart, aPalette, theCount);
+    });
+    aCheck("ExpandIndexed", 0);
+
+    fmt::println("imagelibselftest: {}", aFailures == 0 ? "passed" : fmt::format("FAILED, {} pixels", aFailures));
+    return aFailures == 0;
 }
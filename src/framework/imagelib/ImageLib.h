@@ -1,6 +1,7 @@
 #ifndef __IMAGELIB_H__
 #define __IMAGELIB_H__
 
+#include <array>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -27,12 +28,21 @@ bool WriteJPEGImage(const std::string &theFileName, const Image *theImage);
 bool WritePNGImage(const std::string &theFileName, const Image *theImage);
 bool WriteTGAImage(const std::string &theFileName, const Image *theImage);
 bool WriteBMPImage(const std::string &theFileName, const Image *theImage);
-extern int gAlphaComposeColor;
+extern thread_local int gAlphaComposeColor; // per thread, images are decoded on the worker pool
 extern bool gAutoLoadAlpha;
 extern bool gIgnoreJPEG2000Alpha;
 // I've noticed alpha in jpeg2000's that shouldn't have alpha so this defaults to true
 
+// The extensions GetImage tries, in this order, for a file name that has none.
+constexpr std::array<const char *, 7> gImageExtensions = {".bmp", ".tga", ".jpg", ".png", ".gif", ".j2k", ".jp2"};
+
 std::unique_ptr<ImageLib::Image> GetImage(const Sexy::ResourceManager::ImageRes &theFilename, bool lookForAlphaImage);
+// Loads a single image file as-is: no alpha image lookup and no premultiplication.
+std::unique_ptr<ImageLib::Image> ReadImageFile(const std::string &theFileName);
+// Total time spent in GetImage so far, and how much of it went to the alpha kernels.
+std::string GetImageLoadStatsString();
+// -imagelibselftest: checks the alpha and color key kernels against their scalar versions over every 8 bit input.
+bool ImageLibSelfTest();
 
 // void InitJPEG2000();
 // void CloseJPEG2000();
@@ -7,6 +7,8 @@
 // #include "graphics/DDImage.h"
 // #include "graphics/D3DInterface.h"
 #include "graphics/ImageFont.h"
+#include "graphics/VkImage.h"
+#include "WorkerPool.h"
 #include "imagelib/ImageLib.h"
 
 // #define SEXY_PERF_ENABLED
@@ -79,10 +81,21 @@ void ResourceManager::DeleteMap(ResMap &theMap) {
 ///////////////////////////////////////////////////////////////////////////////
 void ResourceManager::DeleteResources(ResMap &theMap, const std::string &theGroup) {
     for (auto anItr = theMap.begin(); anItr != theMap.end(); ++anItr) {
-        if (theGroup.empty() || anItr->second->mResGroup == theGroup) anItr->second->DeleteResource();
+        if (!theGroup.empty() && anItr->second->mResGroup != theGroup) continue;
+
+        if (anItr->second->mType == ResType_Image) ForgetEvictableImage(dynamic_cast<ImageRes *>(anItr->second));
+        anItr->second->DeleteResource();
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void ResourceManager::ForgetEvictableImage(const ImageRes *theRes) {
+    std::lock_guard aLock(mEvictableImageMutex);
+    if (std::erase_if(mEvictableImages, [theRes](const auto &theEntry) { return theEntry.first == theRes; }) != 0)
+        mEvictionListDirty = true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 void ResourceManager::DeleteResources(const std::string &theGroup) {
@@ -451,6 +464,7 @@ bool ResourceManager::DoParseResources() {
     delete mXMLParser;
     mXMLParser = nullptr;
 
+    BindResourceHandles();
     return !mHasFailed;
 }
 
@@ -504,10 +518,27 @@ bool ResourceManager::DoLoadImage(ImageRes *theRes) {
     Image *anImage = gSexyAppBase->GetSharedImage(*theRes);
     ImageLib::gAlphaComposeColor = 0xFFFFFF;
 
+    // Only has something to drop when the shared image already existed and GetImage wasn't called.
+    if (mPreparingImages.erase(theRes) != 0) mApp->DiscardPreparedImage(*theRes);
+    PrepareResources();
+
     if (anImage == nullptr) return Fail(fmt::format("Failed to load image: {}", theRes->mPath));
 
     theRes->mImage = anImage;
 
+    auto aVkImage = dynamic_cast<Vk::VkImage *>(anImage);
+    const bool isEvictable = aVkImage != nullptr && aVkImage->SetReload([aRes = *theRes] {
+        ImageLib::gAlphaComposeColor = aRes.mAlphaColor;
+        PreparedImage aReloaded = SexyAppBase::LoadPreparedImage(aRes);
+        ImageLib::gAlphaComposeColor = 0xFFFFFF;
+        return aReloaded.second ? std::move(aReloaded.second) : std::move(aReloaded.first);
+    });
+    if (isEvictable) {
+        std::lock_guard aLock(mEvictableImageMutex);
+        mEvictableImages.emplace_back(theRes, aVkImage);
+        mEvictionListDirty = true;
+    }
+
     if (theRes->mAnimInfo.mAnimType != AnimType_None) anImage->mAnimInfo = new AnimInfo(theRes->mAnimInfo);
 
     anImage->mNumRows = theRes->mRows;
@@ -570,6 +601,10 @@ bool ResourceManager::DoLoadFont(FontRes *theRes) {
 
     SEXY_PERF_BEGIN("ResourceManager:DoLoadFont");
 
+    // Start all of the font's images at once, ImageFont then waits for each one as it asks for it.
+    auto aPreparingFont = mPreparingFonts.find(theRes);
+    if (aPreparingFont != mPreparingFonts.end()) PrepareFontImages(aPreparingFont->second);
+
     if (theRes->mSysFont) {
         unreachable();
         /* TODO
@@ -623,6 +658,14 @@ bool ResourceManager::DoLoadFont(FontRes *theRes) {
 
     theRes->mFont = aFont;
 
+    if (aPreparingFont != mPreparingFonts.end()) {
+        // Only drops images the descriptor named but the font didn't end up loading.
+        for (const ImageRes &anImageRes : aPreparingFont->second.mImages)
+            mApp->DiscardPreparedImage(anImageRes);
+        mPreparingFonts.erase(aPreparingFont);
+    }
+    PrepareResources();
+
     SEXY_PERF_END("ResourceManager:DoLoadFont");
 
     ResourceLoadedHook(theRes);
@@ -701,6 +744,171 @@ void ResourceManager::StartLoadResources(const std::string &theGroup) {
     mCurResGroup = theGroup;
     mCurResGroupList = &mResGroupMap[theGroup];
     mCurResGroupListItr = mCurResGroupList->begin();
+
+    // Already being prepared when it was the next group, otherwise whatever is prepared belongs to a load that was
+    // aborted.
+    const bool isNextGroup = mNextResGroupList == mCurResGroupList;
+    if (!isNextGroup || mPrepareList != mCurResGroupList) {
+        DiscardPreparedResources();
+        mPrepareList = mCurResGroupList;
+        mPrepareItr = mPrepareList->begin();
+    }
+    if (isNextGroup) mNextResGroupList = nullptr;
+    PrepareResources();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void ResourceManager::PrepareNextGroup(const std::string &theGroup) {
+    if (!mPrepareAhead) return;
+
+    mNextResGroupList = &mResGroupMap[theGroup];
+    PrepareResources();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void ResourceManager::PrepareResources() {
+    if (mPrepareList == nullptr || !mPrepareAhead) return;
+
+    // Bounded so a big group doesn't hold all of its decoded pixels in memory at once. Sounds don't count, their
+    // samples stay in memory once loaded anyway.
+    const size_t aMaxPreparing = 2 * (GetWorkerPool().GetNumThreads() + 1);
+
+    std::erase_if(mPreparingImages, [](const ImageRes *theRes) { return theRes->mImage != nullptr; });
+
+    // Fonts whose descriptor has been read get their images started as soon as there is room.
+    for (auto &[aFontRes, aPreparingFont] : mPreparingFonts) {
+        if (mPreparingImages.size() >= aMaxPreparing) break;
+        if (aPreparingFont.mScanned) continue;
+        if (aPreparingFont.mScan.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            PrepareFontImages(aPreparingFont);
+    }
+
+    while (mPreparingImages.size() < aMaxPreparing) {
+        if (mPrepareItr == mPrepareList->end()) {
+            if (mNextResGroupList == nullptr || mPrepareList == mNextResGroupList) break;
+
+            mPrepareList = mNextResGroupList;
+            mPrepareItr = mPrepareList->begin();
+            continue;
+        }
+
+        BaseRes *aRes = *mPrepareItr++;
+        if (aRes->mFromProgram) continue;
+
+        if (aRes->mType == ResType_Sound) {
+            auto aSoundRes = dynamic_cast<SoundRes *>(aRes);
+            if (aSoundRes->mSoundId == -1) mApp->mSoundManager->PrepareSound(aSoundRes->mPath);
+            continue;
+        }
+
+        if (aRes->mType == ResType_Font) {
+            auto aFontRes = dynamic_cast<FontRes *>(aRes);
+            if (aFontRes->mFont != nullptr || aFontRes->mSysFont || !aFontRes->mImagePath.empty() ||
+                aFontRes->mPath.starts_with("!ref:"))
+                continue;
+
+            mPreparingFonts[aFontRes].mScan =
+                GetWorkerPool().Submit([aPath = aFontRes->mPath] { return FontData::ScanImageFiles(aPath); });
+            continue;
+        }
+
+        if (aRes->mType != ResType_Image) continue;
+
+        auto anImageRes = dynamic_cast<ImageRes *>(aRes);
+        if (anImageRes->mImage != nullptr || !anImageRes->mVariant.empty()) continue;
+
+        mApp->PrepareImage(*anImageRes);
+        mPreparingImages.insert(anImageRes);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void ResourceManager::PrepareFontImages(PreparingFont &theFont) {
+    if (theFont.mScanned) return;
+
+    while (theFont.mScan.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        if (!GetWorkerPool().RunPendingTask()) theFont.mScan.wait();
+    }
+    theFont.mScanned = true;
+
+    // The same ImageRes GetSharedImage makes from a file name, so the prepared image is found under the same key
+    for (const std::string &aFileName : theFont.mScan.get()) {
+        ImageRes &anImageRes = theFont.mImages.emplace_back();
+        anImageRes.mPath = aFileName;
+        anImageRes.mRows = 0;
+        anImageRes.mCols = 0;
+        anImageRes.mAlphaColor = ImageLib::gAlphaComposeColor;
+        mApp->PrepareImage(anImageRes);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void ResourceManager::DiscardPreparedResources() {
+    for (ImageRes *aRes : mPreparingImages) {
+        if (aRes->mImage == nullptr) mApp->DiscardPreparedImage(*aRes);
+    }
+    mPreparingImages.clear();
+
+    // A scan still running finishes on its own, nothing waits for its result.
+    for (const auto &[aFontRes, aPreparingFont] : mPreparingFonts) {
+        for (const ImageRes &anImageRes : aPreparingFont.mImages)
+            mApp->DiscardPreparedImage(anImageRes);
+    }
+    mPreparingFonts.clear();
+
+    // mNextResGroupList stays, it is set ahead of the StartLoadResources that calls this.
+    mPrepareList = nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void ResourceManager::SetImageBudget(size_t theBytes) { mImageBudget = theBytes; }
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void ResourceManager::PinGroup(const std::string &theGroup) {
+    std::lock_guard aLock(mEvictableImageMutex);
+    if (mPinnedGroups[theGroup]++ == 0) mEvictionListDirty = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void ResourceManager::UnpinGroup(const std::string &theGroup) {
+    std::lock_guard aLock(mEvictableImageMutex);
+    auto anItr = mPinnedGroups.find(theGroup);
+    if (anItr == mPinnedGroups.end()) return;
+
+    if (--anItr->second == 0) {
+        mPinnedGroups.erase(anItr);
+        mEvictionListDirty = true;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void ResourceManager::EnforceImageBudget() {
+    if (mImageBudget == 0) return;
+
+    std::lock_guard aLock(mEvictableImageMutex);
+    if (mEvictionListDirty) {
+        mEvictionList.clear();
+        for (const auto &[aRes, aVkImage] : mEvictableImages) {
+            mEvictionList.emplace_back(aVkImage, mPinnedGroups.contains(aRes->mResGroup));
+        }
+        mEvictionListDirty = false;
+    }
+
+    Vk::VkImage::EvictToBudget(mEvictionList, mImageBudget);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+std::string ResourceManager::GetImageBudgetStatsString() {
+    return fmt::format("{}, {} MB budget", Vk::getImageResidencyStatsString(), mImageBudget / (1024 * 1024));
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -737,7 +945,10 @@ bool ResourceManager::LoadResources(const std::string &theGroup) {
     if (!HadError()) {
         mLoadedGroups.insert(theGroup);
         return true;
-    } else return false;
+    }
+
+    DiscardPreparedResources();
+    return false;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -841,6 +1052,80 @@ _Font *ResourceManager::GetFontThrow(const std::string &theId) {
     throw ResourceManagerException(GetErrorText());
 }
 
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void ResourceManager::SetResourceHandles(const char *const *theIds, int theCount) {
+    mResourceHandleIds = theIds;
+    mHandleImages.assign(theCount, nullptr);
+    mHandleSounds.assign(theCount, nullptr);
+    mHandleFonts.assign(theCount, nullptr);
+    BindResourceHandles();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+void ResourceManager::BindResourceHandles() {
+    auto aBind = [this](std::vector<BaseRes *> &theHandles, ResMap &theMap) {
+        for (size_t i = 0; i < theHandles.size(); i++) {
+            auto anItr = theMap.find(mResourceHandleIds[i]);
+            theHandles[i] = anItr != theMap.end() ? anItr->second : nullptr;
+        }
+    };
+    aBind(mHandleImages, mImageMap);
+    aBind(mHandleSounds, mSoundMap);
+    aBind(mHandleFonts, mFontMap);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+std::string ResourceManager::GetResourceHandleName(int theHandle) const {
+    if (theHandle >= 0 && theHandle < static_cast<int>(mHandleImages.size())) return mResourceHandleIds[theHandle];
+    return fmt::format("#{}", theHandle);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+Image *ResourceManager::GetImageThrow(int theHandle) {
+    if (theHandle >= 0 && theHandle < static_cast<int>(mHandleImages.size()) && mHandleImages[theHandle] != nullptr) {
+        const auto aRes = static_cast<ImageRes *>(mHandleImages[theHandle]);
+
+        if (aRes->mImage != nullptr) return aRes->mImage;
+
+        if (mAllowMissingProgramResources && aRes->mFromProgram) return nullptr;
+    }
+
+    Fail(fmt::format("Image resource not found: {}", GetResourceHandleName(theHandle)));
+    throw ResourceManagerException(GetErrorText());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+int ResourceManager::GetSoundThrow(int theHandle) {
+    if (theHandle >= 0 && theHandle < static_cast<int>(mHandleSounds.size()) && mHandleSounds[theHandle] != nullptr) {
+        const auto aRes = static_cast<SoundRes *>(mHandleSounds[theHandle]);
+        if (aRes->mSoundId != -1) return aRes->mSoundId;
+
+        if (mAllowMissingProgramResources && aRes->mFromProgram) return -1;
+    }
+
+    Fail(fmt::format("Sound resource not found: {}", GetResourceHandleName(theHandle)));
+    throw ResourceManagerException(GetErrorText());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+_Font *ResourceManager::GetFontThrow(int theHandle) {
+    if (theHandle >= 0 && theHandle < static_cast<int>(mHandleFonts.size()) && mHandleFonts[theHandle] != nullptr) {
+        const auto aRes = static_cast<FontRes *>(mHandleFonts[theHandle]);
+        if (aRes->mFont != nullptr) return aRes->mFont;
+
+        if (mAllowMissingProgramResources && aRes->mFromProgram) return nullptr;
+    }
+
+    Fail(fmt::format("Font resource not found: {}", GetResourceHandleName(theHandle)));
+    throw ResourceManagerException(GetErrorText());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 void ResourceManager::SetAllowMissingProgramImages(bool allow) { mAllowMissingProgramResources = allow; }
@@ -850,6 +1135,7 @@ void ResourceManager::SetAllowMissingProgramImages(bool allow) { mAllowMissingPr
 bool ResourceManager::ReplaceImage(const std::string &theId, Image *theImage) {
     auto anItr = mImageMap.find(theId);
     if (anItr != mImageMap.end()) {
+        ForgetEvictableImage(dynamic_cast<ImageRes *>(anItr->second));
         anItr->second->DeleteResource();
 
         dynamic_cast<ImageRes *>(anItr->second)->mImage = theImage;
@@ -4,15 +4,23 @@
 #include "framework/Common.h"
 #include "framework/graphics/Font.h"
 #include "framework/graphics/Image.h"
+#include <future>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace ImageLib {
 class Image;
 };
 
+namespace Vk {
+class VkImage;
+}
+
 namespace Sexy {
 class XMLParser;
 class XMLElement;
@@ -116,6 +124,39 @@ public: // @Patoke todo: revert to protected
     ResList *mCurResGroupList;
     ResList::iterator mCurResGroupListItr;
 
+    // Images of the current group are decoded and upscaled on the worker pool a few resources ahead of the loader,
+    // sounds are decoded there too. Only the uploads and the BASS handles get handed over on the loading thread. Once
+    // the current group is all prepared, mPrepareList moves on to mNextResGroupList.
+    ResList *mPrepareList = nullptr;
+    ResList::iterator mPrepareItr;
+    ResList *mNextResGroupList = nullptr;
+    std::set<ImageRes *> mPreparingImages;
+    // Fonts depend on their layer images, which the font descriptor names. The descriptors are read on the pool, then
+    // the images are prepared like the group's own, and the font is built on the loading thread once they are ready.
+    struct PreparingFont {
+        std::future<std::vector<std::string>> mScan;
+        std::vector<ImageRes> mImages;
+        bool mScanned = false;
+    };
+    std::map<FontRes *, PreparingFont> mPreparingFonts;
+    bool mPrepareAhead = true;
+
+    // Loaded images that may be evicted when their GPU memory goes over mImageBudget (0 means no budget). They are
+    // registered on the loading thread, the budget is enforced on the main thread between frames.
+    size_t mImageBudget = 0;
+    std::vector<std::pair<ImageRes *, Vk::VkImage *>> mEvictableImages;
+    std::vector<std::pair<Vk::VkImage *, bool>> mEvictionList;
+    bool mEvictionListDirty = false;
+    std::map<std::string, int> mPinnedGroups;
+    std::mutex mEvictableImageMutex;
+
+    // Resources by handle, the index of their string id in the table given to SetResourceHandles. They are bound
+    // after every parse, since redefining a resource replaces it.
+    const char *const *mResourceHandleIds = nullptr;
+    std::vector<BaseRes *> mHandleImages;
+    std::vector<BaseRes *> mHandleSounds;
+    std::vector<BaseRes *> mHandleFonts;
+
     bool Fail(const std::string &theErrorText);
 
     virtual bool ParseCommonResource(XMLElement &theElement, BaseRes *theRes, ResMap &theMap);
@@ -128,6 +169,8 @@ public: // @Patoke todo: revert to protected
     bool DoParseResources();
     void DeleteMap(ResMap &theMap);
     virtual void DeleteResources(ResMap &theMap, const std::string &theGroup);
+    // Takes theRes's image out of the budget, before it is replaced or deleted.
+    void ForgetEvictableImage(const ImageRes *theRes);
 
     //	bool					LoadAlphaGridImage(ImageRes *theRes, DDImage *theImage);
     //	bool					LoadAlphaImage(ImageRes *theRes, DDImage *theImage);
@@ -136,6 +179,11 @@ public: // @Patoke todo: revert to protected
     virtual bool DoLoadSound(SoundRes *theRes);
 
     static int GetNumResources(const std::string &theGroup, ResMap &theMap);
+    void PrepareResources();
+    void PrepareFontImages(PreparingFont &theFont);
+    void DiscardPreparedResources();
+    void BindResourceHandles();
+    std::string GetResourceHandleName(int theHandle) const;
 
 public:
     ResourceManager(SexyAppBase *theApp);
@@ -157,6 +205,20 @@ public:
     virtual void ResourceLoadedHook(BaseRes *theRes);
 
     virtual void StartLoadResources(const std::string &theGroup);
+    // theGroup is loaded after the current one: its resources are prepared as soon as the current group's are, and
+    // are kept when StartLoadResources gets to it.
+    void PrepareNextGroup(const std::string &theGroup);
+    // Off loads every resource on the loading thread in group order, nothing gets prepared on the worker pool.
+    void SetPrepareAhead(bool thePrepareAhead) { mPrepareAhead = thePrepareAhead; }
+
+    // Caps the GPU memory of the loaded images. Over it the least recently drawn ones outside the pinned groups are
+    // evicted, and reloaded from the image cache when they are drawn again.
+    void SetImageBudget(size_t theBytes);
+    size_t GetImageBudget() const { return mImageBudget; }
+    void PinGroup(const std::string &theGroup);
+    void UnpinGroup(const std::string &theGroup);
+    void EnforceImageBudget();
+    std::string GetImageBudgetStatsString();
     virtual bool LoadResources(const std::string &theGroup);
 
     bool ReplaceImage(const std::string &theId, Image *theImage);
@@ -181,6 +243,29 @@ public:
     virtual int GetSoundThrow(const std::string &theId);
     virtual _Font *GetFontThrow(const std::string &theId);
 
+    // Handle based lookups for the generated resource code, which skip the string maps. theIds are the string ids in
+    // handle order, they must outlive the manager.
+    void SetResourceHandles(const char *const *theIds, int theCount);
+    Image *GetImageThrow(int theHandle);
+    int GetSoundThrow(int theHandle);
+    _Font *GetFontThrow(int theHandle);
+
+    template <typename T>
+        requires std::is_enum_v<T>
+    Image *GetImageThrow(T theHandle) {
+        return GetImageThrow(static_cast<int>(theHandle));
+    }
+    template <typename T>
+        requires std::is_enum_v<T>
+    int GetSoundThrow(T theHandle) {
+        return GetSoundThrow(static_cast<int>(theHandle));
+    }
+    template <typename T>
+        requires std::is_enum_v<T>
+    _Font *GetFontThrow(T theHandle) {
+        return GetFontThrow(static_cast<int>(theHandle));
+    }
+
     void SetAllowMissingProgramImages(bool allow);
 
     virtual void DeleteResources(const std::string &theGroup);
@@ -0,0 +1,65 @@
+#include "WorkerPool.h"
+
+#include <algorithm>
+
+using namespace Sexy;
+
+WorkerPool::WorkerPool(int theNumThreads) {
+    for (int i = 0; i < theNumThreads; i++) {
+        mThreads.emplace_back(&WorkerPool::WorkerProc, this);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard aLock(mMutex);
+        mShutdown = true;
+    }
+    mCondition.notify_all();
+
+    for (auto &aThread : mThreads) {
+        aThread.join();
+    }
+}
+
+void WorkerPool::Push(std::function<void()> theTask) {
+    {
+        std::lock_guard aLock(mMutex);
+        mTasks.push_back(std::move(theTask));
+    }
+    mCondition.notify_one();
+}
+
+void WorkerPool::WorkerProc() {
+    for (;;) {
+        std::function<void()> aTask;
+        {
+            std::unique_lock aLock(mMutex);
+            mCondition.wait(aLock, [this] { return mShutdown || !mTasks.empty(); });
+            // Whatever is still queued at shutdown is dropped, nobody is left to wait for it.
+            if (mShutdown) return;
+
+            aTask = std::move(mTasks.front());
+            mTasks.pop_front();
+        }
+        aTask();
+    }
+}
+
+bool WorkerPool::RunPendingTask() {
+    std::function<void()> aTask;
+    {
+        std::lock_guard aLock(mMutex);
+        if (mTasks.empty()) return false;
+
+        aTask = std::move(mTasks.front());
+        mTasks.pop_front();
+    }
+    aTask();
+    return true;
+}
+
+WorkerPool &Sexy::GetWorkerPool() {
+    static WorkerPool aPool(std::max(static_cast<int>(std::thread::hardware_concurrency()) - 1, 1));
+    return aPool;
+}
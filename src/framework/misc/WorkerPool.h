@@ -0,0 +1,54 @@
+#ifndef __SEXY_WORKERPOOL_H__
+#define __SEXY_WORKERPOOL_H__
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Sexy {
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// Fixed set of threads for CPU heavy loading work (decoding, resampling). Tasks must not touch Vulkan, uploads stay on
+// the thread that owns the image. A task that waits on other tasks should use RunPendingTask() while waiting, so the
+// pool can't deadlock on itself.
+class WorkerPool {
+protected:
+    std::vector<std::thread> mThreads;
+    std::deque<std::function<void()>> mTasks;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mShutdown = false;
+
+    void WorkerProc();
+    void Push(std::function<void()> theTask);
+
+public:
+    explicit WorkerPool(int theNumThreads);
+    ~WorkerPool();
+
+    template <typename F> std::future<std::invoke_result_t<F>> Submit(F &&theTask) {
+        using Result = std::invoke_result_t<F>;
+
+        // std::function needs a copyable target, packaged_task isn't one.
+        auto aTask = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(theTask));
+        std::future<Result> aFuture = aTask->get_future();
+        Push([aTask] { (*aTask)(); });
+        return aFuture;
+    }
+
+    // Runs one queued task on the calling thread, returns false if there was none.
+    bool RunPendingTask();
+    int GetNumThreads() const { return static_cast<int>(mThreads.size()); }
+};
+
+// One worker per core, leaving one for the thread that feeds the pool.
+WorkerPool &GetWorkerPool();
+} // namespace Sexy
+
+#endif // __SEXY_WORKERPOOL_H__
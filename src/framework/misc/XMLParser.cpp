@@ -1,6 +1,12 @@
 #include "XMLParser.h"
 #include "Debug.h"
 #include "paklib/PakInterface.h"
+#include <algorithm>
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
 
 using namespace Sexy;
 
@@ -10,6 +16,12 @@ XMLParser::XMLParser() {
     mAllowComments = false;
     mGetCharFunc = &XMLParser::GetUTF8Char;
     mForcedEncodingType = false;
+    mAllowSourceBuffer = true;
+    mUseSource = false;
+    mSourcePos = 0;
+    mLineCountPos = 0;
+    mPendingEnd = false;
+    mPendingSectionPop = false;
 }
 
 XMLParser::~XMLParser() {
@@ -53,6 +65,8 @@ void XMLParser::Init() {
     mErrorText = _S("");
     mFirstChar = true;
     mByteSwap = false;
+    mPendingEnd = false;
+    mPendingSectionPop = false;
 }
 
 bool XMLParser::AddAttribute(
@@ -225,12 +239,13 @@ bool XMLParser::GetUTF16BEChar(wchar_t *theChar, bool *error) {
 
 bool XMLParser::OpenFile(const std::string &theFileName) {
     mFile = p_fopen(theFileName.c_str(), "r");
+    mUseSource = false;
 
     if (mFile == nullptr) {
         mLineNum = 0;
         Fail(StringToSexyString("Unable to open file " + theFileName));
         return false;
-    } else if (!mForcedEncodingType) {
+    } else if (!mForcedEncodingType && !(mAllowSourceBuffer && LoadSource())) {
         p_fseek(mFile, 0, SEEK_END);
         long aFileLen = p_ftell(mFile);
         p_fseek(mFile, 0, SEEK_SET);
@@ -268,8 +283,60 @@ bool XMLParser::OpenFile(const std::string &theFileName) {
     return true;
 }
 
+static bool IsAscii(const std::string_view theText) {
+    size_t i = 0;
+#if defined(__SSE2__) || defined(_M_X64)
+    __m128i aHighBits = _mm_setzero_si128();
+    for (; i + 16 <= theText.size(); i += 16)
+        aHighBits = _mm_or_si128(aHighBits, _mm_loadu_si128(reinterpret_cast<const __m128i *>(theText.data() + i)));
+    if (_mm_movemask_epi8(aHighBits) != 0) return false;
+#endif
+    return std::all_of(theText.begin() + i, theText.end(), [](const char c) { return static_cast<uint8_t>(c) < 0x80; });
+}
+
+bool XMLParser::LoadSource() {
+    p_fseek(mFile, 0, SEEK_END);
+    const long aFileLen = p_ftell(mFile);
+    p_fseek(mFile, 0, SEEK_SET);
+    if (aFileLen <= 0) return false;
+
+    std::string_view aSource;
+    if (const void *aData = gPakInterface->GetPlainFileData(mFile)) {
+        aSource = std::string_view(static_cast<const char *>(aData), aFileLen);
+    } else {
+        mSourceText.resize(aFileLen);
+        if (p_fread(mSourceText.data(), 1, aFileLen, mFile) != static_cast<size_t>(aFileLen)) {
+            mSourceText.clear();
+            p_fseek(mFile, 0, SEEK_SET);
+            return false;
+        }
+        aSource = mSourceText;
+    }
+
+    // Without a byte order mark the file is read as single bytes, which the scan does too. UTF-16 and UTF-8 with
+    // non-ASCII text need the decoding of the character reader.
+    if (aSource.starts_with("\xFF\xFE") || aSource.starts_with("\xFE\xFF")) {
+        p_fseek(mFile, 0, SEEK_SET);
+        return false;
+    }
+    if (aSource.starts_with("\xEF\xBB\xBF")) {
+        aSource.remove_prefix(3);
+        if (!IsAscii(aSource)) {
+            p_fseek(mFile, 0, SEEK_SET);
+            return false;
+        }
+    }
+
+    mSource = aSource;
+    mSourcePos = 0;
+    mLineCountPos = 0;
+    mUseSource = true;
+    return true;
+}
+
 void XMLParser::SetStringSource(const std::wstring &theString) {
     Init();
+    mUseSource = false;
 
     int aSize = theString.size();
 
@@ -280,7 +347,350 @@ void XMLParser::SetStringSource(const std::wstring &theString) {
 
 void XMLParser::SetStringSource(const std::string &theString) { SetStringSource(StringToWString(theString)); }
 
+SexyString XMLElementView::Decode(std::string_view theText) const {
+    SexyString aText(theText);
+    if (mDecoded || theText.find('&') == std::string_view::npos) return aText;
+
+    return XMLDecodeString(aText);
+}
+
+static bool IsSpace(const char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+// What the character reader takes into a tag name or attribute key before it sees something that needs its handling
+static bool IsNameChar(const char c) {
+    return static_cast<uint8_t>(c) > 32 && c != '"' && c != '<' && c != '>' && c != '/' && c != '=';
+}
+
+// The scans below look at 16 characters at a time under SSE2, through masks of the characters they stop at, and finish
+// the last few one at a time.
+
+#if defined(__SSE2__) || defined(_M_X64)
+static __m128i LoadChars(const std::string_view theText, const size_t thePos) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(theText.data() + thePos));
+}
+
+// 0xFF for the bytes of theChars that are 32 or less, read as unsigned
+static __m128i ControlMask(const __m128i theChars) {
+    const __m128i aSpace = _mm_set1_epi8(32);
+    return _mm_cmpeq_epi8(_mm_max_epu8(theChars, aSpace), aSpace);
+}
+#endif
+
+// The first character from thePos on that isn't white space
+static size_t SkipSpace(const std::string_view theText, size_t thePos) {
+#if defined(__SSE2__) || defined(_M_X64)
+    for (; thePos + 16 <= theText.size(); thePos += 16) {
+        const __m128i aChars = LoadChars(theText, thePos);
+        // '\t' to '\r' are the five bytes that end up at 4 or less after subtracting 9
+        const __m128i aShifted = _mm_sub_epi8(aChars, _mm_set1_epi8(9));
+        const __m128i aSpaces = _mm_or_si128(
+            _mm_cmpeq_epi8(aChars, _mm_set1_epi8(' ')),
+            _mm_cmpeq_epi8(_mm_min_epu8(aShifted, _mm_set1_epi8(4)), aShifted)
+        );
+        const int aStops = ~_mm_movemask_epi8(aSpaces) & 0xFFFF;
+        if (aStops != 0) return thePos + std::countr_zero(static_cast<unsigned int>(aStops));
+    }
+#endif
+    while (thePos < theText.size() && IsSpace(theText[thePos])) thePos++;
+    return thePos;
+}
+
+// The end of the name that starts at thePos. An end tag's name also takes in '/' and '=', as the reader's does.
+static size_t FindNameEnd(const std::string_view theText, size_t thePos, const bool theIsEndTag) {
+#if defined(__SSE2__) || defined(_M_X64)
+    for (; thePos + 16 <= theText.size(); thePos += 16) {
+        const __m128i aChars = LoadChars(theText, thePos);
+        __m128i aStops = _mm_or_si128(ControlMask(aChars), _mm_cmpeq_epi8(aChars, _mm_set1_epi8('"')));
+        aStops = _mm_or_si128(aStops, _mm_cmpeq_epi8(aChars, _mm_set1_epi8('<')));
+        aStops = _mm_or_si128(aStops, _mm_cmpeq_epi8(aChars, _mm_set1_epi8('>')));
+        if (!theIsEndTag) {
+            aStops = _mm_or_si128(aStops, _mm_cmpeq_epi8(aChars, _mm_set1_epi8('/')));
+            aStops = _mm_or_si128(aStops, _mm_cmpeq_epi8(aChars, _mm_set1_epi8('=')));
+        }
+        const int aMask = _mm_movemask_epi8(aStops);
+        if (aMask != 0) return thePos + std::countr_zero(static_cast<unsigned int>(aMask));
+    }
+#endif
+    while (thePos < theText.size()) {
+        const char c = theText[thePos];
+        if (!IsNameChar(c) && !(theIsEndTag && (c == '/' || c == '='))) break;
+        thePos++;
+    }
+    return thePos;
+}
+
+// The first character from thePos on before theEnd that text can't simply run over: white space other than single
+// spaces, control characters, '"' and '>'
+static size_t FindTextStop(const std::string_view theText, size_t thePos, const size_t theEnd) {
+#if defined(__SSE2__) || defined(_M_X64)
+    for (; thePos + 16 <= theEnd; thePos += 16) {
+        const __m128i aChars = LoadChars(theText, thePos);
+        __m128i aStops = _mm_or_si128(ControlMask(aChars), _mm_cmpeq_epi8(aChars, _mm_set1_epi8('"')));
+        aStops = _mm_or_si128(aStops, _mm_cmpeq_epi8(aChars, _mm_set1_epi8('>')));
+        const int aMask = _mm_movemask_epi8(aStops);
+        if (aMask != 0) return thePos + std::countr_zero(static_cast<unsigned int>(aMask));
+    }
+#endif
+    while (thePos < theEnd && static_cast<uint8_t>(theText[thePos]) > 32 && theText[thePos] != '"' &&
+           theText[thePos] != '>')
+        thePos++;
+    return thePos;
+}
+
+// Brings mLineNum up to mSourcePos. Neither the scan nor the character reader count the lines of mSource as they go,
+// they are counted here in one go when a line number is asked for.
+void XMLParser::CountSourceLines() {
+    if (!mUseSource) return;
+
+    mLineNum += std::count(mSource.begin() + mLineCountPos, mSource.begin() + mSourcePos, '\n');
+    mLineCountPos = mSourcePos;
+}
+
+void XMLParser::PopSection() {
+    mPendingSectionPop = false;
+
+    const size_t aLastSlash = mSection.rfind(_S('/'));
+    if (aLastSlash == SexyString::npos) mSection.clear();
+    else mSection.erase(aLastSlash);
+}
+
+// Reads the next element the way the character reader would, leaving the text in place. Returns false before consuming
+// an element that needs the character reader, otherwise theResult is what NextElement returns.
+bool XMLParser::ScanElement(XMLElementView *theElement, bool *theResult) {
+    const std::string_view aSrc = mSource;
+    const size_t aEnd = aSrc.size();
+    auto aSkipSpace = [aSrc](const size_t thePos) { return SkipSpace(aSrc, thePos); };
+    auto aConsume = [&](const size_t thePos) { mSourcePos = thePos; };
+
+    for (;;) {
+        theElement->mType = XMLElement::TYPE_NONE;
+        theElement->mSection = mSection;
+        theElement->mValue = {};
+        theElement->mInstruction = {};
+        theElement->mAttributes.clear();
+        theElement->mDecoded = false;
+
+        if (mPendingEnd) {
+            mPendingEnd = false;
+            mPendingSectionPop = true;
+            const size_t aLastSlash = mSection.rfind(_S('/'));
+            theElement->mType = XMLElement::TYPE_END;
+            theElement->mValue = theElement->mSection.substr(aLastSlash == SexyString::npos ? 0 : aLastSlash + 1);
+            *theResult = true;
+            return true;
+        }
+
+        const size_t aStart = aSkipSpace(mSourcePos);
+        if (aStart == aEnd) {
+            aConsume(aEnd);
+            *theResult = false;
+            return true;
+        }
+
+        if (aSrc[aStart] != '<') {
+            // Text, with its runs of white space collapsed to one space and the trailing ones dropped
+            const size_t aTextEnd = aSrc.find('<', aStart);
+            if (aTextEnd == std::string_view::npos) return false;
+
+            size_t aLast = aStart;
+            bool aCollapse = false;
+            for (size_t i = aStart; i < aTextEnd; i++) {
+                const size_t aRunEnd = FindTextStop(aSrc, i, aTextEnd);
+                if (aRunEnd != i) {
+                    aLast = aRunEnd - 1;
+                    i = aRunEnd - 1;
+                    continue;
+                }
+
+                const char c = aSrc[i];
+                if (c == '"' || c == '>') return false;
+                if (c == ' ') {
+                    aCollapse |= aSrc[i - 1] == ' ';
+                } else if (IsSpace(c)) {
+                    aCollapse = true;
+                } else {
+                    return false;
+                }
+            }
+
+            const std::string_view aText = aSrc.substr(aStart, aLast + 1 - aStart);
+            if (aCollapse) {
+                mScanText.clear();
+                for (size_t i = 0; i < aText.size(); i++) {
+                    if (!IsSpace(aText[i])) mScanText += aText[i];
+                    else if (!IsSpace(aText[i - 1])) mScanText += ' ';
+                }
+                theElement->mValue = mScanText;
+            } else {
+                theElement->mValue = aText;
+            }
+
+            theElement->mType = XMLElement::TYPE_ELEMENT;
+            aConsume(aTextEnd);
+            *theResult = true;
+            return true;
+        }
+
+        size_t aPos = aStart + 1;
+        if (aPos < aEnd && aSrc[aPos] == '/') {
+            aPos++;
+            const size_t aNameStart = aPos;
+            aPos = FindNameEnd(aSrc, aPos, true);
+            const std::string_view aName = aSrc.substr(aNameStart, aPos - aNameStart);
+            aPos = aSkipSpace(aPos);
+            if (aName.empty() || aPos == aEnd || aSrc[aPos] != '>') return false;
+            aConsume(aPos + 1);
+            theElement->mType = XMLElement::TYPE_END;
+            theElement->mValue = aName;
+            theElement->mDecoded = true; // the failures below happen before the reader decodes the name
+
+            const size_t aLastSlash = mSection.rfind(_S('/'));
+            if (aLastSlash == SexyString::npos && mSection.empty()) {
+                Fail(_S("Unexpected End"));
+                *theResult = false;
+                return true;
+            }
+
+            const std::string_view aLastSectionName = theElement->mSection.substr(
+                aLastSlash == SexyString::npos ? 0 : aLastSlash + 1
+            );
+            if (aLastSectionName != aName) {
+                Fail(
+                    _S("End '") + SexyString(aName) + _S("' Doesn't Match Start '") + SexyString(aLastSectionName) +
+                    _S("'")
+                );
+                *theResult = false;
+                return true;
+            }
+
+            mPendingSectionPop = true;
+            theElement->mDecoded = false;
+            *theResult = true;
+            return true;
+        }
+
+        const size_t aNameStart = aPos;
+        aPos = FindNameEnd(aSrc, aPos, false);
+        const std::string_view aName = aSrc.substr(aNameStart, aPos - aNameStart);
+        if (aName.empty() || aPos == aEnd || aName[0] == '?') return false;
+
+        if (aName[0] == '!') {
+            if (aName != "!--" || !IsSpace(aSrc[aPos])) return false;
+
+            const size_t aCommentEnd = aSrc.find("-->", aPos + 1);
+            if (aCommentEnd == std::string_view::npos) return false;
+
+            aConsume(aCommentEnd + 3);
+            if (!mAllowComments) continue;
+
+            theElement->mType = XMLElement::TYPE_COMMENT;
+            theElement->mValue = aName;
+            theElement->mInstruction = aSrc.substr(aPos + 1, aCommentEnd - aPos - 1);
+            *theResult = true;
+            return true;
+        }
+
+        // Only quoted attributes, each after white space. The character reader converts attributes from CP1252, ends
+        // an element whose last value ends in '/' and decodes a value followed directly by "/>" twice, those are left
+        // to it.
+        bool aSelfClosing = false;
+        for (;;) {
+            const size_t aNext = aSkipSpace(aPos);
+            const bool aHadSpace = aNext != aPos;
+            aPos = aNext;
+            if (aPos == aEnd) return false;
+
+            if (aSrc[aPos] == '>') {
+                if (!theElement->mAttributes.empty() && theElement->mAttributes.back().second.ends_with('/'))
+                    return false;
+                aPos++;
+                break;
+            }
+            if (aSrc[aPos] == '/') {
+                if (aPos + 1 == aEnd || aSrc[aPos + 1] != '>') return false;
+                if (!aHadSpace && !theElement->mAttributes.empty() &&
+                    theElement->mAttributes.back().second.find('&') != std::string_view::npos)
+                    return false;
+                aSelfClosing = true;
+                aPos += 2;
+                break;
+            }
+            if (!aHadSpace) return false;
+
+            const size_t aKeyStart = aPos;
+            aPos = FindNameEnd(aSrc, aPos, false);
+            const std::string_view aKey = aSrc.substr(aKeyStart, aPos - aKeyStart);
+            aPos = aSkipSpace(aPos);
+            if (aKey.empty() || aPos == aEnd || aSrc[aPos] != '=') return false;
+            aPos = aSkipSpace(aPos + 1);
+            if (aPos == aEnd || aSrc[aPos] != '"') return false;
+
+            const size_t aValueEnd = aSrc.find('"', aPos + 1);
+            if (aValueEnd == std::string_view::npos) return false;
+            const std::string_view aValue = aSrc.substr(aPos + 1, aValueEnd - aPos - 1);
+            theElement->mAttributes.emplace_back(aKey, aValue);
+            aPos = aValueEnd + 1;
+        }
+        // Non-ASCII attributes need the reader's CP1252 conversion, and a self-closing tag with a non-ASCII name needs
+        // an end the reader can read back. One check over the whole tag covers both, and hands the reader the rare
+        // other non-ASCII names too.
+        if (!IsAscii(aSrc.substr(aStart, aPos - aStart))) return false;
+        aConsume(aPos);
+
+        const size_t aSectionLen = mSection.size();
+        if (!mSection.empty()) mSection += _S("/");
+        mSection += aName;
+        mPendingEnd = aSelfClosing;
+
+        theElement->mType = XMLElement::TYPE_START;
+        theElement->mSection = std::string_view(mSection).substr(0, aSectionLen);
+        theElement->mValue = aName;
+        *theResult = true;
+        return true;
+    }
+}
+
 bool XMLParser::NextElement(XMLElement *theElement) {
+    if (mPendingSectionPop) PopSection();
+
+    bool aResult;
+    if (mUseSource && mBufferedText.empty() && ScanElement(&mScanElement, &aResult)) {
+        const XMLElementView &aView = mScanElement;
+        theElement->mType = aView.mType;
+        theElement->mSection = aView.mSection;
+        theElement->mValue = aView.Decode(aView.mValue);
+        theElement->mInstruction = aView.mInstruction;
+        theElement->mAttributes.clear();
+        theElement->mAttributeIteratorList.clear();
+        for (const auto &[aKey, aValue] : aView.mAttributes)
+            AddAttribute(theElement, aView.Decode(aKey), aView.Decode(aValue));
+        return aResult;
+    }
+
+    return ReadElement(theElement);
+}
+
+bool XMLParser::NextElement(XMLElementView *theElement) {
+    if (mPendingSectionPop) PopSection();
+
+    bool aResult;
+    if (mUseSource && mBufferedText.empty() && ScanElement(theElement, &aResult)) return aResult;
+
+    mReadElement.mAttributeIteratorList.clear();
+    aResult = ReadElement(&mReadElement);
+
+    theElement->mType = mReadElement.mType;
+    theElement->mSection = mReadElement.mSection;
+    theElement->mValue = mReadElement.mValue;
+    theElement->mInstruction = mReadElement.mInstruction;
+    theElement->mAttributes.clear();
+    for (const auto &anItr : mReadElement.mAttributeIteratorList)
+        theElement->mAttributes.emplace_back(anItr->first, anItr->second);
+    theElement->mDecoded = true;
+    return aResult;
+}
+
+bool XMLParser::ReadElement(XMLElement *theElement) {
     for (;;) {
         theElement->mType = XMLElement::TYPE_NONE;
         theElement->mSection = mSection;
@@ -304,12 +714,21 @@ bool XMLParser::NextElement(XMLElement *theElement) {
 
             wchar_t c;
             int aVal;
+            bool aCounted = false; // CountSourceLines counts mSource's
 
             if (!mBufferedText.empty()) {
                 c = mBufferedText[mBufferedText.size() - 1];
                 mBufferedText.pop_back();
 
                 aVal = 1;
+            } else if (mUseSource) {
+                if (mSourcePos < mSource.size()) {
+                    c = static_cast<uint8_t>(mSource[mSourcePos++]);
+                    aVal = 1;
+                    aCounted = true;
+                } else {
+                    aVal = 0;
+                }
             } else {
                 if (mFile != nullptr) {
                     bool error = false;
@@ -325,7 +744,7 @@ bool XMLParser::NextElement(XMLElement *theElement) {
             }
 
             if (aVal == 1) {
-                if (c == L'\n') {
+                if (c == L'\n' && !aCounted) {
                     mLineNum++;
                 }
 
@@ -593,6 +1012,9 @@ bool XMLParser::HasFailed() const { return mHasFailed; }
 
 SexyString XMLParser::GetErrorText() { return mErrorText; }
 
-int XMLParser::GetCurrentLineNum() const { return mLineNum; }
+int XMLParser::GetCurrentLineNum() {
+    CountSourceLines();
+    return mLineNum;
+}
 
 std::string XMLParser::GetFileName() { return mFileName; }
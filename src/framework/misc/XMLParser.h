@@ -4,6 +4,8 @@
 #include "framework/Common.h"
 
 #include "PerfTimer.h"
+#include <string_view>
+#include <vector>
 
 struct PFILE;
 
@@ -32,6 +34,20 @@ public:
     XMLParamMapIteratorList mAttributeIteratorList; // stores attribute iterators in their original order
 };
 
+// An element read without copying its text: the views point into the parser's source, so they are only valid until the
+// next NextElement call. Entities are left encoded, Decode() resolves them when the text is needed.
+class XMLElementView {
+public:
+    int mType = XMLElement::TYPE_NONE;
+    std::string_view mSection;
+    std::string_view mValue;
+    std::string_view mInstruction;
+    std::vector<std::pair<std::string_view, std::string_view>> mAttributes; // in their original order
+    bool mDecoded = false; // the element came from the character reader, which decodes as it goes
+
+    SexyString Decode(std::string_view theText) const;
+};
+
 class XMLParser {
 protected:
     std::string mFileName;
@@ -47,6 +63,21 @@ protected:
     bool mFirstChar;
     bool mByteSwap;
 
+    // Files that aren't UTF-16 or UTF-8 with non-ASCII text are scanned in place, straight from the pak mapping when
+    // the entry is stored plainly, else from a copy read in one go. Whatever the scan doesn't cover (instructions,
+    // unquoted attributes, quotes in text...) goes through the character reader, which then reads from mSource too.
+    bool mAllowSourceBuffer;
+    bool mUseSource;
+    std::string mSourceText;
+    std::string_view mSource;
+    size_t mSourcePos;
+    size_t mLineCountPos; // mSource's lines are counted into mLineNum up to here
+    std::string mScanText;
+    bool mPendingEnd;        // the last start tag closed itself, its end element comes next
+    bool mPendingSectionPop; // the last element was an end, mSection still backs its views
+    XMLElementView mScanElement;
+    XMLElement mReadElement;
+
 protected:
     void Fail(const SexyString &theErrorText);
     void Init();
@@ -59,6 +90,12 @@ protected:
     bool GetUTF16LEChar(wchar_t *theChar, bool *error);
     bool GetUTF16BEChar(wchar_t *theChar, bool *error);
 
+    bool LoadSource();
+    void CountSourceLines();
+    void PopSection();
+    bool ScanElement(XMLElementView *theElement, bool *theResult);
+    bool ReadElement(XMLElement *theElement);
+
 public:
     enum XMLEncodingType { ASCII, UTF_8, UTF_16, UTF_16_LE, UTF_16_BE };
 
@@ -71,11 +108,14 @@ public:
     void SetStringSource(const std::wstring &theString);
     void SetStringSource(const std::string &theString);
     bool NextElement(XMLElement *theElement);
+    bool NextElement(XMLElementView *theElement);
     SexyString GetErrorText();
-    int GetCurrentLineNum() const;
+    int GetCurrentLineNum();
     std::string GetFileName();
 
     inline void AllowComments(bool doAllow) { mAllowComments = doAllow; }
+    // Off makes OpenFile read everything through the character reader, to compare against the scan
+    inline void AllowSourceBuffer(bool doAllow) { mAllowSourceBuffer = doAllow; }
 
     bool HasFailed() const;
     bool EndOfFile();
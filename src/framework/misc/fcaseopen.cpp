@@ -3,6 +3,7 @@
 #if !defined(_WIN32)
 #include <errno.h>
 #include <filesystem>
+#include <mutex>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
@@ -25,6 +26,7 @@ constexpr inline std::vector<std::string> GetTokensFromPath(const std::string &p
 typedef std::vector<std::string> pathVec;
 typedef std::unordered_map<std::string, std::unique_ptr<pathVec>> pathMap;
 pathMap directoryCache;
+std::mutex directoryCacheMutex; // images are decoded on worker threads, which all end up here on a miss
 
 constexpr bool compareCaseInsensitive(const std::string &a, const std::string &b) {
     return strcasecmp(a.c_str(), b.c_str()) < 0;
@@ -67,6 +69,7 @@ std::string casepath(const std::string &path) {
         if (!std::filesystem::exists(current)) {
             auto key = to_lowercase(result);
 
+            std::unique_lock lock(directoryCacheMutex);
             pathVec *directory;
             if (auto search = directoryCache.find(key); search != directoryCache.end()) {
                 directory = search->second.get();
@@ -74,6 +77,7 @@ std::string casepath(const std::string &path) {
                 directory =
                     directoryCache.emplace(pathMap::value_type(key, createCachedDirectory(result))).first->second.get();
             }
+            lock.unlock();
 
             auto entry = std::lower_bound(directory->begin(), directory->end(), token, compareCaseInsensitive);
 
@@ -1,7 +1,26 @@
 #include "PakInterface.h"
 #include "misc/fcaseopen.h"
+#include <climits>
 #include <cstdio>
+#include <cstring>
 #include <filesystem>
+#include <map>
+#include <zlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
 
 using uint8_t = unsigned char;
 using uint16_t = unsigned short;
@@ -9,15 +28,157 @@ using uint32_t = uint32_t;
 
 enum { FILEFLAGS_END = 0x80 };
 
+static constexpr uint8_t PAK_XOR_KEY = 0xF7;
+
+// Copies theSize bytes of pak data to theDest, undoing the pak's XOR on the way.
+static void DecryptCopy(uint8_t *theDest, const uint8_t *theSrc, size_t theSize) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i aKey256 = _mm256_set1_epi8(static_cast<char>(PAK_XOR_KEY));
+    for (; i + 32 <= theSize; i += 32) {
+        const __m256i aData = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(theSrc + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(theDest + i), _mm256_xor_si256(aData, aKey256));
+    }
+#endif
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+    const __m128i aKey128 = _mm_set1_epi8(static_cast<char>(PAK_XOR_KEY));
+    for (; i + 16 <= theSize; i += 16) {
+        const __m128i aData = _mm_loadu_si128(reinterpret_cast<const __m128i *>(theSrc + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(theDest + i), _mm_xor_si128(aData, aKey128));
+    }
+#else
+    constexpr uint64_t aKey64 = 0x0101010101010101ULL * PAK_XOR_KEY;
+    for (; i + 8 <= theSize; i += 8) {
+        uint64_t aWord;
+        memcpy(&aWord, theSrc + i, sizeof(aWord));
+        aWord ^= aKey64;
+        memcpy(theDest + i, &aWord, sizeof(aWord));
+    }
+#endif
+    for (; i < theSize; i++)
+        theDest[i] = theSrc[i] ^ PAK_XOR_KEY;
+}
+
+// Where theFile's contents start, and whether they still carry the pak's XOR
+static const uint8_t *GetFileData(const PFILE *theFile, bool &theEncrypted) {
+    if (theFile->mInflated != nullptr) {
+        theEncrypted = false;
+        return theFile->mInflated;
+    }
+
+    const PakCollection *aPakCollection = theFile->mRecord->mCollection;
+    theEncrypted = aPakCollection->mEncrypted;
+    return static_cast<const uint8_t *>(aPakCollection->mDataPtr) + theFile->mRecord->mStartPos;
+}
+
+static char GetFileChar(const PFILE *theFile) {
+    bool anEncrypted;
+    const uint8_t aChar = GetFileData(theFile, anEncrypted)[theFile->mPos];
+    return static_cast<char>(anEncrypted ? aChar ^ PAK_XOR_KEY : aChar);
+}
+
+// ====================================================================================================
+// pak2: an unencrypted pak whose files can be used straight from the mapping.
+//
+//   Pak2Header
+//   Pak2Entry[mEntryCount]
+//   names, mNamesSize bytes, each null terminated
+//   file data, every file starting on a PAK2_ALIGNMENT boundary
+//
+// Files are either stored as they are or, when that saves enough, as a zlib stream. Each entry carries the hash
+// PakNameTable uses for its name, so the directory goes into the table without hashing anything. tools/repak.c
+// converts an original pak.
+// ====================================================================================================
+enum { PAK2_MAGIC = 0x324B4150, PAK2_VERSION = 1, PAK2_ALIGNMENT = 4096 };
+
+enum { PAK2_STORED = 0, PAK2_ZLIB = 1 };
+
+struct Pak2Header {
+    uint32_t mMagic;
+    uint32_t mVersion;
+    uint32_t mEntryCount;
+    uint32_t mNamesSize;
+};
+
+struct Pak2Entry {
+    uint64_t mOffset;     // From the start of the pak
+    uint64_t mNameHash;   // PakNameTable::Hash of the name
+    uint32_t mSize;       // Uncompressed
+    uint32_t mStoredSize; // In the pak
+    uint32_t mChecksum;   // crc32 of the uncompressed data
+    uint32_t mNameOffset; // Into the names
+    uint16_t mNameLength;
+    uint8_t mCompression;
+    uint8_t mPad[5];
+    FileTime mFileTime;
+};
+static_assert(sizeof(Pak2Header) == 16 && sizeof(Pak2Entry) == 48, "pak2 structures must match tools/repak.c");
+
 PakInterface *gPakInterface = new PakInterface();
 
-static std::string StringToUpper(const std::string &theString) {
-    std::string aString;
+static uint8_t ToUpper(const char c) { return static_cast<uint8_t>(toupper(static_cast<uint8_t>(c))); }
+
+uint64_t PakNameTable::Hash(const std::string_view theName) {
+    // FNV-1a over the uppercased bytes
+    uint64_t aHash = 0xCBF29CE484222325ULL;
+    for (const char c : theName) {
+        aHash ^= ToUpper(c);
+        aHash *= 0x100000001B3ULL;
+    }
+    return aHash;
+}
+
+int PakNameTable::Find(const std::string_view theName) const {
+    if (mSlots.empty()) return -1;
+
+    const uint64_t aHash = Hash(theName);
+    const size_t aMask = mSlots.size() - 1;
+    for (size_t i = aHash & aMask;; i = (i + 1) & aMask) {
+        const Slot &aSlot = mSlots[i];
+        if (aSlot.mIndex < 0) return -1;
+        if (aSlot.mHash == aHash && aSlot.mName.size() == theName.size() &&
+            strncasecmp(aSlot.mName.data(), theName.data(), theName.size()) == 0)
+            return aSlot.mIndex;
+    }
+}
 
-    for (unsigned i = 0; i < theString.length(); i++)
-        aString += toupper(theString[i]);
+int PakNameTable::Insert(const std::string_view theName, const int theIndex) {
+    return Insert(theName, Hash(theName), theIndex);
+}
 
-    return aString;
+int PakNameTable::Insert(const std::string_view theName, const uint64_t theHash, const int theIndex) {
+    // Keep the load factor under 1/2 so probe runs stay short
+    if ((mCount + 1) * 2 > mSlots.size()) Grow();
+
+    const size_t aMask = mSlots.size() - 1;
+    for (size_t i = theHash & aMask;; i = (i + 1) & aMask) {
+        Slot &aSlot = mSlots[i];
+        if (aSlot.mIndex < 0) {
+            aSlot.mName = theName;
+            aSlot.mHash = theHash;
+            aSlot.mIndex = theIndex;
+            mCount++;
+            return theIndex;
+        }
+        if (aSlot.mHash == theHash && aSlot.mName.size() == theName.size() &&
+            strncasecmp(aSlot.mName.data(), theName.data(), theName.size()) == 0)
+            return aSlot.mIndex;
+    }
+}
+
+void PakNameTable::Grow() {
+    std::vector<Slot> anOldSlots = std::move(mSlots);
+    mSlots = std::vector<Slot>(std::max<size_t>(anOldSlots.size() * 2, 1024));
+
+    const size_t aMask = mSlots.size() - 1;
+    for (Slot &anOldSlot : anOldSlots) {
+        if (anOldSlot.mIndex < 0) continue;
+
+        size_t i = anOldSlot.mHash & aMask;
+        while (mSlots[i].mIndex >= 0)
+            i = (i + 1) & aMask;
+        mSlots[i] = std::move(anOldSlot);
+    }
 }
 
 PakInterface::PakInterface() {
@@ -29,59 +190,113 @@ PakInterface::PakInterface() {
 
 PakInterface::~PakInterface() {}
 
-bool PakInterface::AddPakFile(const std::string &theFileName) {
-    // HANDLE aFileHandle = CreateFile(theFileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, 0,
-    // NULL);
-    FILE *aFileHandle = fopen(theFileName.c_str(), "rb");
-
-    if (!aFileHandle) return false;
+bool PakCollection::OpenMapped(const std::string &theFileName) {
+#ifdef _WIN32
+    HANDLE aFileHandle =
+        CreateFileA(theFileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, 0, nullptr);
+    if (aFileHandle == INVALID_HANDLE_VALUE) return false;
 
-    fseek(aFileHandle, 0, SEEK_END);
-    size_t aFileSize = ftell(aFileHandle);
-    fseek(aFileHandle, 0, SEEK_SET);
-    /*
-    HANDLE aFileMapping = CreateFileMapping(aFileHandle, NULL, PAGE_READONLY, 0, aFileSize, NULL);
-    if (aFileMapping == NULL)
-    {
+    LARGE_INTEGER aFileSize;
+    if (!GetFileSizeEx(aFileHandle, &aFileSize)) {
         CloseHandle(aFileHandle);
         return false;
     }
-
-    void* aPtr = MapViewOfFile(aFileMapping, FILE_MAP_READ, 0, 0, aFileSize);
-    if (aPtr == NULL)
-    {
+    mDataSize = static_cast<size_t>(aFileSize.QuadPart);
+
+    HANDLE aFileMapping = CreateFileMapping(aFileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (aFileMapping != nullptr) {
+        mDataPtr = MapViewOfFile(aFileMapping, FILE_MAP_READ, 0, 0, 0);
+        if (mDataPtr != nullptr) {
+            mFileHandle = aFileHandle;
+            mMappingHandle = aFileMapping;
+            mMapped = true;
+            return true;
+        }
         CloseHandle(aFileMapping);
-        CloseHandle(aFileHandle);
+    }
+    CloseHandle(aFileHandle);
+    return false;
+#else
+    const int aFileHandle = open(theFileName.c_str(), O_RDONLY);
+    if (aFileHandle < 0) return false;
+
+    struct stat aStat {};
+    if (fstat(aFileHandle, &aStat) != 0) {
+        close(aFileHandle);
         return false;
     }
-    */
-    mPakCollectionList.emplace_back(aFileSize);
-    PakCollection *aPakCollection = &mPakCollectionList.back();
-    /*
-    aPakCollection->mFileHandle = aFileHandle;
-    aPakCollection->mMappingHandle = aFileMapping;
-    aPakCollection->mDataPtr = aPtr;
-    */
+    mDataSize = static_cast<size_t>(aStat.st_size);
+
+    // The mapping stays valid after the descriptor is closed
+    void *aPtr = mDataSize > 0 ? mmap(nullptr, mDataSize, PROT_READ, MAP_PRIVATE, aFileHandle, 0) : MAP_FAILED;
+    close(aFileHandle);
+    if (aPtr == MAP_FAILED) return false;
+
+    mDataPtr = aPtr;
+    mMapped = true;
+    return true;
+#endif
+}
 
-    if (fread(aPakCollection->mDataPtr, 1, aFileSize, aFileHandle) != aFileSize) {
-        fclose(aFileHandle);
+bool PakCollection::Open(const std::string &theFileName, const bool theAllowMapping) {
+    if (theAllowMapping && OpenMapped(theFileName)) return true;
+
+    FILE *aFP = fopen(theFileName.c_str(), "rb");
+    if (aFP == nullptr) return false;
+
+    fseek(aFP, 0, SEEK_END);
+    mDataSize = ftell(aFP);
+    fseek(aFP, 0, SEEK_SET);
+    mDataPtr = malloc(mDataSize);
+    const bool aRead = mDataPtr != nullptr && fread(mDataPtr, 1, mDataSize, aFP) == mDataSize;
+    fclose(aFP);
+    return aRead;
+}
+
+PakCollection::~PakCollection() {
+    if (!mMapped) {
+        free(mDataPtr);
+        return;
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile(mDataPtr);
+    CloseHandle(mMappingHandle);
+    CloseHandle(mFileHandle);
+#else
+    munmap(mDataPtr, mDataSize);
+#endif
+}
+
+bool PakInterface::AddPakFile(const std::string &theFileName) {
+    PakCollection *aPakCollection = &mPakCollectionList.emplace_back();
+    if (!aPakCollection->Open(theFileName)) {
+        mPakCollectionList.pop_back();
         return false;
     }
 
-    fclose(aFileHandle);
+    const size_t aFileSize = aPakCollection->mDataSize;
 
     {
-        auto *aDataPtr = static_cast<uint8_t *>(aPakCollection->mDataPtr);
-        for (size_t i = 0; i < aFileSize; i++)
-            *aDataPtr++ ^= 0xF7;
+        std::error_code anError;
+        const auto aWriteTime = std::filesystem::last_write_time(theFileName, anError).time_since_epoch().count();
+        const std::string aStamp = fmt::format("{}|{}|{}", theFileName, aFileSize, aWriteTime);
+        mPakSignature = (mPakSignature * 31) ^ std::hash<std::string>{}(aStamp);
+    }
+
+    if (aFileSize >= sizeof(Pak2Header) && *static_cast<const uint32_t *>(aPakCollection->mDataPtr) == PAK2_MAGIC) {
+        aPakCollection->mEncrypted = false;
+        return AddPak2File(aPakCollection);
     }
 
-    auto aRecordItr = mPakRecordMap.insert(PakRecordMap::value_type(StringToUpper(theFileName), PakRecord())).first;
-    PakRecord *aPakRecord = &(aRecordItr->second);
+    // The index below is read through FRead straight off the mapping, nothing gets decrypted in place.
+    PakRecord *aPakRecord = AddPakRecord(theFileName);
     aPakRecord->mCollection = aPakCollection;
     aPakRecord->mFileName = theFileName;
     aPakRecord->mStartPos = 0;
     aPakRecord->mSize = aFileSize;
+    aPakRecord->mStoredSize = aFileSize;
+    aPakRecord->mCompressed = false;
 
     PFILE *aFP = OpenIndirectFile(theFileName.c_str(), "rb");
     if (aFP == nullptr) return false;
@@ -117,12 +332,13 @@ bool PakInterface::AddPakFile(const std::string &theFileName) {
         FileTime aFileTime;
         FRead(&aFileTime, sizeof(FileTime), 1, aFP);
 
-        auto aRecordItr = mPakRecordMap.insert(PakRecordMap::value_type(StringToUpper(aName), PakRecord())).first;
-        PakRecord *aPakRecord = &(aRecordItr->second);
+        PakRecord *aPakRecord = AddPakRecord(aName);
         aPakRecord->mCollection = aPakCollection;
         aPakRecord->mFileName = aName;
         aPakRecord->mStartPos = aPos;
         aPakRecord->mSize = aSrcSize;
+        aPakRecord->mStoredSize = aSrcSize;
+        aPakRecord->mCompressed = false;
         aPakRecord->mFileTime = aFileTime;
 
         aPos += aSrcSize;
@@ -131,11 +347,8 @@ bool PakInterface::AddPakFile(const std::string &theFileName) {
     int anOffset = FTell(aFP);
 
     // Now fix file starts
-    aRecordItr = mPakRecordMap.begin();
-    while (aRecordItr != mPakRecordMap.end()) {
-        PakRecord *aPakRecord = &(aRecordItr->second);
-        if (aPakRecord->mCollection == aPakCollection) aPakRecord->mStartPos += anOffset;
-        ++aRecordItr;
+    for (PakRecord &aPakRecord : mPakRecords) {
+        if (aPakRecord.mCollection == aPakCollection) aPakRecord.mStartPos += anOffset;
     }
 
     FClose(aFP);
@@ -143,6 +356,62 @@ bool PakInterface::AddPakFile(const std::string &theFileName) {
     return true;
 }
 
+bool PakInterface::AddPak2File(PakCollection *thePakCollection) {
+    const auto aData = static_cast<const uint8_t *>(thePakCollection->mDataPtr);
+    const size_t aDataSize = thePakCollection->mDataSize;
+
+    Pak2Header aHeader;
+    memcpy(&aHeader, aData, sizeof(aHeader));
+    const size_t aNamesPos = sizeof(Pak2Header) + static_cast<size_t>(aHeader.mEntryCount) * sizeof(Pak2Entry);
+    if (aHeader.mVersion != PAK2_VERSION || aNamesPos + aHeader.mNamesSize > aDataSize) return false;
+
+    const auto aNames = reinterpret_cast<const char *>(aData + aNamesPos);
+    for (uint32_t i = 0; i < aHeader.mEntryCount; i++) {
+        Pak2Entry anEntry;
+        memcpy(&anEntry, aData + sizeof(Pak2Header) + i * sizeof(Pak2Entry), sizeof(anEntry));
+        if (static_cast<uint64_t>(anEntry.mNameOffset) + anEntry.mNameLength > aHeader.mNamesSize ||
+            anEntry.mOffset + anEntry.mStoredSize > aDataSize || anEntry.mSize > INT_MAX ||
+            anEntry.mStoredSize > INT_MAX || anEntry.mOffset > INT_MAX || anEntry.mCompression > PAK2_ZLIB)
+            return false;
+
+        const std::string aName(aNames + anEntry.mNameOffset, anEntry.mNameLength);
+        PakRecord *aPakRecord = AddPakRecord(aName, anEntry.mNameHash);
+        aPakRecord->mCollection = thePakCollection;
+        aPakRecord->mFileName = aName;
+        aPakRecord->mFileTime = anEntry.mFileTime;
+        aPakRecord->mStartPos = static_cast<int>(anEntry.mOffset);
+        aPakRecord->mSize = static_cast<int>(anEntry.mSize);
+        aPakRecord->mStoredSize = static_cast<int>(anEntry.mStoredSize);
+        aPakRecord->mChecksum = anEntry.mChecksum;
+        aPakRecord->mCompressed = anEntry.mCompression == PAK2_ZLIB;
+    }
+
+    return true;
+}
+
+PakRecord *PakInterface::AddPakRecord(const std::string &theFileName) {
+    return AddPakRecord(theFileName, PakNameTable::Hash(theFileName));
+}
+
+// 若已有同名的资源文件（例如后添加的资源包覆盖了先前的），则返回已有的记录
+PakRecord *PakInterface::AddPakRecord(const std::string &theFileName, const uint64_t theHash) {
+    const int anIndex = mPakRecordTable.Insert(theFileName, theHash, static_cast<int>(mPakRecords.size()));
+    if (anIndex < static_cast<int>(mPakRecords.size())) return &mPakRecords[anIndex];
+
+    PakRecord *aPakRecord = &mPakRecords.emplace_back();
+
+    const size_t aLastDotPos = theFileName.rfind('.');
+    const size_t aLastSlashPos = theFileName.find_last_of("\\/");
+    if (aLastDotPos != std::string::npos && (aLastSlashPos == std::string::npos || aLastDotPos > aLastSlashPos)) {
+        const std::string_view aBaseName = std::string_view(theFileName).substr(0, aLastDotPos);
+        const int aBaseIndex = mPakBaseNameTable.Insert(aBaseName, static_cast<int>(mPakBaseNames.size()));
+        if (aBaseIndex == static_cast<int>(mPakBaseNames.size())) mPakBaseNames.emplace_back();
+        mPakBaseNames[aBaseIndex].push_back(aPakRecord);
+    }
+
+    return aPakRecord;
+}
+
 // 0x5D84D0
 static void FixFileName(const char *theFileName, char *theUpperName) {
     // 检测路径是否为从盘符开始的绝对路径
@@ -181,7 +450,7 @@ static void FixFileName(const char *theFileName, char *theUpperName) {
     }
 }
 
-inline PFILE *OpenDirectFile(const char *theFileName, const char *anAccess) {
+PFILE *PakInterface::OpenDirectFile(const char *theFileName, const char *anAccess) {
     FILE *aFP = fcaseopen(theFileName, anAccess);
     if (aFP == nullptr) return nullptr;
     auto aPFP = new PFILE;
@@ -191,29 +460,63 @@ inline PFILE *OpenDirectFile(const char *theFileName, const char *anAccess) {
     return aPFP;
 }
 
+PFILE *PakInterface::OpenPakRecord(PakRecord *theRecord) {
+    auto aPFP = new PFILE;
+    aPFP->mRecord = theRecord;
+    aPFP->mPos = 0;
+    aPFP->mFP = nullptr;
+
+    if (theRecord->mCompressed) {
+        aPFP->mInflated = new uint8_t[std::max(theRecord->mSize, 1)];
+        uLongf anInflatedSize = theRecord->mSize;
+        const auto aSrc = static_cast<const Bytef *>(theRecord->mCollection->mDataPtr) + theRecord->mStartPos;
+        if (uncompress(aPFP->mInflated, &anInflatedSize, aSrc, theRecord->mStoredSize) != Z_OK ||
+            anInflatedSize != static_cast<uLongf>(theRecord->mSize) ||
+            crc32(0, aPFP->mInflated, theRecord->mSize) != theRecord->mChecksum) {
+            fmt::println("warning: corrupt pak entry {}", theRecord->mFileName);
+            FClose(aPFP);
+            return nullptr;
+        }
+    }
+
+    return aPFP;
+}
+
+const void *PakInterface::GetPlainFileData(PFILE *theFile) {
+    if (theFile->mRecord == nullptr) return nullptr;
+
+    bool anEncrypted;
+    const uint8_t *aData = GetFileData(theFile, anEncrypted);
+    return anEncrypted ? nullptr : aData;
+}
+
+PakRecord *PakInterface::FindPakRecord(const char *theFileName) {
+    char anUpperName[256];
+    FixFileName(theFileName, anUpperName);
+
+    const int anIndex = mPakRecordTable.Find(anUpperName);
+    return anIndex >= 0 ? &mPakRecords[anIndex] : nullptr;
+}
+
+const std::vector<PakRecord *> *PakInterface::FindPakRecordsByBaseName(const char *theBaseName) {
+    char anUpperName[256];
+    FixFileName(theBaseName, anUpperName);
+
+    const int anIndex = mPakBaseNameTable.Find(anUpperName);
+    return anIndex >= 0 ? &mPakBaseNames[anIndex] : nullptr;
+}
+
 PFILE *PakInterface::OpenIndirectFile(const char *theFileName, const char *anAccess) {
     if ((strcasecmp(anAccess, "r") == 0) || (strcasecmp(anAccess, "rb") == 0) || (strcasecmp(anAccess, "rt") == 0)) {
-        char anUpperName[256];
-        FixFileName(theFileName, anUpperName);
-
-        auto anItr = mPakRecordMap.find(anUpperName);
-        if (anItr != mPakRecordMap.end()) {
-            auto aPFP = new PFILE;
-            aPFP->mRecord = &anItr->second;
-            aPFP->mPos = 0;
-            aPFP->mFP = nullptr;
-            return aPFP;
-        }
+        PakRecord *aPakRecord = FindPakRecord(theFileName);
+        if (aPakRecord != nullptr) return OpenPakRecord(aPakRecord);
     }
     return nullptr;
 }
 
 std::optional<ChronoFileTime> PakInterface::GetFileTime(const std::string &theFileName) {
-    char anUpperName[256];
-    FixFileName(theFileName.c_str(), anUpperName);
-    auto anItr = mPakRecordMap.find(anUpperName);
-    if (anItr != mPakRecordMap.end()) {
-        return anItr->second.mFileTime.to_time_point();
+    if (const PakRecord *aPakRecord = FindPakRecord(theFileName.c_str())) {
+        return aPakRecord->mFileTime.to_time_point();
     }
 
     // Should run casepath second since it makes a lot of syscalls to the OS,
@@ -236,6 +539,7 @@ PFILE *PakInterface::FOpen(const char *theFileName, const char *anAccess) {
 // 0x5D8780
 int PakInterface::FClose(PFILE *theFile) {
     if (theFile->mRecord == nullptr) fclose(theFile->mFP);
+    delete[] theFile->mInflated;
     delete theFile;
     return 0;
 }
@@ -266,12 +570,11 @@ size_t PakInterface::FRead(void *thePtr, int theElemSize, int theCount, PFILE *t
         int aSizeBytes = std::min(theElemSize * theCount, theFile->mRecord->mSize - theFile->mPos);
 
         // 取得在整个 pak 中开始读取的位置的指针
-        const uint8_t *src = static_cast<uint8_t *>(theFile->mRecord->mCollection->mDataPtr) +
-                             theFile->mRecord->mStartPos + theFile->mPos;
+        bool anEncrypted;
+        const uint8_t *src = GetFileData(theFile, anEncrypted) + theFile->mPos;
         const auto dest = static_cast<uint8_t *>(thePtr);
-        // for (int i = 0; i < aSizeBytes; i++)
-        //    *(dest++) = (*src++) ;  ^ 0xF7; // 'Decrypt'
-        memcpy(dest, src, aSizeBytes);
+        if (anEncrypted) DecryptCopy(dest, src, aSizeBytes);
+        else memcpy(dest, src, aSizeBytes);
         theFile->mPos += aSizeBytes;     // 读取完成后，移动当前读取位置的指针
         return aSizeBytes / theElemSize; // 返回实际读取的项数
     }
@@ -283,9 +586,8 @@ int PakInterface::FGetC(PFILE *theFile) {
     if (theFile->mRecord != nullptr) {
         for (;;) {
             if (theFile->mPos >= theFile->mRecord->mSize) return EOF;
-            char aChar =
-                *(static_cast<char *>(theFile->mRecord->mCollection->mDataPtr) + theFile->mRecord->mStartPos +
-                  theFile->mPos++); // ^ 0xF7;
+            char aChar = GetFileChar(theFile);
+            theFile->mPos++;
             if (aChar != '\r') return static_cast<uint8_t>(aChar);
         }
     }
@@ -311,9 +613,8 @@ char *PakInterface::FGetS(char *thePtr, int theSize, PFILE *theFile) {
                 if (anIdx == 0) return nullptr;
                 break;
             }
-            char aChar =
-                *(static_cast<char *>(theFile->mRecord->mCollection->mDataPtr) + theFile->mRecord->mStartPos +
-                  theFile->mPos++); // ^ 0xF7;
+            char aChar = GetFileChar(theFile);
+            theFile->mPos++;
             if (aChar != '\r') thePtr[anIdx++] = aChar;
             if (aChar == '\n') break;
         }
@@ -329,6 +630,124 @@ int PakInterface::FEof(PFILE *theFile) {
     else return feof(theFile->mFP);
 }
 
+void PakBenchmarkAddPakFile(const std::string &theFileName) {
+    using Clock = std::chrono::high_resolution_clock;
+    constexpr double MIB = 1024.0 * 1024.0;
+
+    size_t aResidentBefore = 0;
+    size_t aResidentAfter = 0;
+    size_t aPeak = 0;
+
+    {
+        PakInterface aPakInterface;
+        Sexy::GetProcessMemory(&aResidentBefore, &aPeak);
+        const auto aStart = Clock::now();
+        if (!aPakInterface.AddPakFile(theFileName)) {
+            fmt::println("startupstats: {} could not be added", theFileName);
+            return;
+        }
+        const double aMs = std::chrono::duration<double, std::milli>(Clock::now() - aStart).count();
+        Sexy::GetProcessMemory(&aResidentAfter, &aPeak);
+        fmt::println(
+            "startupstats: {} ({:.1f} MiB, {} records) mapped: {:.2f} ms, +{:.1f} MiB resident", theFileName,
+            aPakInterface.mPakCollectionList.front().mDataSize / MIB, aPakInterface.mPakRecords.size(), aMs,
+            (static_cast<double>(aResidentAfter) - static_cast<double>(aResidentBefore)) / MIB
+        );
+    }
+
+    {
+        PakCollection aPakCollection;
+        Sexy::GetProcessMemory(&aResidentBefore, &aPeak);
+        const auto aStart = Clock::now();
+        if (!aPakCollection.Open(theFileName, false)) return;
+        // What AddPakFile did before the mapping: decrypt the whole copy in place, one byte at a time
+        uint8_t *aData = static_cast<uint8_t *>(aPakCollection.mDataPtr);
+        for (size_t i = 0; i < aPakCollection.mDataSize; i++) {
+            aData[i] ^= PAK_XOR_KEY;
+        }
+        const double aMs = std::chrono::duration<double, std::milli>(Clock::now() - aStart).count();
+        Sexy::GetProcessMemory(&aResidentAfter, &aPeak);
+        fmt::println(
+            "startupstats: {} read and decrypted: {:.2f} ms, +{:.1f} MiB resident", theFileName, aMs,
+            (static_cast<double>(aResidentAfter) - static_cast<double>(aResidentBefore)) / MIB
+        );
+    }
+}
+
+void PakBenchmarkFOpen() {
+    using Clock = std::chrono::high_resolution_clock;
+    constexpr int LOOKUPS = 2000000;
+
+    // The names the way the game asks for them: lower case, forward slashes
+    std::vector<std::string> aNames;
+    std::map<std::string, PakRecord *> aPakRecordMap;
+    for (PakRecord &aPakRecord : gPakInterface->mPakRecords) {
+        std::string aName = aPakRecord.mFileName;
+        for (char &c : aName) {
+            c = c == '\\' ? '/' : static_cast<char>(tolower(static_cast<uint8_t>(c)));
+        }
+        aNames.push_back(std::move(aName));
+
+        char anUpperName[256];
+        FixFileName(aPakRecord.mFileName.c_str(), anUpperName);
+        aPakRecordMap[anUpperName] = &aPakRecord;
+    }
+    if (aNames.empty()) {
+        fmt::println("pakbench: no pak records");
+        return;
+    }
+    const int aRounds = std::max(1, LOOKUPS / static_cast<int>(aNames.size()));
+    const int aLookups = aRounds * static_cast<int>(aNames.size());
+
+    // What OpenIndirectFile did before the hash table
+    int aMapFound = 0;
+    auto aStart = Clock::now();
+    for (int aRound = 0; aRound < aRounds; aRound++) {
+        for (const std::string &aName : aNames) {
+            char anUpperName[256];
+            FixFileName(aName.c_str(), anUpperName);
+            auto anItr = aPakRecordMap.find(anUpperName);
+            if (anItr != aPakRecordMap.end()) aMapFound++;
+        }
+    }
+    const double aMapMs = std::chrono::duration<double, std::milli>(Clock::now() - aStart).count();
+
+    int aTableFound = 0;
+    aStart = Clock::now();
+    for (int aRound = 0; aRound < aRounds; aRound++) {
+        for (const std::string &aName : aNames) {
+            if (gPakInterface->FindPakRecord(aName.c_str()) != nullptr) aTableFound++;
+        }
+    }
+    const double aTableMs = std::chrono::duration<double, std::milli>(Clock::now() - aStart).count();
+
+    // The whole of FOpen, loose file probe included, once per name
+    int anOpened = 0;
+    aStart = Clock::now();
+    for (const std::string &aName : aNames) {
+        if (PFILE *aFP = gPakInterface->FOpen(aName.c_str(), "rb")) {
+            gPakInterface->FClose(aFP);
+            anOpened++;
+        }
+    }
+    const double anOpenMs = std::chrono::duration<double, std::milli>(Clock::now() - aStart).count();
+
+    fmt::println("pakbench: {} records, {} lookups each", aNames.size(), aLookups);
+    fmt::println(
+        "pakbench: std::map {:.1f} ms ({:.2f} M/s), hash table {:.1f} ms ({:.2f} M/s), {:.2f}x", aMapMs,
+        aLookups / aMapMs / 1000.0, aTableMs, aLookups / aTableMs / 1000.0, aMapMs / aTableMs
+    );
+    fmt::println(
+        "pakbench: FOpen + FClose {:.1f} ms for {} files ({:.0f} /s)", anOpenMs, aNames.size(),
+        aNames.size() / anOpenMs * 1000.0
+    );
+    if (aMapFound != aLookups || aTableFound != aLookups || anOpened != static_cast<int>(aNames.size())) {
+        fmt::println(
+            "pakbench: FAILED, found {} by map, {} by hash table, opened {}", aMapFound, aTableFound, anOpened
+        );
+    }
+}
+
 /*
 bool PakInterface::PFindNext(PFindData* theFindData, LPWIN32_FIND_DATA lpFindFileData)
 {
@@ -3,9 +3,11 @@
 
 #include "framework/Common.h"
 #include <chrono>
+#include <deque>
 #include <list>
-#include <map>
 #include <string>
+#include <string_view>
+#include <vector>
 
 using ChronoFileTime = std::chrono::time_point<std::chrono::file_clock>;
 
@@ -41,22 +43,60 @@ public:
     FileTime mFileTime; //+0x20：八字节型的资源文件的时间戳
     int mStartPos; //+0x28：该资源文件在资源包中的位置（即在 mCollection->mDataPtr 中的偏移量）
     int mSize;     //+0x2C：资源文件的大小，单位为 Byte（字节数）
+    int mStoredSize = 0;      // Bytes the file takes in the pak, differs from mSize when compressed (pak2 only)
+    uint32_t mChecksum = 0;   // crc32 of the uncompressed contents (pak2 only)
+    bool mCompressed = false; // zlib stream, inflated into the PFILE when opened (pak2 only)
 };
 
-using PakRecordMap = std::map<std::string, PakRecord>;
+// Open addressing table from resource file names to indices. Names are hashed and compared case-insensitively, so a
+// lookup doesn't need an uppercased copy of the name.
+class PakNameTable {
+public:
+    [[nodiscard]] int Find(std::string_view theName) const; // -1 if theName isn't in the table
+    int Insert(std::string_view theName, int theIndex);      // Returns the index already stored for theName, if any
+    int Insert(std::string_view theName, uint64_t theHash, int theIndex);
+
+    static uint64_t Hash(std::string_view theName);
+
+protected:
+    struct Slot {
+        std::string mName;
+        uint64_t mHash = 0;
+        int mIndex = -1;
+    };
+
+    std::vector<Slot> mSlots;
+    size_t mCount = 0;
+
+    void Grow();
+};
 
 // ====================================================================================================
 // ★ 一个 PakCollection 实例对应一个 pak 资源包在内存中的映射文件
 // ====================================================================================================
+// The pak is mapped read-only. An original pak stays encrypted; FRead/FGetC/FGetS undo the XOR on the bytes they hand
+// out, so adding a pak doesn't read the whole file up front and resources that are never opened never become resident.
+// A pak2 (see PakInterface.cpp) isn't encrypted at all. Falls back to reading the file into memory when it can't be
+// mapped.
 class PakCollection {
 public:
-    // HANDLE					mFileHandle;
-    // HANDLE					mMappingHandle;
-    void *mDataPtr; //+0x8：资源包中的所有数据
-
-    explicit PakCollection(size_t size) { mDataPtr = malloc(size); }
-
-    ~PakCollection() { free(mDataPtr); }
+    void *mFileHandle = nullptr;    // Windows only
+    void *mMappingHandle = nullptr; // Windows only
+    void *mDataPtr = nullptr;       //+0x8：资源包中的所有数据（加密的）
+    size_t mDataSize = 0;
+    bool mMapped = false; // Whether mDataPtr is a mapped view or a malloc'd copy
+    bool mEncrypted = true;
+
+    PakCollection() = default;
+    PakCollection(const PakCollection &) = delete;
+    PakCollection &operator=(const PakCollection &) = delete;
+    ~PakCollection();
+
+    // theAllowMapping false always reads the file into memory.
+    bool Open(const std::string &theFileName, bool theAllowMapping = true);
+
+protected:
+    bool OpenMapped(const std::string &theFileName);
 };
 
 using PakCollectionList = std::list<PakCollection>;
@@ -65,6 +105,7 @@ struct PFILE {
     PakRecord *mRecord;
     int mPos;
     FILE *mFP;
+    uint8_t *mInflated = nullptr; // Contents of a compressed record, owned by the PFILE
 };
 
 /*
@@ -99,7 +140,11 @@ public:
 class PakInterface : public PakInterfaceBase {
 public:
     PakCollectionList mPakCollectionList; //+0x4：通过 AddPakFile() 添加的各个资源包的内存映射文件数据的链表
-    PakRecordMap mPakRecordMap; //+0x10：所有已添加的资源包中的所有资源文件的、从文件名到文件数据的映射容器
+    std::deque<PakRecord> mPakRecords;    // 所有已添加的资源包中的所有资源文件，PFILE 持有其中元素的指针
+    PakNameTable mPakRecordTable;         // 从文件名到 mPakRecords 中下标的映射
+    PakNameTable mPakBaseNameTable;       // 从去掉扩展名的文件名到 mPakBaseNames 中下标的映射
+    std::vector<std::vector<PakRecord *>> mPakBaseNames; // 同名不同扩展名的各个资源文件
+    uint64_t mPakSignature = 0; // Changes whenever a different set or version of pak files gets added
 
 public:
     // bool					PFindNext(PFindData* theFindData, LPWIN32_FIND_DATA lpFindFileData);
@@ -109,6 +154,9 @@ public:
     ~PakInterface();
 
     bool AddPakFile(const std::string &theFileName);
+    bool AddPak2File(PakCollection *thePakCollection);
+    PakRecord *AddPakRecord(const std::string &theFileName);
+    PakRecord *AddPakRecord(const std::string &theFileName, uint64_t theHash);
     PFILE *FOpen(const char *theFileName, const char *theAccess) override;
     int FClose(PFILE *theFile) override;
     int FSeek(PFILE *theFile, uint32_t theOffset, int theOrigin) override;
@@ -119,7 +167,14 @@ public:
     char *FGetS(char *thePtr, int theSize, PFILE *theFile) override;
     int FEof(PFILE *theFile) override;
 
+    PFILE *OpenDirectFile(const char *theFileName, const char *anAccess);
     PFILE *OpenIndirectFile(const char *theFileName, const char *anAccess);
+    PFILE *OpenPakRecord(PakRecord *theRecord);
+    PakRecord *FindPakRecord(const char *theFileName);
+    // theFile's contents when they can be read in place (a pak2 or inflated entry), otherwise nullptr
+    const void *GetPlainFileData(PFILE *theFile);
+    // The records named theBaseName plus some extension, so callers probing several extensions need one lookup
+    const std::vector<PakRecord *> *FindPakRecordsByBaseName(const char *theBaseName);
     std::optional<ChronoFileTime> GetFileTime(const std::string &theFileName);
 
     /*
@@ -131,6 +186,13 @@ public:
 
 extern PakInterface *gPakInterface;
 
+// -startupstats: adds theFileName again, once the way AddPakFile does and once the way it used to (read in full, then
+// decrypted in full), and prints how long each takes and how much resident memory it adds.
+void PakBenchmarkAddPakFile(const std::string &theFileName);
+// -pakbench: looks up every record of gPakInterface through the hash table and through the std::map it replaced, then
+// opens each one with FOpen, and prints the throughput of each.
+void PakBenchmarkFOpen();
+
 [[maybe_unused]] static PFILE *p_fopen(const char *theFileName, const char *theAccess) {
     return gPakInterface->FOpen(theFileName, theAccess);
 }
@@ -1,5 +1,6 @@
 #include "BassSoundManager.h"
 #include "Common.h"
+#include "misc/WorkerPool.h"
 #include "paklib/PakInterface.h"
 #include <bass.h>
 #include <chrono>
@@ -14,9 +15,11 @@
 namespace Sexy {
 BassSoundManager::BassSoundManager(HWND theHWnd) { BassMusicInterface::InitBass(theHWnd); }
 
-bool BassSoundManager::LoadCompatibleSound(unsigned int theSfxID, const std::string &theFilename) {
+BassSoundManager::~BassSoundManager() { ReleaseSounds(); }
+
+std::optional<HSAMPLE> BassSoundManager::LoadCompatibleSound(const std::string &theFilename) {
     PFILE *aFile = p_fopen(theFilename.c_str(), "rb");
-    if (aFile == nullptr) return false;
+    if (aFile == nullptr) return std::nullopt;
 
     p_fseek(aFile, 0, SEEK_END);
     const size_t aLength = p_ftell(aFile);
@@ -26,10 +29,10 @@ bool BassSoundManager::LoadCompatibleSound(unsigned int theSfxID, const std::str
     p_fread(aBuf, aLength, 1, aFile);
     p_fclose(aFile);
 
-    mSourceSounds[theSfxID] = std::make_optional(BASS_SampleLoad(true, aBuf, 0, aLength, MAX_CHANNELS, 0));
+    const HSAMPLE aSample = BASS_SampleLoad(true, aBuf, 0, aLength, MAX_CHANNELS, 0);
 
     free(aBuf);
-    return true;
+    return aSample;
 }
 
 struct WavHeader {
@@ -75,14 +78,14 @@ inline uint16_t Snack_Mulaw2Lin(uint8_t u_val) {
     return ((u_val & SIGN_BIT) ? (BIAS - t) : (t - BIAS));
 }
 
-bool BassSoundManager::LoadAUSound(unsigned int theSfxID, const std::string &theFilename) {
+std::optional<HSAMPLE> BassSoundManager::LoadAUSound(const std::string &theFilename) {
     PFILE *fp = p_fopen(theFilename.c_str(), "rb");
 
-    if (fp == nullptr) return false;
+    if (fp == nullptr) return std::nullopt;
 
     char aHeaderId[4];
     p_fread(aHeaderId, 1, 4, fp);
-    if ((!strncmp(aHeaderId, ".snd", 4)) == 0) return false;
+    if ((!strncmp(aHeaderId, ".snd", 4)) == 0) return std::nullopt;
 
     uint32_t aHeaderSize;
     p_fread(&aHeaderSize, 4, 1, fp);
@@ -134,7 +137,7 @@ bool BassSoundManager::LoadAUSound(unsigned int theSfxID, const std::string &the
             aBitCount = 32;
             break;*/
 
-    default: return false;
+    default: return std::nullopt;
     }
 
     const uint32_t aDestSize = aDataSize * (aBitCount / aSrcBitCount);
@@ -164,7 +167,7 @@ bool BassSoundManager::LoadAUSound(unsigned int theSfxID, const std::string &the
 
         const size_t aReadSize = p_fread(aSrcBuffer, 1, aDataSize, fp);
         p_fclose(fp);
-        if (aReadSize != aDataSize) return false;
+        if (aReadSize != aDataSize) return std::nullopt;
 
         for (uint32_t i = 0; i < aDataSize; i++) {
             aDestBuffer[i] = Snack_Mulaw2Lin(aSrcBuffer[i]);
@@ -174,25 +177,17 @@ bool BassSoundManager::LoadAUSound(unsigned int theSfxID, const std::string &the
     } else {
         const size_t aReadSize = p_fread(aDestBuffer, 1, aDataSize, fp);
         p_fclose(fp);
-        if (aReadSize != aDataSize) return false;
+        if (aReadSize != aDataSize) return std::nullopt;
     }
 
-    mSourceSounds[theSfxID] =
-        std::make_optional(BASS_SampleLoad(true, aDestHeader, 0, sizeof(WavHeader) + aDestSize, MAX_CHANNELS, 0));
+    const HSAMPLE aSample = BASS_SampleLoad(true, aDestHeader, 0, sizeof(WavHeader) + aDestSize, MAX_CHANNELS, 0);
 
     free(aDestHeader);
 
-    return true;
+    return aSample;
 }
 
-bool BassSoundManager::LoadSound(unsigned int theSfxID, const std::string &theFilename) {
-    if ((theSfxID < 0) || (theSfxID >= MAX_SOURCE_SOUNDS)) return false;
-
-    ReleaseSound(theSfxID);
-
-    mSourceFileNames[theSfxID] = theFilename;
-
-    const std::string aFilename = theFilename;
+std::optional<HSAMPLE> BassSoundManager::LoadSample(const std::string &theFilename) {
     // std::string aCachedName;
 
     /* Disabling caching because caching is hard.
@@ -206,19 +201,56 @@ bool BassSoundManager::LoadSound(unsigned int theSfxID, const std::string &theFi
         MkDir(GetFileDir(aCachedName));
     }*/
 
-    if (LoadCompatibleSound(theSfxID, aFilename + ".wav")) return true;
+    if (auto aSample = LoadCompatibleSound(theFilename + ".wav")) return aSample;
 
-    if (LoadCompatibleSound(theSfxID, aFilename + ".ogg")) {
+    if (auto aSample = LoadCompatibleSound(theFilename + ".ogg")) {
         // WriteWAV(theSfxID, aCachedName, aFilename + ".ogg");
-        return true;
+        return aSample;
     }
 
-    if (LoadAUSound(theSfxID, aFilename + ".au")) {
+    if (auto aSample = LoadAUSound(theFilename + ".au")) {
         // WriteWAV(theSfxID, aCachedName, aFilename + ".au");
-        return true;
+        return aSample;
     }
 
-    return false;
+    return std::nullopt;
+}
+
+bool BassSoundManager::LoadSound(unsigned int theSfxID, const std::string &theFilename) {
+    if ((theSfxID < 0) || (theSfxID >= MAX_SOURCE_SOUNDS)) return false;
+
+    ReleaseSound(theSfxID);
+
+    mSourceFileNames[theSfxID] = theFilename;
+
+    std::optional<std::future<std::optional<HSAMPLE>>> aPrepared;
+    {
+        std::lock_guard aLock(mPreparedSoundMutex);
+        auto anItr = mPreparedSoundMap.find(theFilename);
+        if (anItr != mPreparedSoundMap.end()) {
+            aPrepared = std::move(anItr->second);
+            mPreparedSoundMap.erase(anItr);
+        }
+    }
+
+    if (aPrepared.has_value()) {
+        while (aPrepared->wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            if (!GetWorkerPool().RunPendingTask()) aPrepared->wait();
+        }
+        mSourceSounds[theSfxID] = aPrepared->get();
+    } else {
+        mSourceSounds[theSfxID] = LoadSample(theFilename);
+    }
+
+    return mSourceSounds[theSfxID].has_value();
+}
+
+void BassSoundManager::PrepareSound(const std::string &theFilename) {
+    std::lock_guard aLock(mPreparedSoundMutex);
+    if (mPreparedSoundMap.contains(theFilename)) return;
+
+    // BASS is thread safe, so the whole decode (the .ogg files are most of the work) can happen on the pool.
+    mPreparedSoundMap[theFilename] = GetWorkerPool().Submit([theFilename] { return LoadSample(theFilename); });
 }
 
 int BassSoundManager::LoadSound(const std::string &theFilename) {
@@ -248,6 +280,23 @@ void BassSoundManager::ReleaseSounds() {
     for (unsigned int i = 0; i < MAX_SOURCE_SOUNDS; ++i) {
         ReleaseSound(i);
     }
+    ReleasePreparedSounds();
+}
+
+// Frees the samples that were prepared but never picked up by LoadSound, e.g. when loading was aborted.
+void BassSoundManager::ReleasePreparedSounds() {
+    std::map<std::string, std::future<std::optional<HSAMPLE>>> aPreparedSoundMap;
+    {
+        std::lock_guard aLock(mPreparedSoundMutex);
+        aPreparedSoundMap.swap(mPreparedSoundMap);
+    }
+
+    for (auto &[aFilename, aPrepared] : aPreparedSoundMap) {
+        while (aPrepared.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            if (!GetWorkerPool().RunPendingTask()) aPrepared.wait();
+        }
+        if (const std::optional<HSAMPLE> aSample = aPrepared.get()) BASS_SampleFree(*aSample);
+    }
 }
 
 inline bool BassSoundManager::Exists(unsigned int theSfxID) const {
@@ -6,18 +6,24 @@
 #include "SoundManager.h"
 #include <array>
 #include <bass.h>
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 
 namespace Sexy {
 class BassSoundManager : public Sexy::SoundManager {
 public:
     BassSoundManager(HWND theHWnd);
+    ~BassSoundManager() override;
     static double PanDBToNorm(int dbpan);
 
     bool Initialized() override { return Sexy::BassMusicInterface::gBassLoaded; }
 
     bool LoadSound(unsigned int theSfxID, const std::string &theFilename) override;
     int LoadSound(const std::string &theFilename) override;
+    void PrepareSound(const std::string &theFilename) override;
     void ReleaseSound(unsigned int theSfxID) override;
 
     void SetVolume(double theVolume) override;
@@ -47,8 +53,14 @@ private:
     std::array<std::string, MAX_SOURCE_SOUNDS> mSourceFileNames;
     std::array<std::optional<HSAMPLE>, MAX_SOURCE_SOUNDS> mSourceSounds;
 
-    bool LoadCompatibleSound(unsigned int theSfxID, const std::string &theFilename);
-    bool LoadAUSound(unsigned int theSfxID, const std::string &theFilename);
+    // Samples being loaded on the worker pool, by the file name LoadSound will be called with.
+    std::map<std::string, std::future<std::optional<HSAMPLE>>> mPreparedSoundMap;
+    std::mutex mPreparedSoundMutex;
+
+    void ReleasePreparedSounds();
+    static std::optional<HSAMPLE> LoadSample(const std::string &theFilename);
+    static std::optional<HSAMPLE> LoadCompatibleSound(const std::string &theFilename);
+    static std::optional<HSAMPLE> LoadAUSound(const std::string &theFilename);
     inline bool Exists(unsigned int theSfxID) const;
     static void
     SetBaseVolumeAndPan(HSAMPLE theSample, std::optional<double> theBaseVolume, std::optional<int> theBasePan);
@@ -19,6 +19,8 @@ public:
 
     virtual bool LoadSound(unsigned int theSfxID, const std::string &theFilename) = 0;
     virtual int LoadSound(const std::string &theFilename) = 0;
+    // Starts loading theFilename in the background, a later LoadSound of the same name picks the result up.
+    virtual void PrepareSound(const std::string &) {}
     virtual void ReleaseSound(unsigned int theSfxID) = 0;
 
     virtual void SetVolume(double theVolume) = 0;
@@ -47,6 +47,10 @@ Board::Board(LawnApp *theApp) {
     mCoins.DataArrayInitialize(1024U, "coins");
     mLawnMowers.DataArrayInitialize(32U, "lawnmowers");
     mGridItems.DataArrayInitialize(128U, "griditems");
+    mStats.Rebuild();
+    // Plants and zombies can show up at any moment of a level, don't let the image budget evict them mid game.
+    mApp->mResourceManager->PinGroup("LoadingImages");
+    mGridIndex.Rebuild();
     TodHesitationTrace("board dataarrays");
 
     mApp->mEffectSystem->EffectSystemFreeAll();
@@ -195,6 +199,8 @@ Board::Board(LawnApp *theApp) {
 
 // 0x408670、0x408690
 Board::~Board() {
+    mApp->mResourceManager->UnpinGroup("LoadingImages");
+
     delete mAdvice;
     delete mCursorObject;
     delete mCursorPreview;
@@ -234,28 +240,11 @@ void Board::DisposeBoard() const {
 }
 
 // 0x408B00
-bool Board::AreEnemyZombiesOnScreen() {
-    Zombie *aZombie = nullptr;
-    while (IterateZombies(aZombie)) {
-        if (aZombie->mHasHead && !aZombie->IsDeadOrDying() && !aZombie->mMindControlled) {
-            return true;
-        }
-    }
-    return false;
-}
+bool Board::AreEnemyZombiesOnScreen() { return mStats.AreEnemyZombiesOnScreen(); }
 
 // 0x408B60
 //  GOTY @Patoke: 0x40B4A0
-int Board::CountZombiesOnScreen() {
-    int aCount = 0;
-    Zombie *aZombie = nullptr;
-    while (IterateZombies(aZombie)) {
-        if (aZombie->mHasHead && !aZombie->IsDeadOrDying() && !aZombie->mMindControlled && aZombie->IsOnBoard()) {
-            aCount++;
-        }
-    }
-    return aCount;
-}
+int Board::CountZombiesOnScreen() { return mStats.CountZombiesOnScreen(); }
 
 // GOTY @Patoke: 0x40B3B0
 int Board::GetLiveGargantuarCount() {
@@ -272,17 +261,7 @@ int Board::GetLiveGargantuarCount() {
 }
 
 // 0x408BF0
-int Board::CountUntriggerLawnMowers() {
-    int aCount = 0;
-    LawnMower *aLawnMower = nullptr;
-    while (IterateLawnMowers(aLawnMower)) {
-        if (aLawnMower->mMowerState != LawnMowerState::MOWER_TRIGGERED &&
-            aLawnMower->mMowerState != LawnMowerState::MOWER_SQUISHED) {
-            aCount++;
-        }
-    }
-    return aCount;
-}
+int Board::CountUntriggerLawnMowers() { return mStats.CountUntriggerLawnMowers(); }
 
 // 0x408C30
 void Board::TryToSaveGame() {
@@ -334,14 +313,7 @@ bool Board::LoadGame(const std::string &theFileName) {
 
 // 0x408E40
 GridItem *Board::GetGridItemAt(const GridItemType theGridItemType, const int theGridX, const int theGridY) {
-    GridItem *aGridItem = nullptr;
-    while (IterateGridItems(aGridItem)) {
-        if (aGridItem->mGridX == theGridX && aGridItem->mGridY == theGridY &&
-            aGridItem->mGridItemType == theGridItemType) {
-            return aGridItem;
-        }
-    }
-    return nullptr;
+    return mGridIndex.GetGridItemAt(theGridItemType, theGridX, theGridY);
 }
 
 // 0x408E90
@@ -389,16 +361,7 @@ bool Board::CanAddGraveStoneAt(const int theGridX, const int theGridY) {
         return false;
     }
 
-    GridItem *aGridItem = nullptr;
-    while (IterateGridItems(aGridItem)) {
-        if (aGridItem->mGridX == theGridX && aGridItem->mGridY == theGridY) {
-            if (aGridItem->mGridItemType == GridItemType::GRIDITEM_GRAVESTONE ||
-                aGridItem->mGridItemType == GridItemType::GRIDITEM_CRATER ||
-                aGridItem->mGridItemType == GridItemType::GRIDITEM_LADDER)
-                return false;
-        }
-    }
-    return true;
+    return !GetGraveStoneAt(theGridX, theGridY) && !GetCraterAt(theGridX, theGridY) && !GetLadderAt(theGridX, theGridY);
 }
 
 int Board::MakeRenderOrder(const RenderLayer theRenderLayer, const int theRow, const int theLayerOffset) {
@@ -412,6 +375,7 @@ GridItem *Board::AddALadder(const int theGridX, const int theGridY) {
     aLadder->mRenderOrder = MakeRenderOrder(RenderLayer::RENDER_LAYER_PLANT, theGridY, 800);
     aLadder->mGridX = theGridX;
     aLadder->mGridY = theGridY;
+    BoardGridIndex::GridItemChanged(aLadder);
     return aLadder;
 }
 
@@ -422,6 +386,7 @@ GridItem *Board::AddACrater(const int theGridX, const int theGridY) {
     aCrater->mRenderOrder = MakeRenderOrder(RenderLayer::RENDER_LAYER_GROUND, theGridY, 1);
     aCrater->mGridX = theGridX;
     aCrater->mGridY = theGridY;
+    BoardGridIndex::GridItemChanged(aCrater);
     return aCrater;
 }
 
@@ -432,6 +397,7 @@ GridItem *Board::AddAGraveStone(const int theGridX, const int theGridY) {
     aGraveStone->mRenderOrder = MakeRenderOrder(RenderLayer::RENDER_LAYER_GRAVE_STONE, theGridY, 3);
     aGraveStone->mGridX = theGridX;
     aGraveStone->mGridY = theGridY;
+    BoardGridIndex::GridItemChanged(aGraveStone);
     return aGraveStone;
 }
 
@@ -1350,6 +1316,7 @@ void Board::PlaceRake() {
     aRake->mGridItemType = GridItemType::GRIDITEM_RAKE;
     aRake->mGridX = aGridX;
     aRake->mGridY = aGridY;
+    BoardGridIndex::GridItemChanged(aRake);
     aRake->mPosX = GridToPixelX(aGridX, aGridY);
     aRake->mPosY = GridToPixelY(aGridX, aGridY);
     aRake->mRenderOrder = MakeRenderOrder(RenderLayer::RENDER_LAYER_GRAVE_STONE, aGridY, 9);
@@ -1943,16 +1910,7 @@ int Board::CountSunFlowers() {
 }
 
 // 0x40D3F0
-int Board::CountPlantByType(const SeedType theSeedType) {
-    int aCount = 0;
-    Plant *aPlant = nullptr;
-    while (IteratePlants(aPlant)) {
-        if (aPlant->mSeedType == theSeedType) {
-            aCount++;
-        }
-    }
-    return aCount;
-}
+int Board::CountPlantByType(const SeedType theSeedType) { return mStats.CountPlantByType(theSeedType); }
 
 // 0x40D430
 int Board::CountEmptyPotsOrLilies(const SeedType theSeedType) {
@@ -2142,6 +2100,15 @@ Board::PickZombieType(const int theZombiePoints, const int theWaveIndex, const Z
     }
 
     // 加权随机地取得一种可能的僵尸类型并返回
+    if (mApp->mAliasPicks) {
+        int aWeights[ZombieType::NUM_ZOMBIE_TYPES] = {};
+        for (int i = 0; i < aPickCount; i++) {
+            aWeights[aZombieWeightArray[i].mItem] = aZombieWeightArray[i].mWeight;
+        }
+        if (!mZombieAliasTable.HasWeights(aWeights, ZombieType::NUM_ZOMBIE_TYPES))
+            mZombieAliasTable.Build(aWeights, ZombieType::NUM_ZOMBIE_TYPES);
+        return (ZombieType)mZombieAliasTable.Pick();
+    }
     return (ZombieType)TodPickFromWeightedArray(aZombieWeightArray, aPickCount);
 }
 
@@ -2612,11 +2579,11 @@ void Board::MouseDrag(const int x, const int y) {
 
 // 0x40E780
 Zombie *Board::ZombieHitTest(const int theMouseX, const int theMouseY) {
-    Zombie *aZombie = nullptr;
     Zombie *aRecord = nullptr;
-    while (IterateZombies(aZombie)) {
+    for (const unsigned int aZombieID : mHitGrid.GetZombiesAt(theMouseX, theMouseY)) {
+        Zombie *aZombie = mZombies.DataArrayTryToGet(aZombieID);
         // 排除已死亡的僵尸
-        if (aZombie->mDead || aZombie->IsDeadOrDying()) continue;
+        if (aZombie == nullptr || aZombie->mDead || aZombie->IsDeadOrDying()) continue;
 
         // 排除关卡引入阶段及选卡界面的植物僵尸
         if (mApp->mGameScene == GameScenes::SCENE_LEVEL_INTRO && Zombie::IsZombotany(aZombie->mZombieType)) continue;
@@ -3498,8 +3465,10 @@ void Board::MouseDownWithTool(const int x, const int y, const int theClickCount,
 
 // 0x411280
 Plant *Board::SpecialPlantHitTest(const int x, const int y) {
-    Plant *aPlant = nullptr;
-    while (IteratePlants(aPlant)) {
+    for (const unsigned int aPlantID : mHitGrid.GetSpecialPlantsAt(x, y)) {
+        Plant *aPlant = mPlants.DataArrayTryToGet(aPlantID);
+        if (aPlant == nullptr || aPlant->mDead) continue;
+
         if (aPlant->mSeedType == SeedType::SEED_PUMPKINSHELL) {
             const float aMinDist =
                 GetTopPlantAt(aPlant->mPlantCol, aPlant->mRow, PlantPriority::TOPPLANT_ONLY_NORMAL_POSITION) ? 25 : 0;
@@ -3599,9 +3568,11 @@ bool Board::MouseHitTest(const int x, const int y, HitResult *theHitResult) {
 
     if (mCursorObject->mCursorType == CursorType::CURSOR_TYPE_NORMAL ||
         mCursorObject->mCursorType == CursorType::CURSOR_TYPE_HAMMER) {
-        Coin *aCoin = nullptr;
         const Coin *aTopCoin = nullptr;
-        while (IterateCoins(aCoin)) {
+        for (const unsigned int aCoinID : mHitGrid.GetCoinsAt(x, y)) {
+            Coin *aCoin = mCoins.DataArrayTryToGet(aCoinID);
+            if (aCoin == nullptr || aCoin->mDead) continue;
+
             HitResult aHitResultCoin;
             if (aCoin->MouseHitTest(x, y, &aHitResultCoin)) {
                 aCoin = static_cast<Coin *>(aHitResultCoin.mObject);
@@ -4200,18 +4171,7 @@ void Board::SpawnZombiesFromGraves() {
 }
 
 // 0x412E30
-int Board::TotalZombiesHealthInWave(const int theWaveIndex) {
-    int aTotalHealth = 0;
-    Zombie *aZombie = nullptr;
-    while (IterateZombies(aZombie)) {
-        if (aZombie->mFromWave == theWaveIndex && !aZombie->mMindControlled && !aZombie->IsDeadOrDying() &&
-            aZombie->mZombieType != ZombieType::ZOMBIE_BUNGEE && aZombie->mRelatedZombieID == ZombieID::ZOMBIEID_NULL) {
-            aTotalHealth +=
-                aZombie->mBodyHealth + aZombie->mHelmHealth + aZombie->mShieldHealth * 0.2f + aZombie->mFlyingHealth;
-        }
-    }
-    return aTotalHealth;
-}
+int Board::TotalZombiesHealthInWave(const int theWaveIndex) { return mStats.TotalZombiesHealthInWave(theWaveIndex); }
 
 // 0x412EE0
 void Board::SpawnZombieWave() {
@@ -4263,20 +4223,25 @@ void Board::SpawnZombieWave() {
 
 // 0x4130D0
 void Board::UpdateGameObjects() {
+    mStats.BeginPlantTargeting();
     Plant *aPlant = nullptr;
     while (IteratePlants(aPlant)) {
         aPlant->Update();
     }
+    mStats.EndPlantTargeting();
+    mTimerWheel.Advance();
 
     Zombie *aZombie = nullptr;
     while (IterateZombies(aZombie)) {
         aZombie->Update();
     }
 
+    mProjectileMotion.MoveAhead();
     Projectile *aProjectile = nullptr;
     while (IterateProjectiles(aProjectile)) {
         aProjectile->Update();
     }
+    mProjectileMotion.FinishMoveAhead();
 
     Coin *aCoin = nullptr;
     while (IterateCoins(aCoin)) {
@@ -4287,6 +4252,7 @@ void Board::UpdateGameObjects() {
     while (IterateLawnMowers(aLawnMower)) {
         aLawnMower->Update();
     }
+    mHitGrid.Invalidate();
 
     mCursorPreview->Update();
     mCursorObject->Update();
@@ -4933,6 +4899,8 @@ void Board::UpdateGame() {
 // 0x415D40
 void Board::Update() {
     TodHesitationBracket aHesitation("Board::Update");
+    // Anything can have moved since the last update (the cutscene, the zen garden, the challenge), pick it up again.
+    mHitGrid.Invalidate();
 
     Widget::Update();
     MarkDirty();
@@ -5014,6 +4982,7 @@ void Board::Update() {
     UpdateLevelEndSequence();
     mBoardData.mPrevMouseX = mApp->mWidgetManager->mLastMouseX;
     mBoardData.mPrevMouseY = mApp->mWidgetManager->mLastMouseY;
+    mHitGrid.Invalidate();
 }
 
 // 0x416080
@@ -7282,16 +7251,7 @@ void Board::AddSunMoney(const int theAmount) {
 }
 
 // 0x41B980
-int Board::CountSunBeingCollected() {
-    int aCount = 0;
-    Coin *aCoin = nullptr;
-    while (IterateCoins(aCoin)) {
-        if (aCoin->mIsBeingCollected && aCoin->IsSun()) {
-            aCount += aCoin->GetSunValue();
-        }
-    }
-    return aCount;
-}
+int Board::CountSunBeingCollected() { return mStats.CountSunBeingCollected(); }
 
 // 0x41B9F0
 int Board::CountCoinsBeingCollected() {
@@ -7778,6 +7738,15 @@ bool Board::IterateZombies(Zombie *&theZombie) {
     return false;
 }
 
+bool Board::IterateZombiesInRow(const int theRow, Zombie *&theZombie) {
+    return IterateZombiesInRows(theRow, theRow, theZombie);
+}
+
+bool Board::IterateZombiesInRows(const int theMinRow, const int theMaxRow, Zombie *&theZombie) {
+    theZombie = mStats.GetNextZombieInRows(theMinRow, theMaxRow, theZombie);
+    return theZombie != nullptr;
+}
+
 // 0x41C950
 bool Board::IteratePlants(Plant *&thePlant) {
     while (mPlants.IterateNext(thePlant)) {
@@ -8040,6 +8009,8 @@ bool Board::BungeeIsTargetingCell(const int theGridX, const int theGridY) {
 
 // 0x41D390
 Zombie *Board::GetBossZombie() {
+    if (!mStats.HasBossZombie()) return nullptr;
+
     Zombie *aZombie = nullptr;
     while (IterateZombies(aZombie)) {
         if (aZombie->mZombieType == ZombieType::ZOMBIE_BOSS) {
@@ -8149,7 +8120,7 @@ int Board::KillAllZombiesInRadius(
 ) {
     Zombie *aZombie = nullptr;
     int aKilledZombies = 0; // @Patoke: implemented this
-    while (IterateZombies(aZombie)) {
+    while (IterateZombiesInRows(theRow - theRowRange, theRow + theRowRange, aZombie)) {
         if (aZombie->EffectedByDamage(theDamageRangeFlags)) {
             Rect aZombieRect = aZombie->GetZombieRect();
             int aRowDist = aZombie->mRow - theRow;
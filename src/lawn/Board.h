@@ -5,7 +5,13 @@
 #include "framework/widget/ButtonListener.h"
 #include "framework/widget/Widget.h"
 #include "todlib/DataArray.h"
+#include "todlib/TodCommon.h"
 
+#include "BoardGridIndex.h"
+#include "BoardHitGrid.h"
+#include "BoardProjectileMotion.h"
+#include "BoardStats.h"
+#include "BoardTimerWheel.h"
 #include "Coin.h"
 #include "GridItem.h"
 #include "LawnMower.h"
@@ -225,6 +231,14 @@ public:
     CutScene *mCutScene;                //+0x15C
     Challenge *mChallenge;              //+0x160
     BoardData mBoardData{};             //+0x164-0x57AC
+    BoardStats mStats{this};
+    BoardHitGrid mHitGrid{this};
+    BoardGridIndex mGridIndex{this};
+    BoardProjectileMotion mProjectileMotion{this};
+    BoardTimerWheel mTimerWheel{this};
+    // -aliaspicks: PickZombieType samples this instead of scanning its weights. It is indexed by zombie type and kept
+    // for as long as the weights stay the same, which is most of a wave.
+    TodAliasTable mZombieAliasTable;
 
 public:
     Board(LawnApp *theApp);
@@ -350,6 +364,8 @@ public:
     /*inline*/ void ShakeBoard(int theShakeAmountX, int theShakeAmountY);
     int CountUntriggerLawnMowers();
     bool IterateZombies(Zombie *&theZombie);
+    bool IterateZombiesInRow(int theRow, Zombie *&theZombie);
+    bool IterateZombiesInRows(int theMinRow, int theMaxRow, Zombie *&theZombie);
     bool IteratePlants(Plant *&thePlant);
     bool IterateProjectiles(Projectile *&theProjectile);
     bool IterateCoins(Coin *&theCoin);
@@ -0,0 +1,417 @@
+#include "BoardBenchmark.h"
+
+#include "Board.h"
+#include "Challenge.h"
+#include "GridItem.h"
+#include "LawnApp.h"
+#include "Plant.h"
+#include "Projectile.h"
+#include "Zombie.h"
+#include <algorithm>
+#include <chrono>
+#include <fmt/core.h>
+#include <vector>
+
+#include "system/PlayerInfo.h"
+#include "todlib/EffectSystem.h"
+#include "todlib/Reanimator.h"
+
+using BenchmarkClock = std::chrono::high_resolution_clock;
+
+static double GetMicroseconds(const BenchmarkClock::duration theDuration) {
+    return std::chrono::duration<double, std::micro>(theDuration).count();
+}
+
+// ProfileMgr hands out ids from 1, so no profile's files go by this one.
+constexpr uint32_t SCRATCH_PROFILE_ID = 0;
+
+// Plays theGameMode's level without drawing it, set up the way LawnApp::NewGame does minus the seed chooser and the
+// intro, in a survival mode at the stage that starts after theFlags flags. Board::StartLevel is left out as well, past
+// survival stage 0 it erases the saved game of the mode. theSetUp gets the new board, then theTick runs for each of up
+// to theTicks ticks, and does the updating it times, until it returns false.
+//
+// The level plays on a scratch copy of the current profile under an id of its own. The records, coins, Zen Garden
+// plants and saved games it writes go to the scratch profile's files, which are deleted afterwards.
+template <typename SetUp, typename Tick>
+static void PlayBenchmarkBoard(
+    LawnApp *theApp, const GameMode theGameMode, const int theFlags, const int theTicks, SetUp &&theSetUp,
+    Tick &&theTick
+) {
+    PlayerInfo *aPlayerInfo = theApp->mPlayerInfo;
+    PlayerInfo aScratchProfile = aPlayerInfo != nullptr ? *aPlayerInfo : PlayerInfo();
+    aScratchProfile.mId = SCRATCH_PROFILE_ID;
+    theApp->mPlayerInfo = &aScratchProfile;
+
+    theApp->mGameMode = theGameMode;
+    theApp->MakeNewBoard();
+
+    Board *aBoard = theApp->mBoard;
+    if (theFlags > 0) {
+        aBoard->mChallenge->mSurvivalStage =
+            theFlags * aBoard->GetNumWavesPerFlag() / aBoard->GetNumWavesPerSurvivalStage();
+    }
+    aBoard->InitLevel();
+    aBoard->mChallenge->StartLevel();
+    theApp->mGameScene = GameScenes::SCENE_PLAYING;
+
+    theSetUp(aBoard);
+    for (int aTick = 0; aTick < theTicks; aTick++) {
+        if (!theTick(aBoard, aTick)) break;
+    }
+
+    theApp->KillBoard();
+    theApp->mGameMode = GameMode::GAMEMODE_ADVENTURE;
+    theApp->mGameScene = GameScenes::SCENE_MENU;
+
+    aScratchProfile.DeleteUserFiles();
+    theApp->mPlayerInfo = aPlayerInfo;
+}
+
+void BoardBenchmarkZombieSpawning(LawnApp *theApp) {
+    constexpr int aFlags = 50;
+    constexpr int aTicks = 12000;
+
+    BenchmarkClock::duration aSpawningTime{};
+    BenchmarkClock::duration aStatsTime{};
+    BenchmarkClock::duration aScanTime{};
+    int aMaxZombies = 0;
+    int aMismatches = 0;
+    int aWaves = 0;
+    auto aTick = [&](Board *theBoard, int) {
+        theBoard->UpdateGameObjects();
+
+        // Stand-in for a defense, so the number of zombies levels off the way it does in a real game.
+        int aZombies = 0;
+        Zombie *aZombie = nullptr;
+        while (theBoard->IterateZombies(aZombie)) {
+            if (aZombie->mPosX < 400.0f) aZombie->DieNoLoot();
+            else aZombies++;
+        }
+        aMaxZombies = std::max(aMaxZombies, aZombies);
+
+        const auto aSpawningStart = BenchmarkClock::now();
+        theBoard->mBoardData.mMainCounter++;
+        theBoard->UpdateZombieSpawning();
+        aSpawningTime += BenchmarkClock::now() - aSpawningStart;
+
+        // The query it runs every tick between waves, against the walk it used to be.
+        const int aWave = theBoard->mBoardData.mCurrentWave - 1;
+        const auto aStatsStart = BenchmarkClock::now();
+        const int aStatsHealth = theBoard->TotalZombiesHealthInWave(aWave);
+        const auto aScanStart = BenchmarkClock::now();
+        const int aScanHealth = theBoard->mStats.ScanZombiesHealthInWave(aWave);
+        aScanTime += BenchmarkClock::now() - aScanStart;
+        aStatsTime += aScanStart - aStatsStart;
+        if (aStatsHealth != aScanHealth) aMismatches++;
+
+        aWaves = theBoard->mBoardData.mCurrentWave;
+        return true;
+    };
+    PlayBenchmarkBoard(theApp, GameMode::GAMEMODE_SURVIVAL_ENDLESS_STAGE_1, aFlags, aTicks, [](Board *) {}, aTick);
+
+    if (aMismatches > 0) {
+        fmt::println("warning: spawnbench: wave health differed from the scan on {} ticks", aMismatches);
+    }
+    fmt::println(
+        "spawnbench: survival endless flag {}, {} ticks, {} waves, up to {} zombies: UpdateZombieSpawning {:.2f} us "
+        "per tick, wave health {:.3f} us from the stats, {:.3f} us scanning",
+        aFlags, aTicks, aWaves, aMaxZombies, GetMicroseconds(aSpawningTime) / aTicks,
+        GetMicroseconds(aStatsTime) / aTicks, GetMicroseconds(aScanTime) / aTicks
+    );
+}
+
+// Compares every lookup BoardGridIndex can answer against the first match of the scan it replaced.
+static int CheckGridIndexOnce(Board *theBoard, const GameMode theGameMode, const int theTick) {
+    constexpr int aNumTypes = static_cast<int>(GridItemType::GRIDITEM_IZOMBIE_BRAIN) + 1;
+
+    auto aScan = [theBoard](const GridItemType theType, const int theGridX, const int theGridY) -> GridItem * {
+        GridItem *aGridItem = nullptr;
+        while (theBoard->IterateGridItems(aGridItem)) {
+            if (aGridItem->mGridItemType == theType && aGridItem->mGridX == theGridX && aGridItem->mGridY == theGridY)
+                return aGridItem;
+        }
+        return nullptr;
+    };
+
+    int aMismatches = 0;
+    auto aCheck = [&](const GridItemType theType, const int theGridX, const int theGridY) {
+        if (theBoard->mGridIndex.GetGridItemAt(theType, theGridX, theGridY) == aScan(theType, theGridX, theGridY))
+            return;
+
+        if (aMismatches++ == 0) {
+            fmt::println(
+                "warning: gridindexcheck: game mode {}, tick {}: type {} at ({}, {}) differs from the scan",
+                static_cast<int>(theGameMode), theTick, static_cast<int>(theType), theGridX, theGridY
+            );
+        }
+    };
+
+    for (int aType = 0; aType < aNumTypes; aType++) {
+        for (int aGridX = 0; aGridX < MAX_GRID_SIZE_X; aGridX++) {
+            for (int aGridY = 0; aGridY < MAX_GRID_SIZE_Y; aGridY++) {
+                aCheck(static_cast<GridItemType>(aType), aGridX, aGridY);
+            }
+        }
+    }
+    // Items off the lawn (Stinky, the brains) only carry a placeholder cell, look them up by that.
+    GridItem *aGridItem = nullptr;
+    while (theBoard->IterateGridItems(aGridItem)) {
+        aCheck(aGridItem->mGridItemType, aGridItem->mGridX, aGridItem->mGridY);
+    }
+    return aMismatches;
+}
+
+void BoardCheckGridIndex(LawnApp *theApp) {
+    constexpr int aTicks = 3000;
+
+    int aModes = 0;
+    int aFailedModes = 0;
+    for (int aMode = GameMode::GAMEMODE_SURVIVAL_NORMAL_STAGE_1; aMode < GameMode::GAMEMODE_UPSELL; aMode++) {
+        const auto aGameMode = static_cast<GameMode>(aMode);
+
+        int aMismatches = 0;
+        PlayBenchmarkBoard(
+            theApp, aGameMode, 0, aTicks,
+            [&](Board *theBoard) { aMismatches = CheckGridIndexOnce(theBoard, aGameMode, 0); },
+            [&](Board *theBoard, const int theTick) {
+                if (aMismatches > 0) return false;
+
+                theBoard->Update();
+                aMismatches += CheckGridIndexOnce(theBoard, aGameMode, theTick + 1);
+                return true;
+            }
+        );
+
+        aModes++;
+        if (aMismatches > 0) aFailedModes++;
+    }
+
+    fmt::println(
+        "gridindexcheck: {} game modes, {} ticks each: {}", aModes, aTicks,
+        aFailedModes == 0 ? "the index matched the scan" : fmt::format("{} modes out of sync", aFailedModes)
+    );
+}
+
+void BoardBenchmarkCountdowns(LawnApp *theApp) {
+    constexpr int aWantedPlants = 1000;
+    constexpr int aTicks = 2000;
+    // Plants with a single reanimation that have nothing to shoot at or produce without zombies, so they only count
+    // down and animate.
+    constexpr SeedType aSeedTypes[] = {SeedType::SEED_WALLNUT,  SeedType::SEED_TALLNUT,   SeedType::SEED_POTATOMINE,
+                                       SeedType::SEED_SPIKEWEED, SeedType::SEED_CHOMPER,   SeedType::SEED_GARLIC,
+                                       SeedType::SEED_TORCHWOOD, SeedType::SEED_SQUASH};
+    // Every plant holds a reanimation and blinking takes more, all from one array of fixed size. Stop short of it.
+    constexpr unsigned int aReanimHeadroom = 128;
+
+    const DataArray<Reanimation> &aReanims = theApp->mEffectSystem->mReanimationHolder->mReanimations;
+    int aPlants = 0;
+    // What a timer wheel could take off the tick at most: decrementing and testing every plant's countdowns.
+    std::vector<int> aCountdowns;
+    auto aSetUp = [&](Board *theBoard) {
+        while (aPlants < aWantedPlants && aReanims.mSize + aReanimHeadroom < aReanims.mMaxSize) {
+            const int aCell = aPlants % (MAX_GRID_SIZE_X * 5);
+            theBoard->NewPlant(
+                aCell % MAX_GRID_SIZE_X, aCell / MAX_GRID_SIZE_X, aSeedTypes[aPlants % std::size(aSeedTypes)]
+            );
+            aPlants++;
+        }
+        aCountdowns.resize(3 * theBoard->mPlants.mMaxSize);
+    };
+
+    // Run as separate passes over all plants so each part of Plant::Update can be timed on its own.
+    BenchmarkClock::duration aAbilitiesTime{};
+    BenchmarkClock::duration aAnimateTime{};
+    BenchmarkClock::duration aReanimTime{};
+    BenchmarkClock::duration aCountdownTime{};
+    BenchmarkClock::duration aWheelTime{};
+    int aExpired = 0;
+    auto aTick = [&](Board *theBoard, int) {
+        auto aTimePass = [theBoard](BenchmarkClock::duration &theTime, auto &&thePass) {
+            const auto aStart = BenchmarkClock::now();
+            Plant *aPlant = nullptr;
+            while (theBoard->IteratePlants(aPlant)) {
+                thePass(aPlant);
+            }
+            theTime += BenchmarkClock::now() - aStart;
+        };
+
+        aTimePass(aAbilitiesTime, [](Plant *thePlant) { thePlant->UpdateAbilities(); });
+        aTimePass(aAnimateTime, [](Plant *thePlant) { thePlant->Animate(); });
+        aTimePass(aReanimTime, [](Plant *thePlant) { thePlant->UpdateReanim(); });
+        // Under -timerwheel Animate leaves the blinks to the wheel, which fires them after the plant pass.
+        const auto aWheelStart = BenchmarkClock::now();
+        theBoard->mTimerWheel.Advance();
+        aWheelTime += BenchmarkClock::now() - aWheelStart;
+        aTimePass(aCountdownTime, [&](Plant *thePlant) {
+            int *aCountdown = &aCountdowns[3 * theBoard->mPlants.DataArrayGetSlot(thePlant)];
+            for (const int aValue : {thePlant->mStateCountdown, thePlant->mLaunchCounter, thePlant->mBlinkCountdown}) {
+                *aCountdown = aValue - 1;
+                if (*aCountdown++ == 0) aExpired++;
+            }
+        });
+        return true;
+    };
+    PlayBenchmarkBoard(theApp, GameMode::GAMEMODE_SURVIVAL_NORMAL_STAGE_1, 0, aTicks, aSetUp, aTick);
+
+    const double aUpdateTime = GetMicroseconds(aAbilitiesTime + aAnimateTime + aReanimTime) / aTicks;
+    fmt::println(
+        "countdownbench: {} idle plants, {} ticks: Plant::Update {:.1f} us per tick (abilities {:.1f}, Animate {:.1f}, "
+        "UpdateReanim {:.1f}), counting down alone {:.1f} us ({} expired)",
+        aPlants, aTicks, aUpdateTime, GetMicroseconds(aAbilitiesTime) / aTicks, GetMicroseconds(aAnimateTime) / aTicks,
+        GetMicroseconds(aReanimTime) / aTicks, GetMicroseconds(aCountdownTime) / aTicks, aExpired
+    );
+    if (theApp->mTimerWheelMode) {
+        fmt::println("countdownbench: timer wheel {:.1f} us per tick", GetMicroseconds(aWheelTime) / aTicks);
+    }
+}
+
+void BoardBenchmarkTargeting(LawnApp *theApp) {
+    constexpr int aFlags = 40;
+    constexpr int aTicks = 6000;
+    constexpr int aWantedPlants = 45;
+
+    std::vector<std::pair<int, int>> aCells;
+    // Put back what the zombies ate, so the number of shooters stays the same throughout.
+    auto aReplant = [&aCells](Board *theBoard) {
+        for (const auto &[aGridX, aGridY] : aCells) {
+            if (theBoard->mBoardData.mPlantRow[aGridY] == PlantRowType::PLANTROW_POOL &&
+                theBoard->GetTopPlantAt(aGridX, aGridY, PlantPriority::TOPPLANT_ONLY_UNDER_PLANT) == nullptr) {
+                theBoard->NewPlant(aGridX, aGridY, SeedType::SEED_LILYPAD);
+            }
+            if (theBoard->GetTopPlantAt(aGridX, aGridY, PlantPriority::TOPPLANT_ONLY_NORMAL_POSITION) == nullptr) {
+                theBoard->NewPlant(aGridX, aGridY, SeedType::SEED_GATLINGPEA);
+            }
+        }
+    };
+    auto aSetUp = [&](Board *theBoard) {
+        // Column by column over the rows that take plants, so every row gets its share.
+        for (int aGridX = 0; aGridX < MAX_GRID_SIZE_X && static_cast<int>(aCells.size()) < aWantedPlants; aGridX++) {
+            for (int aGridY = 0; aGridY < MAX_GRID_SIZE_Y && static_cast<int>(aCells.size()) < aWantedPlants;
+                 aGridY++) {
+                if (theBoard->mBoardData.mPlantRow[aGridY] != PlantRowType::PLANTROW_DIRT)
+                    aCells.emplace_back(aGridX, aGridY);
+            }
+        }
+        aReplant(theBoard);
+    };
+
+    BenchmarkClock::duration aCacheTime{};
+    BenchmarkClock::duration aScanTime{};
+    BenchmarkClock::duration aPassTime[2]{};
+    long long aQueries = 0;
+    int aMismatches = 0;
+    int aMaxZombies = 0;
+    auto aTick = [&](Board *theBoard, const int theTick) {
+        // Every Gatling Pea asks once per tick, through the lists and through the scan.
+        theBoard->mStats.BeginPlantTargeting();
+        Plant *aPlant = nullptr;
+        while (theBoard->IteratePlants(aPlant)) {
+            if (aPlant->mSeedType != SeedType::SEED_GATLINGPEA) continue;
+
+            const auto aCacheStart = BenchmarkClock::now();
+            Zombie *aTarget = aPlant->FindTargetZombie(aPlant->mRow);
+            const auto aScanStart = BenchmarkClock::now();
+            Zombie *aScanTarget = aPlant->ScanTargetZombie(aPlant->mRow);
+            aScanTime += BenchmarkClock::now() - aScanStart;
+            aCacheTime += aScanStart - aCacheStart;
+            if (aTarget != aScanTarget) aMismatches++;
+            aQueries++;
+        }
+        theBoard->mStats.EndPlantTargeting();
+
+        // The real tick, every other one without the lists.
+        const bool aUseCache = theTick % 2 == 0;
+        theBoard->mStats.EnableTargetCache(aUseCache);
+        const auto aPassStart = BenchmarkClock::now();
+        theBoard->UpdateGameObjects();
+        aPassTime[aUseCache] += BenchmarkClock::now() - aPassStart;
+        theBoard->mStats.EnableTargetCache(true);
+
+        // Stand-in for the lawn mowers, the level must not end.
+        int aZombies = 0;
+        Zombie *aZombie = nullptr;
+        while (theBoard->IterateZombies(aZombie)) {
+            if (aZombie->mPosX < 0.0f) aZombie->DieNoLoot();
+            else aZombies++;
+        }
+        aMaxZombies = std::max(aMaxZombies, aZombies);
+
+        theBoard->mBoardData.mMainCounter++;
+        theBoard->UpdateZombieSpawning();
+        aReplant(theBoard);
+        return true;
+    };
+    PlayBenchmarkBoard(theApp, GameMode::GAMEMODE_SURVIVAL_ENDLESS_STAGE_1, aFlags, aTicks, aSetUp, aTick);
+
+    if (aMismatches > 0) fmt::println("warning: targetbench: {} targets differed from the scan", aMismatches);
+    fmt::println(
+        "targetbench: survival endless flag {}, {} Gatling Peas, {} ticks, up to {} zombies: FindTargetZombie {:.3f} "
+        "us from the row lists, {:.3f} us scanning; UpdateGameObjects {:.1f} us per tick with the lists, {:.1f} us "
+        "without",
+        aFlags, aCells.size(), aTicks, aMaxZombies, GetMicroseconds(aCacheTime) / aQueries,
+        GetMicroseconds(aScanTime) / aQueries, GetMicroseconds(aPassTime[1]) / (aTicks / 2),
+        GetMicroseconds(aPassTime[0]) / (aTicks / 2)
+    );
+}
+
+void BoardBenchmarkProjectiles(LawnApp *theApp) {
+    constexpr int aWantedProjectiles = 1000;
+    constexpr int aTicks = 4000;
+
+    // Three peas to every cabbage, as from a lawn of peashooters with some cabbage-pults, spread over the lawn.
+    int aAdded = 0;
+    auto aTopUp = [&aAdded](Board *theBoard) {
+        while (theBoard->mProjectiles.mSize < static_cast<unsigned int>(aWantedProjectiles)) {
+            const int aRow = aAdded % 5;
+            const int aX = 40 + aAdded * 37 % 640;
+            const int aY = theBoard->GridToPixelY(0, aRow);
+            const bool aIsCabbage = aAdded % 4 == 3;
+            Projectile *aProjectile = theBoard->AddProjectile(
+                aX, aY, Board::MakeRenderOrder(RenderLayer::RENDER_LAYER_PROJECTILE, aRow, 0), aRow,
+                aIsCabbage ? ProjectileType::PROJECTILE_CABBAGE : ProjectileType::PROJECTILE_PEA
+            );
+            if (aIsCabbage) {
+                aProjectile->mMotionType = ProjectileMotion::MOTION_LOBBED;
+                aProjectile->mVelX = 3.0f;
+                aProjectile->mVelY = 0.0f;
+                aProjectile->mVelZ = -7.0f;
+                aProjectile->mAccZ = 0.115f;
+            }
+            aAdded++;
+        }
+    };
+
+    BenchmarkClock::duration aPassTime[2]{};
+    auto aTick = [&](Board *theBoard, const int theTick) {
+        aTopUp(theBoard);
+
+        const bool aMoveAhead = theTick % 2 == 0;
+        theBoard->mProjectileMotion.Enable(aMoveAhead);
+        const auto aPassStart = BenchmarkClock::now();
+        theBoard->UpdateGameObjects();
+        aPassTime[aMoveAhead] += BenchmarkClock::now() - aPassStart;
+
+        // Nothing to hit here, so the cabbages would splat on the ground, each with a particle effect. Throw them again
+        // just before that instead; the peas leave the lawn and are replaced.
+        Projectile *aProjectile = nullptr;
+        while (theBoard->IterateProjectiles(aProjectile)) {
+            if (aProjectile->mMotionType == ProjectileMotion::MOTION_LOBBED && aProjectile->mVelZ > 0.0f &&
+                aProjectile->mPosZ > 0.0f) {
+                aProjectile->mPosX = 40.0f;
+                aProjectile->mPosZ = 0.0f;
+                aProjectile->mVelZ = -7.0f;
+            }
+        }
+        theBoard->ProcessDeleteQueue();
+        return true;
+    };
+    PlayBenchmarkBoard(theApp, GameMode::GAMEMODE_SURVIVAL_NORMAL_STAGE_1, 0, aTicks, [](Board *) {}, aTick);
+
+    const double aWith = GetMicroseconds(aPassTime[1]) / (aTicks / 2);
+    const double aWithout = GetMicroseconds(aPassTime[0]) / (aTicks / 2);
+    fmt::println(
+        "projectilebench: {} projectiles, {} ticks: UpdateGameObjects {:.1f} us per tick ({:.1f} M projectiles/s) "
+        "moving ahead, {:.1f} us ({:.1f} M/s) one by one",
+        aWantedProjectiles, aTicks, aWith, aWantedProjectiles / aWith, aWithout, aWantedProjectiles / aWithout
+    );
+}
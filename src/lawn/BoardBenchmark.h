@@ -0,0 +1,24 @@
+#ifndef __BOARDBENCHMARK_H__
+#define __BOARDBENCHMARK_H__
+
+class LawnApp;
+
+// Benchmarks and self-checks of the board logic behind the command line switches, run once loading has finished.
+// Each one plays levels of its own without drawing them, on a scratch profile that is deleted afterwards, and prints
+// its results, then the game goes on to the menu as usual.
+
+// -spawnbench: UpdateZombieSpawning in Survival Endless at flag 50.
+void BoardBenchmarkZombieSpawning(LawnApp *theApp);
+// -gridindexcheck: BoardGridIndex against a full scan of the grid items, after every tick of every challenge, puzzle
+// and survival mode.
+void BoardCheckGridIndex(LawnApp *theApp);
+// -countdownbench: the parts of Plant::Update with a lawn full of idle plants, next to a pass that only counts down
+// their countdowns. With -timerwheel it times the wheel's blinks as well.
+void BoardBenchmarkCountdowns(LawnApp *theApp);
+// -targetbench: Plant::FindTargetZombie for 45 Gatling Peas in Survival Endless at flag 40, from the row target lists
+// of BoardStats and from the scan.
+void BoardBenchmarkTargeting(LawnApp *theApp);
+// -projectilebench: the projectile pass with 1000 live peas and cabbages, with and without BoardProjectileMotion.
+void BoardBenchmarkProjectiles(LawnApp *theApp);
+
+#endif
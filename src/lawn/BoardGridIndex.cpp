@@ -0,0 +1,76 @@
+#include "BoardGridIndex.h"
+
+#include "Board.h"
+#include "GridItem.h"
+#include "todlib/TodDebug.h"
+#include <algorithm>
+
+// Stinky and the zombiquarium brains wander freely and only carry a placeholder cell, keep them out of the lawn cells.
+static bool IsOnGrid(const GridItemType theGridItemType, const int theGridX, const int theGridY) {
+    return theGridItemType != GridItemType::GRIDITEM_STINKY && theGridItemType != GridItemType::GRIDITEM_BRAIN &&
+           theGridX >= 0 && theGridX < MAX_GRID_SIZE_X && theGridY >= 0 && theGridY < MAX_GRID_SIZE_Y;
+}
+
+std::vector<int> &BoardGridIndex::GetSlots(const GridItemType theGridItemType, const int theGridX, const int theGridY) {
+    return IsOnGrid(theGridItemType, theGridX, theGridY) ? mCells[theGridX * MAX_GRID_SIZE_Y + theGridY] : mOffGrid;
+}
+
+void BoardGridIndex::Rebuild() {
+    mEntries.assign(mBoard->mGridItems.mMaxSize, Entry{});
+    mCells.assign(MAX_GRID_SIZE_X * MAX_GRID_SIZE_Y, {});
+    mOffGrid.clear();
+
+    GridItem *aGridItem = nullptr;
+    while (mBoard->mGridItems.IterateNext(aGridItem)) {
+        UpdateGridItem(aGridItem);
+    }
+}
+
+void BoardGridIndex::UpdateGridItem(GridItem *theGridItem) {
+    const int aSlot = mBoard->mGridItems.DataArrayGetSlot(theGridItem);
+    if (aSlot < 0 || aSlot >= static_cast<int>(mEntries.size())) return;
+
+    Entry &aEntry = mEntries[aSlot];
+    if (aEntry.mIndexed) {
+        std::vector<int> &aSlots = GetSlots(aEntry.mGridItemType, aEntry.mGridX, aEntry.mGridY);
+        aSlots.erase(std::lower_bound(aSlots.begin(), aSlots.end(), aSlot));
+    }
+
+    aEntry = Entry{!theGridItem->mDead, theGridItem->mGridItemType, theGridItem->mGridX, theGridItem->mGridY};
+    if (aEntry.mIndexed) {
+        std::vector<int> &aSlots = GetSlots(aEntry.mGridItemType, aEntry.mGridX, aEntry.mGridY);
+        aSlots.insert(std::lower_bound(aSlots.begin(), aSlots.end(), aSlot), aSlot);
+    }
+}
+
+void BoardGridIndex::GridItemChanged(GridItem *theGridItem) {
+    if (theGridItem->mBoard) theGridItem->mBoard->mGridIndex.UpdateGridItem(theGridItem);
+}
+
+GridItem *BoardGridIndex::GetGridItemAt(const GridItemType theGridItemType, const int theGridX, const int theGridY) {
+    GridItem *aFound = nullptr;
+    for (const int aSlot : GetSlots(theGridItemType, theGridX, theGridY)) {
+        const Entry &aEntry = mEntries[aSlot];
+        if (aEntry.mGridItemType == theGridItemType && aEntry.mGridX == theGridX && aEntry.mGridY == theGridY) {
+            aFound = &mBoard->mGridItems.mBlock[aSlot].mItem;
+            break;
+        }
+    }
+
+#ifdef _DEBUG
+    GridItem *aScanFound = nullptr;
+    GridItem *aGridItem = nullptr;
+    while (mBoard->IterateGridItems(aGridItem)) {
+        if (aGridItem->mGridX == theGridX && aGridItem->mGridY == theGridY &&
+            aGridItem->mGridItemType == theGridItemType) {
+            aScanFound = aGridItem;
+            break;
+        }
+    }
+    TOD_ASSERT(
+        aFound == aScanFound, "Grid item index out of sync for type %d at (%d, %d)", static_cast<int>(theGridItemType),
+        theGridX, theGridY
+    );
+#endif
+    return aFound;
+}
@@ -0,0 +1,46 @@
+#ifndef __BOARDGRIDINDEX_H__
+#define __BOARDGRIDINDEX_H__
+
+#include "ConstEnums.h"
+#include <vector>
+
+class Board;
+class GridItem;
+
+// Lookup of the board's grid items by cell, behind Board::GetGridItemAt and the GetCraterAt/GetLadderAt/... wrappers
+// that zombies, CanPlantAt and the challenges ask every tick.
+//
+// Each cell keeps the data array slots of the live items on it in ascending order, so the first match is the one the
+// old scan found; items that aren't on a lawn cell (Stinky, the zombiquarium brains) go in a separate list. Items
+// report themselves through GridItemChanged() once their type and cell are set, when they move and from GridItemDie().
+// As with BoardStats, debug builds check every lookup against a full scan.
+class BoardGridIndex {
+protected:
+    struct Entry {
+        bool mIndexed;
+        GridItemType mGridItemType;
+        int mGridX;
+        int mGridY;
+    };
+
+    Board *mBoard;
+    std::vector<Entry> mEntries;
+    std::vector<std::vector<int>> mCells;
+    std::vector<int> mOffGrid;
+
+    std::vector<int> &GetSlots(GridItemType theGridItemType, int theGridX, int theGridY);
+    void UpdateGridItem(GridItem *theGridItem);
+
+public:
+    explicit BoardGridIndex(Board *theBoard) : mBoard(theBoard) {}
+
+    // Reindexes everything, for when the data array was filled or emptied without going through the items (board
+    // creation, loading a save, DataArrayFreeAll).
+    void Rebuild();
+
+    static void GridItemChanged(GridItem *theGridItem);
+
+    GridItem *GetGridItemAt(GridItemType theGridItemType, int theGridX, int theGridY);
+};
+
+#endif
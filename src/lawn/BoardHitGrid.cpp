@@ -0,0 +1,77 @@
+#include "BoardHitGrid.h"
+
+#include "Board.h"
+#include <algorithm>
+#include <cmath>
+
+// Bucketed rects are grown by this much, so a hit test that runs after something moved but before the next
+// Invalidate() (a mouse event handled mid update) still finds it in the cell it moved into.
+static constexpr int HIT_GRID_SLACK = 10;
+
+BoardHitGrid::Cell &BoardHitGrid::GetCell(const int x, const int y) {
+    if (!mValid || mCoinsNextKey != mBoard->mCoins.mNextKey || mZombiesNextKey != mBoard->mZombies.mNextKey ||
+        mPlantsNextKey != mBoard->mPlants.mNextKey) {
+        Rebuild();
+    }
+
+    // Points off the board land in the edge cells, which also hold everything that hangs over the edge.
+    const int aCellX = std::clamp(x / CELL_SIZE, 0, NUM_CELLS_X - 1);
+    const int aCellY = std::clamp(y / CELL_SIZE, 0, NUM_CELLS_Y - 1);
+    return mCells[aCellY * NUM_CELLS_X + aCellX];
+}
+
+void BoardHitGrid::AddToCells(const Rect &theRect, std::vector<unsigned int> Cell::*theList, const unsigned int theID) {
+    const int aLeft = std::clamp((theRect.mX - HIT_GRID_SLACK) / CELL_SIZE, 0, NUM_CELLS_X - 1);
+    const int aRight = std::clamp((theRect.mX + theRect.mWidth + HIT_GRID_SLACK) / CELL_SIZE, 0, NUM_CELLS_X - 1);
+    const int aTop = std::clamp((theRect.mY - HIT_GRID_SLACK) / CELL_SIZE, 0, NUM_CELLS_Y - 1);
+    const int aBottom = std::clamp((theRect.mY + theRect.mHeight + HIT_GRID_SLACK) / CELL_SIZE, 0, NUM_CELLS_Y - 1);
+    for (int aCellY = aTop; aCellY <= aBottom; aCellY++) {
+        for (int aCellX = aLeft; aCellX <= aRight; aCellX++) {
+            (mCells[aCellY * NUM_CELLS_X + aCellX].*theList).push_back(theID);
+        }
+    }
+}
+
+void BoardHitGrid::Rebuild() {
+    for (Cell &aCell : mCells) {
+        aCell.mCoins.clear();
+        aCell.mZombies.clear();
+        aCell.mSpecialPlants.clear();
+    }
+
+    // The rects cover the largest area the exact tests can accept (Coin::MouseHitTest with the whack-a-zombie and sun
+    // margins, the pumpkin and flying plant distances of Board::SpecialPlantHitTest). Everything goes in in data array
+    // order, which the callers' tie breaks depend on.
+    Coin *aCoin = nullptr;
+    while (mBoard->IterateCoins(aCoin)) {
+        const int aPosX = static_cast<int>(std::floor(aCoin->mPosX));
+        const int aPosY = static_cast<int>(std::floor(aCoin->mPosY));
+        const Rect aRect(aPosX - 15, aPosY - 35, aCoin->mWidth + 31, aCoin->mHeight + 81);
+        AddToCells(aRect, &Cell::mCoins, mBoard->mCoins.DataArrayGetID(aCoin));
+    }
+
+    Zombie *aZombie = nullptr;
+    while (mBoard->IterateZombies(aZombie)) {
+        if (aZombie->IsDeadOrDying()) continue;
+
+        AddToCells(aZombie->GetZombieRect(), &Cell::mZombies, mBoard->mZombies.DataArrayGetID(aZombie));
+    }
+
+    Plant *aPlant = nullptr;
+    while (mBoard->IteratePlants(aPlant)) {
+        Rect aRect;
+        if (aPlant->mSeedType == SeedType::SEED_PUMPKINSHELL) {
+            aRect = Rect(aPlant->mX - 10, aPlant->mY - 10, 101, 101);
+        } else if (Plant::IsFlying(aPlant->mSeedType)) {
+            aRect = Rect(aPlant->mX + 25, aPlant->mY - 15, 31, 31);
+        } else {
+            continue;
+        }
+        AddToCells(aRect, &Cell::mSpecialPlants, mBoard->mPlants.DataArrayGetID(aPlant));
+    }
+
+    mCoinsNextKey = mBoard->mCoins.mNextKey;
+    mZombiesNextKey = mBoard->mZombies.mNextKey;
+    mPlantsNextKey = mBoard->mPlants.mNextKey;
+    mValid = true;
+}
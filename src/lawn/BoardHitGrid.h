@@ -0,0 +1,52 @@
+#ifndef __BOARDHITGRID_H__
+#define __BOARDHITGRID_H__
+
+#include "GameConstants.h"
+#include "framework/misc/Rect.h"
+#include <vector>
+
+class Board;
+
+using namespace Sexy;
+
+// Screen space buckets for the board's mouse picking. Board::MouseHitTest, ZombieHitTest and SpecialPlantHitTest
+// run several times per frame, and with a few hundred coins on screen walking every coin each time shows up in
+// profiles. The grid keeps, per 80x80 cell, the ids of the coins, zombies and pumpkin/flying plants whose clickable
+// area overlaps it, in data array order, so callers only run the exact hit test on those and keep their tie rules.
+//
+// The buckets are rebuilt on first use after Invalidate(), which the board calls whenever objects get to move (around
+// its update), and after anything was added to the data arrays.
+class BoardHitGrid {
+protected:
+    static constexpr int CELL_SIZE = 80;
+    static constexpr int NUM_CELLS_X = (BOARD_WIDTH + CELL_SIZE - 1) / CELL_SIZE;
+    static constexpr int NUM_CELLS_Y = (BOARD_HEIGHT + CELL_SIZE - 1) / CELL_SIZE;
+
+    struct Cell {
+        std::vector<unsigned int> mCoins;
+        std::vector<unsigned int> mZombies;
+        std::vector<unsigned int> mSpecialPlants;
+    };
+
+    Board *mBoard;
+    Cell mCells[NUM_CELLS_X * NUM_CELLS_Y];
+    bool mValid = false;
+    size_t mCoinsNextKey = 0;
+    size_t mZombiesNextKey = 0;
+    size_t mPlantsNextKey = 0;
+
+    void Rebuild();
+    void AddToCells(const Rect &theRect, std::vector<unsigned int> Cell::*theList, unsigned int theID);
+    Cell &GetCell(int x, int y);
+
+public:
+    explicit BoardHitGrid(Board *theBoard) : mBoard(theBoard) {}
+
+    void Invalidate() { mValid = false; }
+
+    const std::vector<unsigned int> &GetCoinsAt(int x, int y) { return GetCell(x, y).mCoins; }
+    const std::vector<unsigned int> &GetZombiesAt(int x, int y) { return GetCell(x, y).mZombies; }
+    const std::vector<unsigned int> &GetSpecialPlantsAt(int x, int y) { return GetCell(x, y).mSpecialPlants; }
+};
+
+#endif
@@ -0,0 +1,145 @@
+#include "BoardProjectileMotion.h"
+
+#include "Board.h"
+#include "LawnApp.h"
+#include "Projectile.h"
+
+void BoardProjectileMotion::MotionTable::Clear() {
+    mSlots.clear();
+    mPosX.clear();
+    mPosY.clear();
+    mPosZ.clear();
+    mVelX.clear();
+    mVelY.clear();
+    mVelZ.clear();
+    mAccZ.clear();
+    mNumStraight = 0;
+}
+
+void BoardProjectileMotion::MotionTable::Add(const int theSlot, const Projectile *theProjectile) {
+    mSlots.push_back(theSlot);
+    mPosX.push_back(theProjectile->mPosX);
+    mPosY.push_back(theProjectile->mPosY);
+    mPosZ.push_back(theProjectile->mPosZ);
+    mVelX.push_back(theProjectile->mVelX);
+    mVelY.push_back(theProjectile->mVelY);
+    mVelZ.push_back(theProjectile->mVelZ);
+    mAccZ.push_back(theProjectile->mAccZ);
+}
+
+void BoardProjectileMotion::MotionTable::Resize() {
+    mMovedPosX.resize(mSlots.size());
+    mMovedPosY.resize(mSlots.size());
+    mMovedPosZ.resize(mSlots.size());
+    mMovedVelZ.resize(mSlots.size());
+}
+
+// What UpdateNormalMotion does in its last branch.
+bool BoardProjectileMotion::IsStraight(const Projectile *theProjectile) {
+    return theProjectile->mMotionType == ProjectileMotion::MOTION_STRAIGHT ||
+           theProjectile->mMotionType == ProjectileMotion::MOTION_PUFF;
+}
+
+// The cob's jump to its target is left to UpdateLobMotion.
+bool BoardProjectileMotion::IsLobbed(const Projectile *theProjectile) {
+    return theProjectile->mMotionType == ProjectileMotion::MOTION_LOBBED &&
+           theProjectile->mProjectileType != ProjectileType::PROJECTILE_COBBIG;
+}
+
+void BoardProjectileMotion::MoveAhead() {
+    mTable.Clear();
+    if (!mEnabled) return;
+
+    if (mRowBySlot.size() != mBoard->mProjectiles.mMaxSize) {
+        mRowBySlot.assign(mBoard->mProjectiles.mMaxSize, -1);
+    }
+
+    Projectile *aProjectile = nullptr;
+    while (mBoard->IterateProjectiles(aProjectile)) {
+        if (IsStraight(aProjectile)) mTable.Add(mBoard->mProjectiles.DataArrayGetSlot(aProjectile), aProjectile);
+    }
+    mTable.mNumStraight = mTable.Size();
+    aProjectile = nullptr;
+    while (mBoard->IterateProjectiles(aProjectile)) {
+        if (IsLobbed(aProjectile)) mTable.Add(mBoard->mProjectiles.DataArrayGetSlot(aProjectile), aProjectile);
+    }
+    mTable.Resize();
+    for (int aRow = 0; aRow < mTable.Size(); aRow++) {
+        mRowBySlot[mTable.mSlots[aRow]] = aRow;
+    }
+
+    // The kernels, as plain loops over the columns so that they vectorize. Each line is the same operation on the
+    // same operands as in Projectile::UpdateNormalMotion and UpdateLobMotion.
+    const bool aHighGravity = mBoard->mApp->mGameMode == GameMode::GAMEMODE_CHALLENGE_HIGH_GRAVITY;
+    const int aNumStraight = mTable.mNumStraight;
+    const int aNumRows = mTable.Size();
+    const float *aPosX = mTable.mPosX.data();
+    const float *aPosY = mTable.mPosY.data();
+    const float *aPosZ = mTable.mPosZ.data();
+    const float *aVelX = mTable.mVelX.data();
+    const float *aVelY = mTable.mVelY.data();
+    const float *aVelZ = mTable.mVelZ.data();
+    const float *aAccZ = mTable.mAccZ.data();
+    float *aMovedPosX = mTable.mMovedPosX.data();
+    float *aMovedPosY = mTable.mMovedPosY.data();
+    float *aMovedPosZ = mTable.mMovedPosZ.data();
+    float *aMovedVelZ = mTable.mMovedVelZ.data();
+
+    for (int i = 0; i < aNumStraight; i++) {
+        aMovedPosX[i] = aPosX[i] + 3.33f;
+        aMovedPosZ[i] = aPosZ[i];
+    }
+    if (aHighGravity) {
+        for (int i = 0; i < aNumStraight; i++) {
+            aMovedVelZ[i] = aVelZ[i] + 0.2f;
+            aMovedPosY[i] = aPosY[i] + aMovedVelZ[i];
+        }
+    } else {
+        for (int i = 0; i < aNumStraight; i++) {
+            aMovedVelZ[i] = aVelZ[i];
+            aMovedPosY[i] = aPosY[i];
+        }
+    }
+
+    for (int i = aNumStraight; i < aNumRows; i++) {
+        aMovedVelZ[i] = aVelZ[i] + aAccZ[i];
+    }
+    if (aHighGravity) {
+        for (int i = aNumStraight; i < aNumRows; i++) {
+            aMovedVelZ[i] = aMovedVelZ[i] + aAccZ[i];
+        }
+    }
+    for (int i = aNumStraight; i < aNumRows; i++) {
+        aMovedPosX[i] = aPosX[i] + aVelX[i];
+        aMovedPosY[i] = aPosY[i] + aVelY[i];
+        aMovedPosZ[i] = aPosZ[i] + aMovedVelZ[i];
+    }
+}
+
+bool BoardProjectileMotion::ApplyMoveAhead(Projectile *theProjectile) {
+    const int aSlot = mBoard->mProjectiles.DataArrayGetSlot(theProjectile);
+    if (aSlot < 0 || aSlot >= static_cast<int>(mRowBySlot.size()) || mRowBySlot[aSlot] < 0) return false;
+
+    const int aRow = mRowBySlot[aSlot];
+    mRowBySlot[aSlot] = -1;
+    const bool aWasStraight = aRow < mTable.mNumStraight;
+    if (aWasStraight ? !IsStraight(theProjectile) : !IsLobbed(theProjectile)) return false;
+    if (theProjectile->mPosX != mTable.mPosX[aRow] || theProjectile->mPosY != mTable.mPosY[aRow] ||
+        theProjectile->mPosZ != mTable.mPosZ[aRow] || theProjectile->mVelX != mTable.mVelX[aRow] ||
+        theProjectile->mVelY != mTable.mVelY[aRow] || theProjectile->mVelZ != mTable.mVelZ[aRow] ||
+        theProjectile->mAccZ != mTable.mAccZ[aRow])
+        return false;
+
+    theProjectile->mPosX = mTable.mMovedPosX[aRow];
+    theProjectile->mPosY = mTable.mMovedPosY[aRow];
+    theProjectile->mPosZ = mTable.mMovedPosZ[aRow];
+    theProjectile->mVelZ = mTable.mMovedVelZ[aRow];
+    return true;
+}
+
+void BoardProjectileMotion::FinishMoveAhead() {
+    for (const int aSlot : mTable.mSlots) {
+        mRowBySlot[aSlot] = -1;
+    }
+    mTable.Clear();
+}
@@ -0,0 +1,65 @@
+#ifndef __BOARDPROJECTILEMOTION_H__
+#define __BOARDPROJECTILEMOTION_H__
+
+#include <vector>
+
+class Board;
+class Projectile;
+
+// Moves the straight and lobbed projectiles, which are nearly all of them, ahead of the projectile pass of
+// Board::UpdateGameObjects. It runs one loop per motion over packed arrays that the compiler vectorizes, instead of
+// going through the motion switch of Projectile::UpdateMotion one projectile at a time.
+//
+// Collision checks still run on each projectile's own turn, in data array order, because an earlier projectile can
+// kill the zombie a later one would have hit. The moves don't depend on each other, so MoveAhead() copies the motion
+// fields of every candidate and advances the copies. Each projectile takes its result in ApplyMoveAhead() on its
+// turn. A projectile whose fields no longer match the copy by then moves on its own as before, and so does any that
+// never asks. The kernels use the same float operations in the same order, so the results are bit for bit the same.
+class BoardProjectileMotion {
+protected:
+    // One array per field, indexed by row. The straight projectiles come first, then the lobbed ones.
+    struct MotionTable {
+        std::vector<int> mSlots;
+        std::vector<float> mPosX;
+        std::vector<float> mPosY;
+        std::vector<float> mPosZ;
+        std::vector<float> mVelX;
+        std::vector<float> mVelY;
+        std::vector<float> mVelZ;
+        std::vector<float> mAccZ;
+        std::vector<float> mMovedPosX;
+        std::vector<float> mMovedPosY;
+        std::vector<float> mMovedPosZ;
+        std::vector<float> mMovedVelZ;
+        int mNumStraight = 0;
+
+        void Clear();
+        void Add(int theSlot, const Projectile *theProjectile);
+        void Resize();
+        int Size() const { return static_cast<int>(mSlots.size()); }
+    };
+
+    Board *mBoard;
+    bool mEnabled = true;
+    MotionTable mTable;
+    std::vector<int> mRowBySlot;
+
+    static bool IsStraight(const Projectile *theProjectile);
+    static bool IsLobbed(const Projectile *theProjectile);
+
+public:
+    explicit BoardProjectileMotion(Board *theBoard) : mBoard(theBoard) {}
+
+    // Copies and advances every straight and lobbed projectile, before the projectile pass.
+    void MoveAhead();
+    // Hands theProjectile the position it was moved to, when it was moved ahead and hasn't changed since. Returns false
+    // when theProjectile has to move itself.
+    bool ApplyMoveAhead(Projectile *theProjectile);
+    // Drops what the pass didn't pick up, after the projectile pass.
+    void FinishMoveAhead();
+
+    // Off leaves every projectile to move itself, for -projectilebench.
+    void Enable(bool theEnable) { mEnabled = theEnable; }
+};
+
+#endif
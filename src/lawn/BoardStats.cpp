@@ -0,0 +1,389 @@
+#include "BoardStats.h"
+
+#include "Board.h"
+#include "todlib/TodDebug.h"
+#include <algorithm>
+#include <iterator>
+
+static int GetWaveSlot(const int theWaveIndex) { return theWaveIndex - Zombie::ZOMBIE_WAVE_WINNER; }
+
+static void InsertSlot(std::vector<int> &theSlots, const int theSlot) {
+    theSlots.insert(std::lower_bound(theSlots.begin(), theSlots.end(), theSlot), theSlot);
+}
+
+static void EraseSlot(std::vector<int> &theSlots, const int theSlot) {
+    theSlots.erase(std::lower_bound(theSlots.begin(), theSlots.end(), theSlot));
+}
+
+void BoardStats::Rebuild() {
+    ZombieShare aNoShare{};
+    aNoShare.mRow = -1;
+    mZombieShares.assign(mBoard->mZombies.mMaxSize, aNoShare);
+    mPlantShares.assign(mBoard->mPlants.mMaxSize, SeedType::SEED_NONE);
+    mCoinShares.assign(mBoard->mCoins.mMaxSize, 0);
+    mLawnMowerShares.assign(mBoard->mLawnMowers.mMaxSize, false);
+
+    mEnemyZombies = 0;
+    mZombiesOnScreen = 0;
+    mBossZombies = 0;
+    mWaveHealth.clear();
+    std::fill(std::begin(mPlantCount), std::end(mPlantCount), 0);
+    mSunBeingCollected = 0;
+    mUntriggeredLawnMowers = 0;
+    mRowZombies.assign(MAX_GRID_SIZE_Y, {});
+    mBossZombieSlots.clear();
+    mRowlessZombies = 0;
+    mRowTargets.assign(MAX_GRID_SIZE_Y, {});
+
+    Zombie *aZombie = nullptr;
+    while (mBoard->mZombies.IterateNext(aZombie)) {
+        UpdateZombie(aZombie);
+    }
+    Plant *aPlant = nullptr;
+    while (mBoard->mPlants.IterateNext(aPlant)) {
+        UpdatePlant(aPlant);
+    }
+    Coin *aCoin = nullptr;
+    while (mBoard->mCoins.IterateNext(aCoin)) {
+        UpdateCoin(aCoin);
+    }
+    LawnMower *aLawnMower = nullptr;
+    while (mBoard->mLawnMowers.IterateNext(aLawnMower)) {
+        UpdateLawnMower(aLawnMower);
+    }
+}
+
+void BoardStats::UpdateZombie(Zombie *theZombie) {
+    const int aSlot = mBoard->mZombies.DataArrayGetSlot(theZombie);
+    if (aSlot < 0 || aSlot >= static_cast<int>(mZombieShares.size())) return;
+
+    ZombieShare aShare{};
+    aShare.mRow = -1;
+    if (!theZombie->mDead) {
+        if (theZombie->mRow >= 0 && theZombie->mRow < MAX_GRID_SIZE_Y) {
+            aShare.mRow = theZombie->mRow;
+        }
+        const bool aIsAlive = !theZombie->IsDeadOrDying() && !theZombie->mMindControlled;
+        aShare.mEnemy = aIsAlive && theZombie->mHasHead;
+        aShare.mOnScreen = aShare.mEnemy && theZombie->IsOnBoard();
+        aShare.mBoss = theZombie->mZombieType == ZombieType::ZOMBIE_BOSS;
+        aShare.mRowless = aShare.mRow < 0 && !aShare.mBoss;
+        aShare.mCountsForWave = aIsAlive && theZombie->mZombieType != ZombieType::ZOMBIE_BUNGEE &&
+                                theZombie->mRelatedZombieID == ZombieID::ZOMBIEID_NULL &&
+                                GetWaveSlot(theZombie->mFromWave) >= 0;
+        if (aShare.mCountsForWave) {
+            aShare.mWaveSlot = GetWaveSlot(theZombie->mFromWave);
+            // Same float expression as the original scan, so the truncated sum stays identical.
+            aShare.mWaveHealth = static_cast<int>(
+                theZombie->mBodyHealth + theZombie->mHelmHealth + theZombie->mShieldHealth * 0.2f +
+                theZombie->mFlyingHealth
+            );
+        }
+    }
+
+    ZombieShare &aOldShare = mZombieShares[aSlot];
+    mEnemyZombies += aShare.mEnemy - aOldShare.mEnemy;
+    mZombiesOnScreen += aShare.mOnScreen - aOldShare.mOnScreen;
+    mBossZombies += aShare.mBoss - aOldShare.mBoss;
+    mRowlessZombies += aShare.mRowless - aOldShare.mRowless;
+    if (aOldShare.mCountsForWave) {
+        mWaveHealth[aOldShare.mWaveSlot] -= aOldShare.mWaveHealth;
+    }
+    if (aShare.mCountsForWave) {
+        if (aShare.mWaveSlot >= static_cast<int>(mWaveHealth.size())) {
+            mWaveHealth.resize(aShare.mWaveSlot + 1, 0);
+        }
+        mWaveHealth[aShare.mWaveSlot] += aShare.mWaveHealth;
+    }
+    if (aOldShare.mRow != aShare.mRow) {
+        if (aOldShare.mRow >= 0) EraseSlot(mRowZombies[aOldShare.mRow], aSlot);
+        if (aShare.mRow >= 0) InsertSlot(mRowZombies[aShare.mRow], aSlot);
+    }
+    if (aOldShare.mBoss != aShare.mBoss) {
+        if (aOldShare.mBoss) EraseSlot(mBossZombieSlots, aSlot);
+        if (aShare.mBoss) InsertSlot(mBossZombieSlots, aSlot);
+    }
+    if (mTargeting) {
+        if (aOldShare.mBoss || aShare.mBoss) {
+            InvalidateRowTargets(-1);
+        } else {
+            if (aOldShare.mRow >= 0) InvalidateRowTargets(aOldShare.mRow);
+            if (aShare.mRow >= 0 && aShare.mRow != aOldShare.mRow) InvalidateRowTargets(aShare.mRow);
+        }
+    }
+    aOldShare = aShare;
+}
+
+void BoardStats::UpdatePlant(Plant *thePlant) {
+    const int aSlot = mBoard->mPlants.DataArrayGetSlot(thePlant);
+    if (aSlot < 0 || aSlot >= static_cast<int>(mPlantShares.size())) return;
+
+    SeedType aShare = SeedType::SEED_NONE;
+    if (!thePlant->mDead && thePlant->mSeedType >= 0 && thePlant->mSeedType < SeedType::NUM_SEED_TYPES) {
+        aShare = thePlant->mSeedType;
+    }
+
+    SeedType &aOldShare = mPlantShares[aSlot];
+    if (aOldShare != SeedType::SEED_NONE) {
+        mPlantCount[aOldShare]--;
+    }
+    if (aShare != SeedType::SEED_NONE) {
+        mPlantCount[aShare]++;
+    }
+    aOldShare = aShare;
+}
+
+void BoardStats::UpdateCoin(Coin *theCoin) {
+    const int aSlot = mBoard->mCoins.DataArrayGetSlot(theCoin);
+    if (aSlot < 0 || aSlot >= static_cast<int>(mCoinShares.size())) return;
+
+    const int aShare = !theCoin->mDead && theCoin->mIsBeingCollected && theCoin->IsSun() ? theCoin->GetSunValue() : 0;
+    mSunBeingCollected += aShare - mCoinShares[aSlot];
+    mCoinShares[aSlot] = aShare;
+}
+
+void BoardStats::UpdateLawnMower(LawnMower *theLawnMower) {
+    const int aSlot = mBoard->mLawnMowers.DataArrayGetSlot(theLawnMower);
+    if (aSlot < 0 || aSlot >= static_cast<int>(mLawnMowerShares.size())) return;
+
+    const bool aShare = !theLawnMower->mDead && theLawnMower->mMowerState != LawnMowerState::MOWER_TRIGGERED &&
+                        theLawnMower->mMowerState != LawnMowerState::MOWER_SQUISHED;
+    mUntriggeredLawnMowers += aShare - mLawnMowerShares[aSlot];
+    mLawnMowerShares[aSlot] = aShare;
+}
+
+void BoardStats::ZombieChanged(Zombie *theZombie) {
+    if (theZombie->mBoard) theZombie->mBoard->mStats.UpdateZombie(theZombie);
+}
+
+void BoardStats::PlantChanged(Plant *thePlant) {
+    if (thePlant->mBoard) thePlant->mBoard->mStats.UpdatePlant(thePlant);
+}
+
+void BoardStats::CoinChanged(Coin *theCoin) {
+    if (theCoin->mBoard) theCoin->mBoard->mStats.UpdateCoin(theCoin);
+}
+
+void BoardStats::LawnMowerChanged(LawnMower *theLawnMower) {
+    if (theLawnMower->mBoard) theLawnMower->mBoard->mStats.UpdateLawnMower(theLawnMower);
+}
+
+bool BoardStats::AreEnemyZombiesOnScreen() {
+#ifdef _DEBUG
+    int aCount = 0;
+    Zombie *aZombie = nullptr;
+    while (mBoard->IterateZombies(aZombie)) {
+        if (aZombie->mHasHead && !aZombie->IsDeadOrDying() && !aZombie->mMindControlled) {
+            aCount++;
+        }
+    }
+    TOD_ASSERT(aCount == mEnemyZombies, "Enemy zombie count out of sync: %d, scan found %d", mEnemyZombies, aCount);
+#endif
+    return mEnemyZombies > 0;
+}
+
+int BoardStats::CountZombiesOnScreen() {
+#ifdef _DEBUG
+    int aCount = 0;
+    Zombie *aZombie = nullptr;
+    while (mBoard->IterateZombies(aZombie)) {
+        if (aZombie->mHasHead && !aZombie->IsDeadOrDying() && !aZombie->mMindControlled && aZombie->IsOnBoard()) {
+            aCount++;
+        }
+    }
+    TOD_ASSERT(
+        aCount == mZombiesOnScreen, "On screen zombie count out of sync: %d, scan found %d", mZombiesOnScreen, aCount
+    );
+#endif
+    return mZombiesOnScreen;
+}
+
+int BoardStats::TotalZombiesHealthInWave(const int theWaveIndex) {
+    const int aWaveSlot = GetWaveSlot(theWaveIndex);
+    const int aTotalHealth =
+        aWaveSlot >= 0 && aWaveSlot < static_cast<int>(mWaveHealth.size()) ? mWaveHealth[aWaveSlot] : 0;
+
+#ifdef _DEBUG
+    const int aScanHealth = ScanZombiesHealthInWave(theWaveIndex);
+    TOD_ASSERT(
+        aScanHealth == aTotalHealth, "Health of wave %d out of sync: %d, scan found %d", theWaveIndex, aTotalHealth,
+        aScanHealth
+    );
+#endif
+    return aTotalHealth;
+}
+
+int BoardStats::ScanZombiesHealthInWave(const int theWaveIndex) {
+    int aTotalHealth = 0;
+    Zombie *aZombie = nullptr;
+    while (mBoard->IterateZombies(aZombie)) {
+        if (aZombie->mFromWave == theWaveIndex && !aZombie->mMindControlled && !aZombie->IsDeadOrDying() &&
+            aZombie->mZombieType != ZombieType::ZOMBIE_BUNGEE && aZombie->mRelatedZombieID == ZombieID::ZOMBIEID_NULL) {
+            aTotalHealth +=
+                aZombie->mBodyHealth + aZombie->mHelmHealth + aZombie->mShieldHealth * 0.2f + aZombie->mFlyingHealth;
+        }
+    }
+    return aTotalHealth;
+}
+
+bool BoardStats::HasBossZombie() {
+#ifdef _DEBUG
+    int aCount = 0;
+    Zombie *aZombie = nullptr;
+    while (mBoard->IterateZombies(aZombie)) {
+        if (aZombie->mZombieType == ZombieType::ZOMBIE_BOSS) {
+            aCount++;
+        }
+    }
+    TOD_ASSERT(aCount == mBossZombies, "Boss count out of sync: %d, scan found %d", mBossZombies, aCount);
+#endif
+    return mBossZombies > 0;
+}
+
+int BoardStats::CountPlantByType(const SeedType theSeedType) {
+    if (theSeedType < 0 || theSeedType >= SeedType::NUM_SEED_TYPES) return 0;
+
+#ifdef _DEBUG
+    int aCount = 0;
+    Plant *aPlant = nullptr;
+    while (mBoard->IteratePlants(aPlant)) {
+        if (aPlant->mSeedType == theSeedType) {
+            aCount++;
+        }
+    }
+    TOD_ASSERT(
+        aCount == mPlantCount[theSeedType], "Plant count of type %d out of sync: %d, scan found %d", theSeedType,
+        mPlantCount[theSeedType], aCount
+    );
+#endif
+    return mPlantCount[theSeedType];
+}
+
+int BoardStats::CountSunBeingCollected() {
+#ifdef _DEBUG
+    int aCount = 0;
+    Coin *aCoin = nullptr;
+    while (mBoard->IterateCoins(aCoin)) {
+        if (aCoin->mIsBeingCollected && aCoin->IsSun()) {
+            aCount += aCoin->GetSunValue();
+        }
+    }
+    TOD_ASSERT(
+        aCount == mSunBeingCollected, "Sun being collected out of sync: %d, scan found %d", mSunBeingCollected, aCount
+    );
+#endif
+    return mSunBeingCollected;
+}
+
+int BoardStats::CountUntriggerLawnMowers() {
+#ifdef _DEBUG
+    int aCount = 0;
+    LawnMower *aLawnMower = nullptr;
+    while (mBoard->IterateLawnMowers(aLawnMower)) {
+        if (aLawnMower->mMowerState != LawnMowerState::MOWER_TRIGGERED &&
+            aLawnMower->mMowerState != LawnMowerState::MOWER_SQUISHED) {
+            aCount++;
+        }
+    }
+    TOD_ASSERT(
+        aCount == mUntriggeredLawnMowers, "Untriggered lawn mower count out of sync: %d, scan found %d",
+        mUntriggeredLawnMowers, aCount
+    );
+#endif
+    return mUntriggeredLawnMowers;
+}
+
+Zombie *BoardStats::GetNextZombieInRows(const int theMinRow, const int theMaxRow, Zombie *theZombie) {
+    // Rows off the lawn have no zombies of their own, but still reach the boss.
+    const int aMinRow = std::max(theMinRow, 0);
+    const int aMaxRow = std::min(theMaxRow, static_cast<int>(mRowZombies.size()) - 1);
+
+#ifdef _DEBUG
+    if (theZombie == nullptr) {
+        int aCount = 0;
+        Zombie *aZombie = nullptr;
+        while (mBoard->IterateZombies(aZombie)) {
+            if ((aZombie->mRow >= aMinRow && aZombie->mRow <= aMaxRow) ||
+                aZombie->mZombieType == ZombieType::ZOMBIE_BOSS) {
+                aCount++;
+            }
+        }
+        int aListed = 0;
+        for (int aRow = aMinRow; aRow <= aMaxRow; aRow++) {
+            aListed += static_cast<int>(mRowZombies[aRow].size());
+        }
+        for (const int aSlot : mBossZombieSlots) {
+            if (mZombieShares[aSlot].mRow < aMinRow || mZombieShares[aSlot].mRow > aMaxRow) aListed++;
+        }
+        TOD_ASSERT(
+            aCount == aListed, "Zombies of rows %d-%d out of sync: %d, scan found %d", aMinRow, aMaxRow, aListed, aCount
+        );
+    }
+#endif
+
+    const int aAfter = theZombie ? mBoard->mZombies.DataArrayGetSlot(theZombie) : -1;
+    int aNext = -1;
+    auto aTakeNext = [&](const std::vector<int> &theSlots) {
+        const auto aIter = std::upper_bound(theSlots.begin(), theSlots.end(), aAfter);
+        if (aIter != theSlots.end() && (aNext < 0 || *aIter < aNext)) aNext = *aIter;
+    };
+    for (int aRow = aMinRow; aRow <= aMaxRow; aRow++) {
+        aTakeNext(mRowZombies[aRow]);
+    }
+    aTakeNext(mBossZombieSlots);
+    return aNext >= 0 ? &mBoard->mZombies.mBlock[aNext].mItem : nullptr;
+}
+
+void BoardStats::InvalidateRowTargets(const int theRow) {
+    for (int aRow = 0; aRow < static_cast<int>(mRowTargets.size()); aRow++) {
+        if (theRow >= 0 && aRow != theRow) continue;
+
+        for (RowTargets &aRowTargets : mRowTargets[aRow]) {
+            aRowTargets.mValid = false;
+        }
+    }
+}
+
+void BoardStats::BeginPlantTargeting() {
+    InvalidateRowTargets(-1);
+    mTargeting = true;
+}
+
+void BoardStats::EndPlantTargeting() { mTargeting = false; }
+
+const std::vector<BoardStats::TargetZombie> &
+BoardStats::GetRowTargets(const int theRow, const unsigned int theDamageRangeFlags) {
+    TOD_ASSERT(IsTargetCacheActive() && theRow >= 0 && theRow < static_cast<int>(mRowTargets.size()));
+
+    // The plants of a row ask with only a few different sets of flags, so a short list beats a map.
+    std::vector<RowTargets> &aRowTargetsByFlags = mRowTargets[theRow];
+    auto aIter = std::find_if(
+        aRowTargetsByFlags.begin(), aRowTargetsByFlags.end(),
+        [theDamageRangeFlags](const RowTargets &theRowTargets) {
+            return theRowTargets.mDamageRangeFlags == theDamageRangeFlags;
+        }
+    );
+    if (aIter == aRowTargetsByFlags.end()) {
+        aIter = aRowTargetsByFlags.insert(aRowTargetsByFlags.end(), RowTargets{theDamageRangeFlags, false, {}});
+    }
+
+    if (!aIter->mValid) {
+        std::vector<TargetZombie> &aTargets = aIter->mTargets;
+        aTargets.clear();
+        Zombie *aZombie = nullptr;
+        while ((aZombie = GetNextZombieInRows(theRow, theRow, aZombie)) != nullptr) {
+            if (aZombie->EffectedByDamage(theDamageRangeFlags)) {
+                aTargets.push_back({aZombie, aZombie->GetZombieRect()});
+            }
+        }
+        // Stable, so zombies at the same spot stay in data array order and the first of them wins as in the scan.
+        std::stable_sort(
+            aTargets.begin(), aTargets.end(),
+            [](const TargetZombie &theLeft, const TargetZombie &theRight) {
+                return theLeft.mRect.mX < theRight.mRect.mX;
+            }
+        );
+        aIter->mValid = true;
+    }
+    return aIter->mTargets;
+}
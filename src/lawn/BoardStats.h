@@ -0,0 +1,119 @@
+#ifndef __BOARDSTATS_H__
+#define __BOARDSTATS_H__
+
+#include "ConstEnums.h"
+#include "framework/misc/Rect.h"
+#include <vector>
+
+class Board;
+class Zombie;
+class Plant;
+class Coin;
+class LawnMower;
+
+// Running totals behind the Board counting queries (CountZombiesOnScreen, TotalZombiesHealthInWave, CountPlantByType,
+// ...), which wave spawning, the challenges and the music ask for every tick.
+//
+// Objects report themselves through the static *Changed() functions whenever a field a total depends on is written.
+// Every call recomputes that object's share from scratch and applies the difference, so an extra call is harmless and
+// a missing one shows up in debug builds, where each query is checked against a full scan of the data arrays.
+// The shares are kept here, indexed by data array slot, because the objects themselves are saved byte for byte.
+//
+// The same hooks keep the slots of the live zombies of each row (and of the bosses, which every row can target) in
+// ascending order, for plant targeting that only looks at its own row.
+//
+// During the plant pass of Board::UpdateGameObjects the zombies hold still, so the plants of a row that aim at the
+// nearest zombie can share one sorted list of what they could hit. The lists are built on first use and dropped by the
+// same hooks whenever a zombie of the row (or a boss) changes, e.g. when a plant kills it or strips its helmet.
+class BoardStats {
+public:
+    struct TargetZombie {
+        Zombie *mZombie;
+        Sexy::Rect mRect;
+    };
+
+protected:
+    struct ZombieShare {
+        bool mEnemy;
+        bool mOnScreen;
+        bool mBoss;
+        bool mCountsForWave;
+        int mWaveSlot;
+        int mWaveHealth;
+        int mRow;
+        bool mRowless;
+    };
+
+    struct RowTargets {
+        unsigned int mDamageRangeFlags;
+        bool mValid;
+        std::vector<TargetZombie> mTargets;
+    };
+
+    Board *mBoard;
+    std::vector<ZombieShare> mZombieShares;
+    std::vector<SeedType> mPlantShares;
+    std::vector<int> mCoinShares;
+    std::vector<bool> mLawnMowerShares;
+
+    int mEnemyZombies = 0;
+    int mZombiesOnScreen = 0;
+    int mBossZombies = 0;
+    std::vector<int> mWaveHealth;
+    int mPlantCount[static_cast<int>(SeedType::NUM_SEED_TYPES)] = {};
+    int mSunBeingCollected = 0;
+    int mUntriggeredLawnMowers = 0;
+    std::vector<std::vector<int>> mRowZombies;
+    std::vector<int> mBossZombieSlots;
+    int mRowlessZombies = 0;
+    bool mTargeting = false;
+    bool mTargetCacheEnabled = true;
+    std::vector<std::vector<RowTargets>> mRowTargets;
+
+    void InvalidateRowTargets(int theRow);
+    void UpdateZombie(Zombie *theZombie);
+    void UpdatePlant(Plant *thePlant);
+    void UpdateCoin(Coin *theCoin);
+    void UpdateLawnMower(LawnMower *theLawnMower);
+
+public:
+    explicit BoardStats(Board *theBoard) : mBoard(theBoard) {}
+
+    // Recounts everything from the data arrays, for when they were filled or emptied without going through the
+    // objects (board creation, loading a save, DataArrayFreeAll).
+    void Rebuild();
+
+    static void ZombieChanged(Zombie *theZombie);
+    static void PlantChanged(Plant *thePlant);
+    static void CoinChanged(Coin *theCoin);
+    static void LawnMowerChanged(LawnMower *theLawnMower);
+
+    bool AreEnemyZombiesOnScreen();
+    int CountZombiesOnScreen();
+    int TotalZombiesHealthInWave(int theWaveIndex);
+    // The walk over all zombies that TotalZombiesHealthInWave replaced, for the debug check and -spawnbench.
+    int ScanZombiesHealthInWave(int theWaveIndex);
+    bool HasBossZombie();
+    int CountPlantByType(SeedType theSeedType);
+    int CountSunBeingCollected();
+    int CountUntriggerLawnMowers();
+
+    // Next live zombie after theZombie (nullptr to start) that is in theMinRow..theMaxRow or is a boss, in data array
+    // order. Zombies added or moved into those rows during a walk are still picked up, as with IterateZombies.
+    Zombie *GetNextZombieInRows(int theMinRow, int theMaxRow, Zombie *theZombie);
+
+    // Brackets the plant pass, the only time the target lists are used.
+    void BeginPlantTargeting();
+    void EndPlantTargeting();
+    // Off falls back to the full scans, for -targetbench.
+    void EnableTargetCache(bool theEnable) { mTargetCacheEnabled = theEnable; }
+    bool IsTargetCacheActive() const { return mTargeting && mTargetCacheEnabled; }
+    // Whether every live zombie is in one of the row lists (bosses included), so that walking the target lists of all
+    // rows reaches all of them.
+    bool AreAllZombiesInRows() const { return mRowlessZombies == 0; }
+    // The zombies of theRow and the bosses that EffectedByDamage(theDamageRangeFlags), with their GetZombieRect(),
+    // sorted by the left edge of the rect and then by data array order. Only while IsTargetCacheActive().
+    const std::vector<TargetZombie> &GetRowTargets(int theRow, unsigned int theDamageRangeFlags);
+};
+
+#endif
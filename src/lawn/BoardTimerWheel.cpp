@@ -0,0 +1,121 @@
+#include "BoardTimerWheel.h"
+
+#include "Board.h"
+#include "LawnApp.h"
+#include "Plant.h"
+
+bool BoardTimerWheel::IsEnabled() const { return mBoard->mApp->mTimerWheelMode; }
+
+// Files theTimer on the level its distance from now falls in. Called again on every timer whose slot comes up.
+void BoardTimerWheel::Insert(const Timer &theTimer) {
+    const int aDelay = theTimer.mFireTick - mNow;
+    if (aDelay < LEVEL0_SIZE) {
+        mLevel0[theTimer.mFireTick & (LEVEL0_SIZE - 1)].push_back(theTimer);
+    } else if (aDelay < WHEEL_SPAN) {
+        mLevel1[(theTimer.mFireTick >> LEVEL0_BITS) & (LEVEL1_SIZE - 1)].push_back(theTimer);
+    } else {
+        mOverflow.push_back(theTimer);
+    }
+}
+
+void BoardTimerWheel::Cascade(std::vector<Timer> &theTimers) {
+    std::swap(mFiring, theTimers);
+    for (const Timer &aTimer : mFiring) {
+        Insert(aTimer);
+    }
+    mFiring.clear();
+}
+
+int *BoardTimerWheel::GetFireTick(const Plant *thePlant) {
+    const int aSlot = mBoard->mPlants.DataArrayGetSlot(thePlant);
+    if (aSlot < 0) return nullptr;
+
+    if (mFireTickBySlot.size() != mBoard->mPlants.mMaxSize) {
+        mFireTickBySlot.resize(mBoard->mPlants.mMaxSize, -1);
+    }
+    return &mFireTickBySlot[aSlot];
+}
+
+void BoardTimerWheel::ScheduleBlink(Plant *thePlant, const int theCountdown) {
+    int *aFireTick = GetFireTick(thePlant);
+    if (aFireTick == nullptr) return;
+
+    if (theCountdown <= 0) {
+        *aFireTick = -1;
+        return;
+    }
+
+    // Advance() counts the tick before it fires, so a countdown of 1 runs out on the next one, as in UpdateBlink.
+    *aFireTick = mNow + theCountdown;
+    Insert({*aFireTick, mBoard->mPlants.DataArrayGetID(thePlant)});
+}
+
+int BoardTimerWheel::GetBlinkCountdown(const Plant *thePlant) {
+    const int *aFireTick = GetFireTick(thePlant);
+    if (aFireTick == nullptr || *aFireTick < 0) return 0;
+
+    return *aFireTick - mNow;
+}
+
+void BoardTimerWheel::Advance() {
+    if (!IsEnabled()) return;
+
+    mNow++;
+    if ((mNow & (WHEEL_SPAN - 1)) == 0) {
+        Cascade(mOverflow);
+    }
+    if ((mNow & (LEVEL0_SIZE - 1)) == 0) {
+        Cascade(mLevel1[(mNow >> LEVEL0_BITS) & (LEVEL1_SIZE - 1)]);
+    }
+
+    // DoBlink sets the next timer, at least a tick away, so nothing lands on the slot being fired.
+    std::swap(mFiring, mLevel0[mNow & (LEVEL0_SIZE - 1)]);
+    for (const Timer &aTimer : mFiring) {
+        Plant *aPlant = mBoard->mPlants.DataArrayTryToGet(aTimer.mPlantID);
+        if (aPlant == nullptr) continue;
+
+        int *aFireTick = GetFireTick(aPlant);
+        if (*aFireTick != aTimer.mFireTick) continue;
+
+        *aFireTick = -1;
+        aPlant->mBlinkCountdown = 0;
+        if (aPlant->IsUpdating()) {
+            aPlant->DoBlink();
+        } else {
+            // Outside of play the plant isn't updated and its countdown would have stayed at 1.
+            aPlant->SetBlinkCountdown(1);
+        }
+    }
+    mFiring.clear();
+}
+
+void BoardTimerWheel::SyncCountdowns() {
+    if (!IsEnabled()) return;
+
+    Plant *aPlant = nullptr;
+    while (mBoard->IteratePlants(aPlant)) {
+        if (!aPlant->mIsAsleep) {
+            aPlant->mBlinkCountdown = GetBlinkCountdown(aPlant);
+        }
+    }
+}
+
+void BoardTimerWheel::Rebuild() {
+    mNow = 0;
+    for (std::vector<Timer> &aSlot : mLevel0) {
+        aSlot.clear();
+    }
+    for (std::vector<Timer> &aSlot : mLevel1) {
+        aSlot.clear();
+    }
+    mOverflow.clear();
+    mFireTickBySlot.assign(mBoard->mPlants.mMaxSize, -1);
+    if (!IsEnabled()) return;
+
+    Plant *aPlant = nullptr;
+    while (mBoard->IteratePlants(aPlant)) {
+        if (!aPlant->mIsAsleep) {
+            ScheduleBlink(aPlant, aPlant->mBlinkCountdown);
+        }
+    }
+}
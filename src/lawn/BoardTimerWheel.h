@@ -0,0 +1,71 @@
+#ifndef __BOARDTIMERWHEEL_H__
+#define __BOARDTIMERWHEEL_H__
+
+#include <array>
+#include <vector>
+
+class Board;
+class Plant;
+
+// -timerwheel: the plants' blink countdowns as scheduled events. Plant::UpdateBlink stops counting mBlinkCountdown
+// down every tick, each countdown is filed here under the tick it runs out on instead, and Advance() only touches the
+// plants whose blink is due.
+//
+// The wheel is hierarchical. The first level has one slot per tick for the next 256 ticks, the second one slot per 256
+// ticks for the 64 after that, and anything later waits in an overflow list. Timers move down a level as their slot
+// comes up. A timer that was set again or whose plant died is left where it is and skipped when it comes up.
+//
+// The plants are saved byte for byte, so the fire ticks are kept here by data array slot. mBlinkCountdown holds the
+// value the timer was set with. SyncCountdowns() writes what's left of each into it before a save, and Rebuild()
+// schedules them again from it after a load. While a plant sleeps its countdown is held in mBlinkCountdown and it has
+// no timer, as UpdateBlink doesn't count down for a sleeping plant either.
+//
+// The blinks fire after the plant pass rather than on each plant's own turn, so the Rand() draws of DoBlink come in a
+// different order. Seeded play is repeatable within the mode, but not from one mode to the other.
+class BoardTimerWheel {
+protected:
+    static constexpr int LEVEL0_BITS = 8;
+    static constexpr int LEVEL1_BITS = 6;
+    static constexpr int LEVEL0_SIZE = 1 << LEVEL0_BITS;
+    static constexpr int LEVEL1_SIZE = 1 << LEVEL1_BITS;
+    // Ticks the two levels span together. The overflow list is looked at once per span.
+    static constexpr int WHEEL_SPAN = LEVEL0_SIZE * LEVEL1_SIZE;
+
+    struct Timer {
+        int mFireTick;
+        unsigned int mPlantID;
+    };
+
+    Board *mBoard;
+    int mNow = 0;
+    std::array<std::vector<Timer>, LEVEL0_SIZE> mLevel0;
+    std::array<std::vector<Timer>, LEVEL1_SIZE> mLevel1;
+    std::vector<Timer> mOverflow;
+    std::vector<Timer> mFiring;
+    // The tick each plant's blink is due on, by data array slot, or -1 when it has no timer.
+    std::vector<int> mFireTickBySlot;
+
+    void Insert(const Timer &theTimer);
+    void Cascade(std::vector<Timer> &theTimers);
+    int *GetFireTick(const Plant *thePlant);
+
+public:
+    explicit BoardTimerWheel(Board *theBoard) : mBoard(theBoard) {}
+
+    bool IsEnabled() const;
+
+    // Makes thePlant blink after theCountdown ticks, replacing the timer it had. Zero or less only cancels it.
+    void ScheduleBlink(Plant *thePlant, int theCountdown);
+    // Ticks left until thePlant blinks, or 0 when it has no timer.
+    int GetBlinkCountdown(const Plant *thePlant);
+
+    // Counts one tick and makes the plants due on it blink, after the plant pass of Board::UpdateGameObjects.
+    void Advance();
+
+    // Writes the ticks left of every timer into its plant's mBlinkCountdown, before a save.
+    void SyncCountdowns();
+    // Starts over from the plants' mBlinkCountdown, after a load.
+    void Rebuild();
+};
+
+#endif
@@ -2602,6 +2602,7 @@ void Challenge::PortalStart() {
     aPortal->mGridX = 2;
     aPortal->mGridY = 0;
     aPortal->mRenderOrder = mBoard->MakeRenderOrder(RENDER_LAYER_PARTICLE, aPortal->mGridY, 0);
+    BoardGridIndex::GridItemChanged(aPortal);
     aPortal->OpenPortal();
 
     aPortal = mBoard->mGridItems.DataArrayAlloc();
@@ -2609,6 +2610,7 @@ void Challenge::PortalStart() {
     aPortal->mGridX = 9;
     aPortal->mGridY = 1;
     aPortal->mRenderOrder = mBoard->MakeRenderOrder(RENDER_LAYER_PARTICLE, aPortal->mGridY, 0);
+    BoardGridIndex::GridItemChanged(aPortal);
     aPortal->OpenPortal();
 
     aPortal = mBoard->mGridItems.DataArrayAlloc();
@@ -2616,6 +2618,7 @@ void Challenge::PortalStart() {
     aPortal->mGridX = 9;
     aPortal->mGridY = 3;
     aPortal->mRenderOrder = mBoard->MakeRenderOrder(RENDER_LAYER_PARTICLE, aPortal->mGridY, 0);
+    BoardGridIndex::GridItemChanged(aPortal);
     aPortal->OpenPortal();
 
     aPortal = mBoard->mGridItems.DataArrayAlloc();
@@ -2623,6 +2626,7 @@ void Challenge::PortalStart() {
     aPortal->mGridX = 2;
     aPortal->mGridY = 4;
     aPortal->mRenderOrder = mBoard->MakeRenderOrder(RENDER_LAYER_PARTICLE, aPortal->mGridY, 0);
+    BoardGridIndex::GridItemChanged(aPortal);
     aPortal->OpenPortal();
 
     mBoard->mBoardData.mZombieCountDown = 200;
@@ -2759,6 +2763,7 @@ void Challenge::MoveAPortal() {
     aNewPortal->mGridItemType = aPortal->mGridItemType;
     aNewPortal->mGridX = aGrid->mX;
     aNewPortal->mGridY = aGrid->mY;
+    BoardGridIndex::GridItemChanged(aNewPortal);
     aNewPortal->mRenderOrder = Board::MakeRenderOrder(RENDER_LAYER_PARTICLE, aNewPortal->mGridY, 0);
     aNewPortal->OpenPortal();
     aPortal->ClosePortal();
@@ -3021,6 +3026,7 @@ void Challenge::ZombiquariumDropBrain(int x, int y) {
     aBrain->mRenderOrder = 400000;
     aBrain->mGridX = 0;
     aBrain->mGridY = 0;
+    BoardGridIndex::GridItemChanged(aBrain);
     aBrain->mGridItemCounter = 0;
     aBrain->mPosX = x - 15.0f;
     aBrain->mPosY = y - 15.0f;
@@ -3151,6 +3157,7 @@ void Challenge::ScaryPotterPlacePot(
         aScaryPot->mGridItemState = GridItemState::GRIDITEM_STATE_SCARY_POT_QUESTION;
         aScaryPot->mGridX = aGrid->mX;
         aScaryPot->mGridY = aGrid->mY;
+        BoardGridIndex::GridItemChanged(aScaryPot);
         aGrid->mWeight = 0;
         aScaryPot->mRenderOrder = mBoard->MakeRenderOrder(RENDER_LAYER_PLANT, aGrid->mY, 0);
         aScaryPot->mZombieType = theZombieType;
@@ -3899,7 +3906,7 @@ void Challenge::IZombieSetupPlant(Plant *thePlant) {
         thePlant->mState = STATE_POTATO_ARMED;
     }
 
-    thePlant->mBlinkCountdown = 0;
+    thePlant->SetBlinkCountdown(0);
     thePlant->UpdateReanim();
 }
 
@@ -3973,6 +3980,7 @@ void Challenge::IZombieInitLevel() {
         aBrain->mGridItemType = GridItemType::GRIDITEM_IZOMBIE_BRAIN;
         aBrain->mGridX = 0;
         aBrain->mGridY = aRow;
+        BoardGridIndex::GridItemChanged(aBrain);
         aBrain->mRenderOrder = Board::MakeRenderOrder(RENDER_LAYER_PLANT, aRow, 0);
         aBrain->mGridItemCounter = 70;
         aBrain->mPosX = mBoard->GridToPixelX(0, aRow) - 40;
@@ -4845,6 +4853,7 @@ void Challenge::TreeOfWisdomFertilize() {
     aTreeFood->mGridItemType = GridItemType::GRIDITEM_ZEN_TOOL;
     aTreeFood->mGridX = 0;
     aTreeFood->mGridY = 0;
+    BoardGridIndex::GridItemChanged(aTreeFood);
     aTreeFood->mRenderOrder = Board::MakeRenderOrder(RENDER_LAYER_ABOVE_UI, 0, 0);
     Reanimation *aReanim = mApp->AddReanimation(340.0f, 300.0f, 0, REANIM_TREEOFWISDOM_TREEFOOD);
     aReanim->mLoopType = ReanimLoopType::REANIM_PLAY_ONCE_AND_HOLD;
@@ -817,6 +817,7 @@ void Coin::Collect() {
     mCollectX = mPosX;
     mCollectY = mPosY;
     mIsBeingCollected = true;
+    BoardStats::CoinChanged(this);
 
     bool aIsEndlessAward = false;
     if ((mApp->IsEndlessIZombie(mApp->mGameMode) || mApp->IsEndlessScaryPotter(mApp->mGameMode)) && IsLevelAward()) {
@@ -1096,6 +1097,7 @@ void Coin::PlayCollectSound() {
 
 void Coin::DroppedUsableSeed() {
     mIsBeingCollected = false;
+    BoardStats::CoinChanged(this);
 
     if (mTimesDropped == 0) {
         mDisappearCounter = std::min(mDisappearCounter, 1200);
@@ -1131,6 +1133,7 @@ void Coin::Die() {
     TOD_ASSERT(!mBoard || mBoard->mCursorObject->mCoinID != static_cast<CoinID>(mBoard->mCoins.DataArrayGetID(this)));
 
     mDead = true;
+    BoardStats::CoinChanged(this);
     AttachmentDie(mAttachmentID);
 }
 
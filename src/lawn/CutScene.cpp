@@ -157,6 +157,7 @@ void CutScene::PlaceAZombie(ZombieType theZombieType, int theGridX, int theGridY
         aZombie->mPosX = 1105.0f;
         aZombie->mPosY = 480.0f;
     }
+    BoardStats::ZombieChanged(aZombie);
 }
 
 // 0x4393D0
@@ -1496,6 +1497,8 @@ void CutScene::ClearUpsellBoard() {
     mBoard->mProjectiles.DataArrayFreeAll();
     mBoard->mGridItems.DataArrayFreeAll();
     mBoard->mLawnMowers.DataArrayFreeAll();
+    mBoard->mStats.Rebuild();
+    mBoard->mGridIndex.Rebuild();
 
     TodParticleSystem *aParticle = nullptr;
     while (mBoard->IterateParticles(aParticle)) {
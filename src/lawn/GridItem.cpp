@@ -43,6 +43,7 @@ GridItem::GridItem() {
 // 0x44D000
 void GridItem::GridItemDie() {
     mDead = true;
+    BoardGridIndex::GridItemChanged(this);
 
     Reanimation *aGridItemReanim = mApp->ReanimationTryToGet(mGridItemReanimID);
     if (aGridItemReanim) {
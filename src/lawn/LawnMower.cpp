@@ -52,6 +52,7 @@ void LawnMower::LawnMowerInitialize(int theRow) {
     if (mBoard->mBoardData.mSuperMowerMode && mMowerType == LawnMowerType::LAWNMOWER_LAWN) {
         EnableSuperMower(true);
     }
+    BoardStats::LawnMowerChanged(this);
 }
 
 // 0x4581E0
@@ -285,6 +286,7 @@ void LawnMower::Draw(Graphics *g) const {
 // 0x458D10
 void LawnMower::Die() {
     mDead = true;
+    BoardStats::LawnMowerChanged(this);
     mApp->RemoveReanimation(mReanimID);
     if (mBoard->mBoardData.mBonusLawnMowersRemaining > 0 && !mBoard->HasLevelAwardDropped()) {
         LawnMower *aLawnMower = mBoard->mLawnMowers.DataArrayAlloc();
@@ -312,6 +314,7 @@ void LawnMower::StartMower() {
     mBoard->mBoardData.mWaveRowGotLawnMowered[mRow] = mBoard->mBoardData.mCurrentWave;
     mBoard->mBoardData.mTriggeredLawnMowers++;
     mMowerState = LawnMowerState::MOWER_TRIGGERED;
+    BoardStats::LawnMowerChanged(this);
 }
 
 // 0x458EB0
@@ -321,6 +324,7 @@ void LawnMower::SquishMower() {
     aMowerReanim->SetPosition(-11.0f, 65.0f);
 
     mMowerState = LawnMowerState::MOWER_SQUISHED;
+    BoardStats::LawnMowerChanged(this);
     mSquishedCounter = 500;
     mApp->PlayFoley(FoleyType::FOLEY_SQUISH);
 }
@@ -172,7 +172,7 @@ void Plant::PlantInitialize(int theGridX, int theGridY, SeedType theSeedType, Se
     mBlinkReanimID = ReanimationID::REANIMATIONID_NULL;
     mLightReanimID = ReanimationID::REANIMATIONID_NULL;
     mSleepingReanimID = ReanimationID::REANIMATIONID_NULL;
-    mBlinkCountdown = 0;
+    SetBlinkCountdown(0);
     mRecentlyEatenCountdown = 0;
     mEatenFlashCountdown = 0;
     mBeghouledFlashCountdown = 0;
@@ -206,7 +206,7 @@ void Plant::PlantInitialize(int theGridX, int theGridY, SeedType theSeedType, Se
 
         aBodyReanim->mIsAttachment = true;
         mBodyReanimID = mApp->ReanimationGetID(aBodyReanim);
-        mBlinkCountdown = 400 + Sexy::Rand(400);
+        SetBlinkCountdown(400 + Sexy::Rand(400));
     }
 
     if (IsNocturnal(mSeedType) && mBoard && !mBoard->StageIsNight()) SetSleeping(true);
@@ -299,21 +299,21 @@ void Plant::PlantInitialize(int theGridX, int theGridY, SeedType theSeedType, Se
     }
     case SeedType::SEED_WALLNUT:
         mPlantHealth = 4000;
-        mBlinkCountdown = 1000 + Sexy::Rand(1000);
+        SetBlinkCountdown(1000 + Sexy::Rand(1000));
         break;
     case SeedType::SEED_EXPLODE_O_NUT:
         mPlantHealth = 4000;
-        mBlinkCountdown = 1000 + Sexy::Rand(1000);
+        SetBlinkCountdown(1000 + Sexy::Rand(1000));
         aBodyReanim->mColorOverride = Color(255, 64, 64);
         break;
     case SeedType::SEED_GIANT_WALLNUT:
         mPlantHealth = 4000;
-        mBlinkCountdown = 1000 + Sexy::Rand(1000);
+        SetBlinkCountdown(1000 + Sexy::Rand(1000));
         break;
     case SeedType::SEED_TALLNUT:
         mPlantHealth = 8000;
         mHeight = 80;
-        mBlinkCountdown = 1000 + Sexy::Rand(1000);
+        SetBlinkCountdown(1000 + Sexy::Rand(1000));
         break;
     case SeedType::SEED_GARLIC:
         TOD_ASSERT(aBodyReanim);
@@ -477,6 +477,7 @@ void Plant::PlantInitialize(int theGridX, int theGridY, SeedType theSeedType, Se
         const Plant *aFlowerPot = mBoard->GetFlowerPotAt(mPlantCol, mRow);
         if (aFlowerPot) mApp->ReanimationGet(aFlowerPot->mBodyReanimID)->mAnimRate = 0.0f;
     }
+    BoardStats::PlantChanged(this);
 }
 
 // 0x45E7C0
@@ -504,6 +505,16 @@ int Plant::CalcRenderOrder() const {
 void Plant::SetSleeping(bool theIsAsleep) {
     if (mIsAsleep == theIsAsleep || NotOnGround()) return;
 
+    // The blink countdown holds while the plant sleeps, so it leaves the timer wheel until it wakes.
+    if (IsOnBoard() && mBoard->mTimerWheel.IsEnabled()) {
+        if (theIsAsleep) {
+            mBlinkCountdown = mBoard->mTimerWheel.GetBlinkCountdown(this);
+            mBoard->mTimerWheel.ScheduleBlink(this, 0);
+        } else {
+            mBoard->mTimerWheel.ScheduleBlink(this, mBlinkCountdown);
+        }
+    }
+
     mIsAsleep = theIsAsleep;
     if (theIsAsleep) {
         float aPosX = mX + 50.0f;
@@ -610,8 +621,9 @@ void Plant::DoRowAreaDamage(int theDamage, unsigned int theDamageFlags) {
     const int aDamageRangeFlags = GetDamageRangeFlags(PlantWeapon::WEAPON_PRIMARY);
     const Rect aAttackRect = GetPlantAttackRect(PlantWeapon::WEAPON_PRIMARY);
 
+    const int aRowRange = mSeedType == SeedType::SEED_GLOOMSHROOM ? 1 : 0;
     Zombie *aZombie = nullptr;
-    while (mBoard->IterateZombies(aZombie)) {
+    while (mBoard->IterateZombiesInRows(mRow - aRowRange, mRow + aRowRange, aZombie)) {
         const int aDiffY = (aZombie->mZombieType == ZombieType::ZOMBIE_BOSS) ? 0 : (aZombie->mRow - mRow);
         if (mSeedType == SeedType::SEED_GLOOMSHROOM) {
             if (aDiffY < -1 || aDiffY > 1) continue;
@@ -760,44 +772,71 @@ void Plant::LaunchThreepeater() {
 bool Plant::FindStarFruitTarget() {
     if (mRecentlyEatenCountdown > 0) return true;
 
+    // The stars fly in five directions, so every row counts. The row target lists hold exactly the zombies the scan
+    // would test, with their rects, as long as none of them is off the rows.
+    if (!mBoard->mStats.IsTargetCacheActive() || !mBoard->mStats.AreAllZombiesInRows()) {
+        return ScanStarFruitTarget();
+    }
+
+    const int aDamageRangeFlags = GetDamageRangeFlags(PlantWeapon::WEAPON_PRIMARY);
+    bool aFound = false;
+    for (int aRow = 0; aRow < MAX_GRID_SIZE_Y && !aFound; aRow++) {
+        for (const BoardStats::TargetZombie &aTarget : mBoard->mStats.GetRowTargets(aRow, aDamageRangeFlags)) {
+            if (IsStarFruitTarget(aTarget.mZombie, aTarget.mRect)) {
+                aFound = true;
+                break;
+            }
+        }
+    }
+
+#ifdef _DEBUG
+    TOD_ASSERT(aFound == ScanStarFruitTarget(), "Target lists out of sync for the starfruit in row %d", mRow);
+#endif
+    return aFound;
+}
+
+bool Plant::ScanStarFruitTarget() {
     const int aDamageRangeFlags = GetDamageRangeFlags(PlantWeapon::WEAPON_PRIMARY);
-    const int aCenterStarX = mX + 40;
-    const int aCenterStarY = mY + 40;
 
     Zombie *aZombie = nullptr;
     while (mBoard->IterateZombies(aZombie)) {
-        Rect aZombieRect = aZombie->GetZombieRect();
-        if (aZombie->EffectedByDamage(aDamageRangeFlags)) {
-            if (aZombie->mZombieType == ZombieType::ZOMBIE_BOSS && mPlantCol >= 5) return true;
-
-            if (aZombie->mRow == mRow) {
-                if (aZombieRect.mX + aZombieRect.mWidth < aCenterStarX) return true;
-            } else {
-                if (aZombie->mZombieType == ZombieType::ZOMBIE_DIGGER) aZombieRect.mX += 10;
-
-                const float aProjectileTime = Distance2D(
-                                                  aCenterStarX, aCenterStarY, aZombieRect.mX + aZombieRect.mWidth / 2,
-                                                  aZombieRect.mY + aZombieRect.mHeight / 2
-                                              ) /
-                                              3.33f;
-                const int aZombieHitX = aZombie->ZombieTargetLeadX(aProjectileTime) - aZombieRect.mWidth / 2;
-                if ((aZombieHitX + aZombieRect.mWidth > aCenterStarX) && (aZombieHitX < aCenterStarX)) return true;
-
-                const int aCenterZombieX = aZombieHitX + aZombieRect.mWidth / 2;
-                const int aCenterZombieY = aZombieRect.mY + aZombieRect.mHeight / 2;
-                const float angle = RAD_TO_DEG(atan2(aCenterZombieY - aCenterStarY, aCenterZombieX - aCenterStarX));
-                if (abs(aZombie->mRow - mRow) < 2) {
-                    if ((angle > 20.0f && angle < 40.0f) || (angle < -25.0f && angle > -45.0f)) return true;
-                } else {
-                    if ((angle > 25.0f && angle < 35.0f) || (angle < -28.0f && angle > -38.0f)) return true;
-                }
-            }
+        if (aZombie->EffectedByDamage(aDamageRangeFlags) && IsStarFruitTarget(aZombie, aZombie->GetZombieRect())) {
+            return true;
         }
     }
 
     return false;
 }
 
+bool Plant::IsStarFruitTarget(Zombie *theZombie, Rect theZombieRect) {
+    const int aCenterStarX = mX + 40;
+    const int aCenterStarY = mY + 40;
+
+    if (theZombie->mZombieType == ZombieType::ZOMBIE_BOSS && mPlantCol >= 5) return true;
+
+    if (theZombie->mRow == mRow) {
+        return theZombieRect.mX + theZombieRect.mWidth < aCenterStarX;
+    }
+
+    if (theZombie->mZombieType == ZombieType::ZOMBIE_DIGGER) theZombieRect.mX += 10;
+
+    const float aProjectileTime = Distance2D(
+                                      aCenterStarX, aCenterStarY, theZombieRect.mX + theZombieRect.mWidth / 2,
+                                      theZombieRect.mY + theZombieRect.mHeight / 2
+                                  ) /
+                                  3.33f;
+    const int aZombieHitX = theZombie->ZombieTargetLeadX(aProjectileTime) - theZombieRect.mWidth / 2;
+    if ((aZombieHitX + theZombieRect.mWidth > aCenterStarX) && (aZombieHitX < aCenterStarX)) return true;
+
+    const int aCenterZombieX = aZombieHitX + theZombieRect.mWidth / 2;
+    const int aCenterZombieY = theZombieRect.mY + theZombieRect.mHeight / 2;
+    const float angle = RAD_TO_DEG(atan2(aCenterZombieY - aCenterStarY, aCenterZombieX - aCenterStarX));
+    if (abs(theZombie->mRow - mRow) < 2) {
+        return (angle > 20.0f && angle < 40.0f) || (angle < -25.0f && angle > -45.0f);
+    }
+    return (angle > 25.0f && angle < 35.0f) || (angle < -28.0f && angle > -38.0f);
+}
+
 // 0x45F6E0
 void Plant::LaunchStarFruit() {
     if (FindStarFruitTarget()) {
@@ -1028,7 +1067,7 @@ void Plant::UpdatePotato() {
             aLightReanim->AttachToAnotherReanimation(aBodyReanim, "anim_light");
 
             mState = PlantState::STATE_POTATO_ARMED;
-            mBlinkCountdown = 400 + Sexy::Rand(4000);
+            SetBlinkCountdown(400 + Sexy::Rand(4000));
         }
     } else if (mState == PlantState::STATE_POTATO_ARMED) {
         if (FindTargetZombie(mRow, PlantWeapon::WEAPON_PRIMARY)) {
@@ -1213,7 +1252,7 @@ void Plant::DoSquashDamage() {
     const Rect aAttackRect = GetPlantAttackRect(PlantWeapon::WEAPON_PRIMARY);
 
     Zombie *aZombie = nullptr;
-    while (mBoard->IterateZombies(aZombie)) {
+    while (mBoard->IterateZombiesInRow(mRow, aZombie)) {
         if ((aZombie->mRow == mRow || aZombie->mZombieType == ZombieType::ZOMBIE_BOSS) &&
             aZombie->EffectedByDamage(aDamageRangeFlags)) {
             Rect aZombieRect = aZombie->GetZombieRect();
@@ -1234,7 +1273,7 @@ Zombie *Plant::FindSquashTarget() {
     Zombie *aClosestZombie = nullptr;
 
     Zombie *aZombie = nullptr;
-    while (mBoard->IterateZombies(aZombie)) {
+    while (mBoard->IterateZombiesInRow(mRow, aZombie)) {
         if ((aZombie->mRow == mRow || aZombie->mZombieType == ZombieType::ZOMBIE_BOSS) && aZombie->mHasHead &&
             !aZombie->IsTangleKelpTarget() && aZombie->EffectedByDamage(aDamageRangeFlags)) {
             Rect aZombieRect = aZombie->GetZombieRect();
@@ -1592,6 +1631,7 @@ void Plant::MagnetShroomAttactItem(Zombie *theZombie) {
 
         theZombie->mHelmHealth = 0;
         theZombie->mHelmType = HelmType::HELMTYPE_NONE;
+        BoardStats::ZombieChanged(theZombie);
         theZombie->GetTrackPosition("anim_bucket", aMagnetItem->mPosX, aMagnetItem->mPosY);
         theZombie->ReanimShowPrefix("anim_bucket", RENDER_GROUP_HIDDEN);
         theZombie->ReanimShowPrefix("anim_hair", RENDER_GROUP_NORMAL);
@@ -1607,6 +1647,7 @@ void Plant::MagnetShroomAttactItem(Zombie *theZombie) {
 
         theZombie->mHelmHealth = 0;
         theZombie->mHelmType = HelmType::HELMTYPE_NONE;
+        BoardStats::ZombieChanged(theZombie);
         theZombie->GetTrackPosition("zombie_football_helmet", aMagnetItem->mPosX, aMagnetItem->mPosY);
         theZombie->ReanimShowPrefix("zombie_football_helmet", RENDER_GROUP_HIDDEN);
         theZombie->ReanimShowPrefix("anim_hair", RENDER_GROUP_NORMAL);
@@ -1622,6 +1663,7 @@ void Plant::MagnetShroomAttactItem(Zombie *theZombie) {
 
         theZombie->DetachShield();
         theZombie->mZombiePhase = ZombiePhase::PHASE_ZOMBIE_NORMAL;
+        BoardStats::ZombieChanged(theZombie);
         if (!theZombie->mIsEating) {
             TOD_ASSERT(theZombie->mZombieHeight == ZombieHeight::HEIGHT_ZOMBIE_NORMAL);
             theZombie->StartWalkAnim(0);
@@ -1663,6 +1705,7 @@ void Plant::MagnetShroomAttactItem(Zombie *theZombie) {
         theZombie->StopZombieSound();
         theZombie->PickRandomSpeed();
         theZombie->mZombiePhase = ZombiePhase::PHASE_ZOMBIE_NORMAL;
+        BoardStats::ZombieChanged(theZombie);
         theZombie->ReanimShowPrefix("Zombie_jackbox_box", RENDER_GROUP_HIDDEN);
         theZombie->ReanimShowPrefix("Zombie_jackbox_handle", RENDER_GROUP_HIDDEN);
         theZombie->GetTrackPosition("Zombie_jackbox_box", aMagnetItem->mPosX, aMagnetItem->mPosY);
@@ -2419,14 +2462,7 @@ void Plant::UpdateReanim() {
 
 // 0x463E40
 void Plant::Update() {
-    bool doUpdate = false;
-    if (IsOnBoard() && mApp->mGameScene == GameScenes::SCENE_LEVEL_INTRO && mApp->IsWallnutBowlingLevel())
-        doUpdate = true;
-    else if (IsOnBoard() && mApp->mGameMode == GameMode::GAMEMODE_CHALLENGE_ZEN_GARDEN) doUpdate = true;
-    else if (IsOnBoard() && mBoard->mCutScene->ShouldRunUpsellBoard()) doUpdate = true;
-    else if (!IsOnBoard() || mApp->mGameScene == GameScenes::SCENE_PLAYING) doUpdate = true;
-
-    if (doUpdate) {
+    if (IsUpdating()) {
         UpdateAbilities();
         Animate();
 
@@ -2436,6 +2472,14 @@ void Plant::Update() {
     }
 }
 
+// Whether Update does anything on this tick.
+bool Plant::IsUpdating() {
+    if (IsOnBoard() && mApp->mGameScene == GameScenes::SCENE_LEVEL_INTRO && mApp->IsWallnutBowlingLevel()) return true;
+    if (IsOnBoard() && mApp->mGameMode == GameMode::GAMEMODE_CHALLENGE_ZEN_GARDEN) return true;
+    if (IsOnBoard() && mBoard->mCutScene->ShouldRunUpsellBoard()) return true;
+    return !IsOnBoard() || mApp->mGameScene == GameScenes::SCENE_PLAYING;
+}
+
 // 0x463EF0
 bool Plant::NotOnGround() {
     if (mSeedType == SeedType::SEED_SQUASH) {
@@ -2539,7 +2583,7 @@ Reanimation *Plant::AttachBlinkAnim(Reanimation *theReanimBody) {
 
 // 0x464230
 void Plant::DoBlink() {
-    mBlinkCountdown = 400 + Rand(400);
+    SetBlinkCountdown(400 + Rand(400));
 
     if (NotOnGround() || mShootingCounter != 0) return;
 
@@ -2561,7 +2605,7 @@ void Plant::DoBlink() {
 
     if (mSeedType == SeedType::SEED_WALLNUT || mSeedType == SeedType::SEED_TALLNUT ||
         mSeedType == SeedType::SEED_EXPLODE_O_NUT || mSeedType == SeedType::SEED_GIANT_WALLNUT) {
-        mBlinkCountdown = 1000 + Rand(1000);
+        SetBlinkCountdown(1000 + Rand(1000));
     }
 
     Reanimation *aBlinkReanim = AttachBlinkAnim(aBodyReanim);
@@ -2593,7 +2637,7 @@ void Plant::UpdateBlink() {
         }
     }
 
-    if (mIsAsleep) return;
+    if (mIsAsleep || (IsOnBoard() && mBoard->mTimerWheel.IsEnabled())) return;
 
     if (mBlinkCountdown > 0) {
         mBlinkCountdown--;
@@ -2603,6 +2647,14 @@ void Plant::UpdateBlink() {
     }
 }
 
+// Under -timerwheel the board's wheel counts down for the plants on it, except while they sleep.
+void Plant::SetBlinkCountdown(const int theCountdown) {
+    mBlinkCountdown = theCountdown;
+    if (IsOnBoard() && mBoard->mTimerWheel.IsEnabled()) {
+        mBoard->mTimerWheel.ScheduleBlink(this, mIsAsleep ? 0 : theCountdown);
+    }
+}
+
 // 0x464480
 void Plant::AnimateNuts() {
     Reanimation *aBodyReanim = mApp->ReanimationTryToGet(mBodyReanimID);
@@ -3899,13 +3951,53 @@ void Plant::Fire(Zombie *theTargetZombie, int theRow, PlantWeapon thePlantWeapon
 
 // 0x4675C0
 Zombie *Plant::FindTargetZombie(int theRow, PlantWeapon thePlantWeapon) {
+    // Plants that take the leftmost zombie of theRow their attack rect touches, with no conditions of their own, can
+    // read it off the row's sorted target list while the plant pass keeps one.
+    const bool aNearestInRow =
+        mSeedType != SeedType::SEED_CATTAIL && mSeedType != SeedType::SEED_GLOOMSHROOM &&
+        mSeedType != SeedType::SEED_CHOMPER && mSeedType != SeedType::SEED_POTATOMINE &&
+        mSeedType != SeedType::SEED_TANGLEKELP && mSeedType != SeedType::SEED_EXPLODE_O_NUT &&
+        !(mApp->mGameMode == GameMode::GAMEMODE_CHALLENGE_PORTAL_COMBAT &&
+          (mSeedType == SeedType::SEED_PEASHOOTER || mSeedType == SeedType::SEED_CACTUS ||
+           mSeedType == SeedType::SEED_REPEATER));
+    if (!aNearestInRow || theRow < 0 || theRow >= MAX_GRID_SIZE_Y || !mBoard->mStats.IsTargetCacheActive()) {
+        return ScanTargetZombie(theRow, thePlantWeapon);
+    }
+
+    const Rect aAttackRect = GetPlantAttackRect(thePlantWeapon);
+    Zombie *aBestZombie = nullptr;
+    for (const BoardStats::TargetZombie &aTarget :
+         mBoard->mStats.GetRowTargets(theRow, GetDamageRangeFlags(thePlantWeapon))) {
+        if (GetRectOverlap(aAttackRect, aTarget.mRect) >= 0) {
+            aBestZombie = aTarget.mZombie;
+            break;
+        }
+    }
+
+#ifdef _DEBUG
+    TOD_ASSERT(
+        aBestZombie == ScanTargetZombie(theRow, thePlantWeapon), "Target list of row %d out of sync for plant type %d",
+        theRow, mSeedType
+    );
+#endif
+    return aBestZombie;
+}
+
+Zombie *Plant::ScanTargetZombie(int theRow, PlantWeapon thePlantWeapon) {
     const int aDamageRangeFlags = GetDamageRangeFlags(thePlantWeapon);
     Rect aAttackRect = GetPlantAttackRect(thePlantWeapon);
     int aHighestWeight = 0;
     Zombie *aBestZombie = nullptr;
 
+    // Everything but the cattail, the gloom-shroom and portal shooters skips zombies outside theRow (bosses excepted),
+    // so those only need to look at the row's own zombies.
+    const bool aRowOnly = mSeedType != SeedType::SEED_CATTAIL && mSeedType != SeedType::SEED_GLOOMSHROOM &&
+                          !(mApp->mGameMode == GameMode::GAMEMODE_CHALLENGE_PORTAL_COMBAT &&
+                            (mSeedType == SeedType::SEED_PEASHOOTER || mSeedType == SeedType::SEED_CACTUS ||
+                             mSeedType == SeedType::SEED_REPEATER));
+
     Zombie *aZombie = nullptr;
-    while (mBoard->IterateZombies(aZombie)) {
+    while (aRowOnly ? mBoard->IterateZombiesInRow(theRow, aZombie) : mBoard->IterateZombies(aZombie)) {
         int aRowDeviation = aZombie->mRow - theRow;
         if (aZombie->mZombieType == ZombieType::ZOMBIE_BOSS) {
             aRowDeviation = 0;
@@ -4044,6 +4136,7 @@ void Plant::Die() {
     }
 
     mDead = true;
+    BoardStats::PlantChanged(this);
     RemoveEffects();
 
     if (!Plant::IsFlying(mSeedType) && IsOnBoard()) {
@@ -177,12 +177,15 @@ public:
 
     void PlantInitialize(int theGridX, int theGridY, SeedType theSeedType, SeedType theImitaterType);
     void Update();
+    bool IsUpdating();
     void Animate();
     void Draw(Graphics *g);
     void MouseDown(int x, int y, int theClickCount);
     void DoSpecial();
     void Fire(Zombie *theTargetZombie, int theRow, PlantWeapon thePlantWeapon = PlantWeapon::WEAPON_PRIMARY);
     Zombie *FindTargetZombie(int theRow, PlantWeapon thePlantWeapon = PlantWeapon::WEAPON_PRIMARY);
+    // FindTargetZombie walking the zombies, without the row target lists of BoardStats.
+    Zombie *ScanTargetZombie(int theRow, PlantWeapon thePlantWeapon = PlantWeapon::WEAPON_PRIMARY);
     void Die();
     void UpdateProductionPlant();
     void UpdateShooter();
@@ -224,9 +227,12 @@ public:
     void UpdateTorchwood();
     void LaunchStarFruit();
     bool FindStarFruitTarget();
+    bool ScanStarFruitTarget();
+    bool IsStarFruitTarget(Zombie *theZombie, Rect theZombieRect);
     void UpdateChomper();
     void DoBlink();
     void UpdateBlink();
+    void SetBlinkCountdown(int theCountdown);
     void PlayBodyReanim(const char *theTrackName, ReanimLoopType theLoopType, int theBlendTime, float theAnimRate);
     void UpdateMagnetShroom();
     MagnetItem *GetFreeMagnetItem();
@@ -147,6 +147,8 @@ bool Projectile::PeaAboutToHitTorchwood() {
     if (mProjectileType != ProjectileType::PROJECTILE_PEA && mProjectileType != ProjectileType::PROJECTILE_SNOWPEA)
         return false;
 
+    if (mBoard->CountPlantByType(SeedType::SEED_TORCHWOOD) == 0) return false;
+
     Plant *aPlant = nullptr;
     while (mBoard->IteratePlants(aPlant)) {
         if (aPlant->mSeedType == SeedType::SEED_TORCHWOOD && aPlant->mRow == mRow && !aPlant->NotOnGround() &&
@@ -173,8 +175,9 @@ Zombie *Projectile::FindCollisionTarget() {
     Zombie *aBestZombie = nullptr;
     int aMinX = 0;
 
+    // Only the zombies of this row and the boss can be hit, walked in the same order as the full scan.
     Zombie *aZombie = nullptr;
-    while (mBoard->IterateZombies(aZombie)) {
+    while (mBoard->IterateZombiesInRow(mRow, aZombie)) {
         if ((aZombie->mZombieType == ZombieType::ZOMBIE_BOSS || aZombie->mRow == mRow) &&
             aZombie->EffectedByDamage(static_cast<unsigned int>(mDamageRangeFlags))) {
             if (aZombie->mZombiePhase == ZombiePhase::PHASE_SNORKEL_WALKING_IN_POOL && mPosZ >= 45.0f) {
@@ -366,9 +369,11 @@ bool Projectile::IsZombieHitBySplash(Zombie *theZombie) {
 void Projectile::DoSplashDamage(const Zombie *theZombie) {
     const ProjectileDefinition &aProjectileDef = GetProjectileDef();
 
+    // Fireballs only splash their own row, everything else the rows next to it as well (see IsZombieHitBySplash).
+    const int aRowRange = mProjectileType == ProjectileType::PROJECTILE_FIREBALL ? 0 : 1;
     int aZombiesGetSplashed = 0;
     Zombie *aZombie = nullptr;
-    while (mBoard->IterateZombies(aZombie)) {
+    while (mBoard->IterateZombiesInRows(mRow - aRowRange, mRow + aRowRange, aZombie)) {
         if (aZombie != theZombie && IsZombieHitBySplash(aZombie)) {
             aZombiesGetSplashed++;
         }
@@ -388,7 +393,7 @@ void Projectile::DoSplashDamage(const Zombie *theZombie) {
     }
 
     aZombie = nullptr;
-    while (mBoard->IterateZombies(aZombie)) {
+    while (mBoard->IterateZombiesInRows(mRow - aRowRange, mRow + aRowRange, aZombie)) {
         if (IsZombieHitBySplash(aZombie)) {
             const unsigned int aDamageFlags = GetDamageFlags(aZombie);
             if (aZombie == theZombie) {
@@ -413,13 +418,15 @@ void Projectile::UpdateLobMotion() {
         mRotation = -PI / 2;
     }
 
-    mVelZ += mAccZ;
-    if (mApp->mGameMode == GameMode::GAMEMODE_CHALLENGE_HIGH_GRAVITY) {
+    if (!mBoard->mProjectileMotion.ApplyMoveAhead(this)) {
         mVelZ += mAccZ;
+        if (mApp->mGameMode == GameMode::GAMEMODE_CHALLENGE_HIGH_GRAVITY) {
+            mVelZ += mAccZ;
+        }
+        mPosX += mVelX;
+        mPosY += mVelY;
+        mPosZ += mVelZ;
     }
-    mPosX += mVelX;
-    mPosY += mVelY;
-    mPosZ += mVelZ;
 
     const bool isRising = mVelZ < 0.0f;
     if (isRising && (mProjectileType == ProjectileType::PROJECTILE_BASKETBALL ||
@@ -507,7 +514,10 @@ void Projectile::UpdateLobMotion() {
 
 // 0x46D890
 void Projectile::UpdateNormalMotion() {
-    if (mMotionType == ProjectileMotion::MOTION_BACKWARDS) {
+    const bool aMovedAhead = mBoard->mProjectileMotion.ApplyMoveAhead(this);
+    if (aMovedAhead) {
+        // Straight ahead along with the others, the high gravity pull included.
+    } else if (mMotionType == ProjectileMotion::MOTION_BACKWARDS) {
         mPosX -= 3.33f;
     } else if (mMotionType == ProjectileMotion::MOTION_HOMING) {
         Zombie *aZombie = mBoard->ZombieTryToGet(mTargetZombieID);
@@ -568,7 +578,7 @@ void Projectile::UpdateNormalMotion() {
         mPosX += 3.33f;
     }
 
-    if (mApp->mGameMode == GameMode::GAMEMODE_CHALLENGE_HIGH_GRAVITY) {
+    if (!aMovedAhead && mApp->mGameMode == GameMode::GAMEMODE_CHALLENGE_HIGH_GRAVITY) {
         if (mMotionType == ProjectileMotion::MOTION_FLOAT_OVER) {
             mVelZ += 0.004f;
         } else {
@@ -589,15 +599,17 @@ void Projectile::UpdateMotion() {
         mFrame = mAnimCounter / mAnimTicksPerFrame;
     }
 
+    // Only the roof slopes, everywhere else the row's height doesn't depend on x and the change is always 0.
+    const bool aHasSlope = mBoard->StageHasRoof();
     const int aOldRow = mRow;
-    const float aOldY = mBoard->GetPosYBasedOnRow(mPosX, mRow);
+    const float aOldY = aHasSlope ? mBoard->GetPosYBasedOnRow(mPosX, mRow) : 0.0f;
     if (mMotionType == ProjectileMotion::MOTION_LOBBED) {
         UpdateLobMotion();
     } else {
         UpdateNormalMotion();
     }
 
-    float aSlopeHeightChange = mBoard->GetPosYBasedOnRow(mPosX, aOldRow) - aOldY;
+    float aSlopeHeightChange = aHasSlope ? mBoard->GetPosYBasedOnRow(mPosX, aOldRow) - aOldY : 0.0f;
 #ifdef DO_FIX_BUGS
     if (mProjectileType == ProjectileType::PROJECTILE_COBBIG) {
         aSlopeHeightChange = 0.0f; // ޸Ͻ֮硱
@@ -784,6 +784,7 @@ void ZenGarden::MouseDownWithFeedingTool(int x, int y, CursorType theCursorType)
         aZenTool->mGridItemType = GridItemType::GRIDITEM_ZEN_TOOL;
         aZenTool->mGridX = aPlantToFeed->mPlantCol;
         aZenTool->mGridY = aPlantToFeed->mRow;
+        BoardGridIndex::GridItemChanged(aZenTool);
         aZenTool->mPosX = aPlantToFeed->mX + 40;
         aZenTool->mPosY = aPlantToFeed->mY + 40;
         aZenTool->mRenderOrder = Board::MakeRenderOrder(RenderLayer::RENDER_LAYER_ABOVE_UI, 0, 0);
@@ -1088,6 +1089,7 @@ void ZenGarden::AddStinky() {
 
     GridItem *aStinky = mBoard->mGridItems.DataArrayAlloc();
     aStinky->mGridItemType = GridItemType::GRIDITEM_STINKY;
+    BoardGridIndex::GridItemChanged(aStinky);
     aStinky->mPosX = mApp->mPlayerInfo->mStinkyPosX;
     aStinky->mPosY = mApp->mPlayerInfo->mStinkyPosY;
     aStinky->mGoalX = aStinky->mPosX;
@@ -1534,6 +1536,8 @@ void ZenGarden::GotoNextGarden() {
     mBoard->ClearAdvice(AdviceType::ADVICE_NONE);
     mBoard->mPlants.DataArrayFreeAll();
     mBoard->mCoins.DataArrayFreeAll();
+    mBoard->mStats.Rebuild();
+    mBoard->mGridIndex.Rebuild();
     mApp->mEffectSystem->EffectSystemFreeAll();
 
     bool aGoToTree = false;
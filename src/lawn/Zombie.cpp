@@ -1,3 +1,4 @@
+#include <array>
 #include <limits.h>
 
 #include "Board.h"
@@ -777,6 +778,7 @@ void Zombie::ZombieInitialize(
     }
 
     UpdateReanim();
+    BoardStats::ZombieChanged(this);
 }
 
 // 0x524040
@@ -1205,6 +1207,7 @@ void Zombie::PogoBreak(unsigned int theDamageFlags) {
     mShieldHealth = 0;
     mShieldType = ShieldType::SHIELDTYPE_NONE;
     mHasObject = false;
+    BoardStats::ZombieChanged(this);
 }
 
 // 0x525460
@@ -1862,6 +1865,7 @@ void Zombie::UpdateZombieGargantuar() {
             aZombieImp->mScaleZombie = mScaleZombie;
             aZombieImp->mBodyHealth *= mScaleZombie * mScaleZombie;
             aZombieImp->mBodyMaxHealth *= mScaleZombie * mScaleZombie;
+            BoardStats::ZombieChanged(aZombieImp);
 
             if (mMindControlled) {
                 aZombieImp->mPosX = mPosX + mWidth;
@@ -2093,6 +2097,7 @@ void Zombie::UpdateZombieSquashHead() {
         StopEating();
         PlayZombieReanim("anim_idle", ReanimLoopType::REANIM_LOOP, 20, 12.0f);
         mHasHead = false;
+        BoardStats::ZombieChanged(this);
 
         Reanimation *aHeadReanim = mApp->ReanimationGet(mSpecialHeadReanimID);
         aHeadReanim->PlayReanim("anim_jumpup", ReanimLoopType::REANIM_PLAY_ONCE_AND_HOLD, 20, 24.0f);
@@ -2230,6 +2235,7 @@ void Zombie::UpdateZombieBobsled() {
                 for (int i = 0; i < NUM_BOBSLED_FOLLOWERS; i++) {
                     Zombie *aZombie = mBoard->ZombieGet(mFollowerZombieID[i]);
                     aZombie->mRelatedZombieID = ZombieID::ZOMBIEID_NULL;
+                    BoardStats::ZombieChanged(aZombie);
                     mFollowerZombieID[i] = ZombieID::ZOMBIEID_NULL;
                     aZombie->PickRandomSpeed();
                 }
@@ -2277,6 +2283,7 @@ void Zombie::DiggerLoseAxe() {
     mHasObject = false;
     ReanimShowTrack("Zombie_digger_pickaxe", RENDER_GROUP_HIDDEN);
     ReanimShowTrack("Zombie_digger_dirt", RENDER_GROUP_HIDDEN);
+    BoardStats::ZombieChanged(this);
 }
 
 // 0x528310
@@ -2378,6 +2385,7 @@ ZombieID Zombie::SummonBackupDancer(int theRow, int thePosX) {
 
     aZombie->SetAnimRate(0.0f);
     aZombie->mMindControlled = mMindControlled;
+    BoardStats::ZombieChanged(aZombie);
 
     const int aParticleX = static_cast<int>(aZombie->mPosX) + 60;
     int aParticleY = static_cast<int>(aZombie->mPosY) + 110;
@@ -2603,6 +2611,7 @@ void Zombie::DragUnder() {
     mZombieHeight = ZombieHeight::HEIGHT_DRAGGED_UNDER;
     StopEating();
     ReanimReenableClipping();
+    BoardStats::ZombieChanged(this);
 }
 
 // 0x528F70
@@ -2632,6 +2641,7 @@ bool Zombie::ZombiquariumFindClosestBrain() {
             if (mBodyHealth > mBodyMaxHealth) {
                 mBodyHealth = mBodyMaxHealth;
             }
+            BoardStats::ZombieChanged(this);
 
             PlayZombieReanim("anim_aquarium_bite", ReanimLoopType::REANIM_PLAY_ONCE_AND_HOLD, 10, 24.0f);
             mZombiePhase = ZombiePhase::PHASE_ZOMBIQUARIUM_BITE;
@@ -2891,6 +2901,7 @@ void Zombie::DropHead(unsigned int theDamageFlags) {
     }
 
     mHasHead = false;
+    BoardStats::ZombieChanged(this);
     SetupReanimForLostHead();
     if (TestBit(theDamageFlags, static_cast<int>(DamageFlags::DAMAGE_DOESNT_LEAVE_BODY))) {
         return;
@@ -3619,6 +3630,36 @@ void Zombie::UpdateClimbingLadder() {
     }
 }
 
+// Type specific part of UpdateActions, one entry per type in place of a chain of type tests. An action can only turn
+// its zombie into ZOMBIE_NORMAL (ConvertToNormalZombie), which has none, so calling the one looked up entry is the same
+// as running the whole chain.
+using ZombieActionFunc = void (Zombie::*)();
+static constexpr auto gZombieTypeActions = [] {
+    std::array<ZombieActionFunc, ZombieType::NUM_ZOMBIE_TYPES> aActions{};
+    aActions[ZombieType::ZOMBIE_POLEVAULTER] = &Zombie::UpdateZombiePolevaulter;
+    aActions[ZombieType::ZOMBIE_CATAPULT] = &Zombie::UpdateZombieCatapult;
+    aActions[ZombieType::ZOMBIE_DOLPHIN_RIDER] = &Zombie::UpdateZombieDolphinRider;
+    aActions[ZombieType::ZOMBIE_SNORKEL] = &Zombie::UpdateZombieSnorkel;
+    aActions[ZombieType::ZOMBIE_BALLOON] = &Zombie::UpdateZombieFlyer;
+    aActions[ZombieType::ZOMBIE_NEWSPAPER] = &Zombie::UpdateZombieNewspaper;
+    aActions[ZombieType::ZOMBIE_DIGGER] = &Zombie::UpdateZombieDigger;
+    aActions[ZombieType::ZOMBIE_JACK_IN_THE_BOX] = &Zombie::UpdateZombieJackInTheBox;
+    aActions[ZombieType::ZOMBIE_GARGANTUAR] = &Zombie::UpdateZombieGargantuar;
+    aActions[ZombieType::ZOMBIE_REDEYE_GARGANTUAR] = &Zombie::UpdateZombieGargantuar;
+    aActions[ZombieType::ZOMBIE_BOBSLED] = &Zombie::UpdateZombieBobsled;
+    aActions[ZombieType::ZOMBIE_ZAMBONI] = &Zombie::UpdateZamboni;
+    aActions[ZombieType::ZOMBIE_LADDER] = &Zombie::UpdateLadder;
+    aActions[ZombieType::ZOMBIE_YETI] = &Zombie::UpdateYeti;
+    aActions[ZombieType::ZOMBIE_DANCER] = &Zombie::UpdateZombieDancer;
+    aActions[ZombieType::ZOMBIE_BACKUP_DANCER] = &Zombie::UpdateZombieBackupDancer;
+    aActions[ZombieType::ZOMBIE_IMP] = &Zombie::UpdateZombieImp;
+    aActions[ZombieType::ZOMBIE_PEA_HEAD] = &Zombie::UpdateZombiePeaHead;
+    aActions[ZombieType::ZOMBIE_JALAPENO_HEAD] = &Zombie::UpdateZombieJalapenoHead;
+    aActions[ZombieType::ZOMBIE_GATLING_HEAD] = &Zombie::UpdateZombieGatlingHead;
+    aActions[ZombieType::ZOMBIE_SQUASH_HEAD] = &Zombie::UpdateZombieSquashHead;
+    return aActions;
+}();
+
 // 0x52B110
 //  GOTY @Patoke: 0x53B9F1
 void Zombie::UpdateActions() {
@@ -3643,65 +3684,9 @@ void Zombie::UpdateActions() {
         UpdateZombieChimney();
     }
 
-    if (mZombieType == ZombieType::ZOMBIE_POLEVAULTER) {
-        UpdateZombiePolevaulter();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_CATAPULT) {
-        UpdateZombieCatapult();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_DOLPHIN_RIDER) {
-        UpdateZombieDolphinRider();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_SNORKEL) {
-        UpdateZombieSnorkel();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_BALLOON) {
-        UpdateZombieFlyer();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_NEWSPAPER) {
-        UpdateZombieNewspaper();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_DIGGER) {
-        UpdateZombieDigger();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_JACK_IN_THE_BOX) {
-        UpdateZombieJackInTheBox();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_GARGANTUAR || mZombieType == ZombieType::ZOMBIE_REDEYE_GARGANTUAR) {
-        UpdateZombieGargantuar();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_BOBSLED) {
-        UpdateZombieBobsled();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_ZAMBONI) {
-        UpdateZamboni();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_LADDER) {
-        UpdateLadder();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_YETI) {
-        UpdateYeti();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_DANCER) {
-        UpdateZombieDancer();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_BACKUP_DANCER) {
-        UpdateZombieBackupDancer();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_IMP) {
-        UpdateZombieImp();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_PEA_HEAD) {
-        UpdateZombiePeaHead();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_JALAPENO_HEAD) {
-        UpdateZombieJalapenoHead();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_GATLING_HEAD) {
-        UpdateZombieGatlingHead();
-    }
-    if (mZombieType == ZombieType::ZOMBIE_SQUASH_HEAD) {
-        UpdateZombieSquashHead();
+    const ZombieActionFunc aAction = gZombieTypeActions[mZombieType];
+    if (aAction) {
+        (this->*aAction)();
     }
 }
 
@@ -5312,6 +5297,7 @@ void Zombie::ZamboniDeath(unsigned int theDamageFlags) {
         mFlatTires = true;
         mApp->PlayFoley(FoleyType::FOLEY_TIRE_POP);
         mZombiePhase = ZombiePhase::PHASE_ZOMBIE_DYING;
+        BoardStats::ZombieChanged(this);
         mApp->AddTodParticle(mPosX + 29.0f, mPosY + 114.0f, mRenderOrder + 1, ParticleEffect::PARTICLE_ZAMBONI_TIRE);
         mVelX = 0.0f;
 
@@ -5342,6 +5328,7 @@ void Zombie::CatapultDeath(unsigned int theDamageFlags) {
     if (TestBit(theDamageFlags, static_cast<int>(DamageFlags::DAMAGE_SPIKE))) {
         mApp->PlayFoley(FoleyType::FOLEY_TIRE_POP);
         mZombiePhase = ZombiePhase::PHASE_ZOMBIE_DYING;
+        BoardStats::ZombieChanged(this);
         mApp->AddTodParticle(mPosX + 29.0f, mPosY + 114.0f, mRenderOrder + 1, ParticleEffect::PARTICLE_ZAMBONI_TIRE);
         mVelX = 0.0f;
 
@@ -5483,6 +5470,7 @@ void Zombie::ConvertToNormalZombie() {
     mZombieType = ZombieType::ZOMBIE_NORMAL;
     mZombiePhase = ZombiePhase::PHASE_ZOMBIE_NORMAL;
     mZombieAttackRect = Rect(50, 0, 20, 115);
+    BoardStats::ZombieChanged(this);
 
     mAnimFrames = 12;
     mAnimTicksPerFrame = 12;
@@ -5729,8 +5717,10 @@ void Zombie::StartMindControlled() {
         if (aZombie) {
             aZombie->mRelatedZombieID = ZombieID::ZOMBIEID_NULL;
             mRelatedZombieID = ZombieID::ZOMBIEID_NULL;
+            BoardStats::ZombieChanged(aZombie);
         }
     }
+    BoardStats::ZombieChanged(this);
 }
 
 // 0x52FB40
@@ -6050,6 +6040,7 @@ void Zombie::DieNoLoot() {
     mApp->RemoveReanimation(mSpecialHeadReanimID);
 
     mDead = true;
+    BoardStats::ZombieChanged(this);
     TrySpawnLevelAward();
     if (mZombieType == ZombieType::ZOMBIE_BOBSLED) {
         BobsledDie();
@@ -6211,6 +6202,7 @@ int Zombie::TakeShieldDamage(int theDamage, unsigned int theDamageFlags) {
     const int aDamageActual = std::min(mShieldHealth, theDamage);
     const int aDamageRemaining = theDamage - aDamageActual;
     mShieldHealth -= aDamageActual;
+    BoardStats::ZombieChanged(this);
     if (mShieldHealth == 0) {
         DropShield(theDamageFlags);
         return aDamageRemaining;
@@ -6294,6 +6286,7 @@ int Zombie::TakeHelmDamage(int theDamage, unsigned int theDamageFlags) {
     const int aDamageActual = std::min(mHelmHealth, theDamage);
     const int aDamageRemaining = theDamage - aDamageActual;
     mHelmHealth -= aDamageActual;
+    BoardStats::ZombieChanged(this);
     if (TestBit(theDamageFlags, (int)DamageFlags::DAMAGE_FREEZE)) {
         ApplyChill(false);
     }
@@ -6351,6 +6344,7 @@ int Zombie::TakeFlyingDamage(int theDamage, unsigned int theDamageFlags) {
     const int aDamageActual = std::min(mFlyingHealth, theDamage);
     const int aDamageRemaining = theDamage - aDamageActual;
     mFlyingHealth -= aDamageActual;
+    BoardStats::ZombieChanged(this);
     if (mFlyingHealth == 0) {
         LandFlyer(theDamageFlags);
     }
@@ -6371,6 +6365,7 @@ void Zombie::TakeBodyDamage(int theDamage, unsigned int theDamageFlags) {
     const int aBodyHealthOrigin = mBodyHealth;
     const int aDamageIndexBeforeDamage = GetBodyDamageIndex();
     mBodyHealth -= theDamage;
+    BoardStats::ZombieChanged(this);
     const int aDamageIndexAfterDamage = GetBodyDamageIndex();
     if (mZombieType == ZombieType::ZOMBIE_ZAMBONI) {
         Reanimation *aBodyReanim = mApp->ReanimationGet(mBodyReanimID);
@@ -6472,6 +6467,7 @@ void Zombie::TakeBodyDamage(int theDamage, unsigned int theDamageFlags) {
         PlayDeathAnim(theDamageFlags);
         DropLoot();
     }
+    BoardStats::ZombieChanged(this);
 }
 
 // 0x5317C0
@@ -6642,6 +6638,7 @@ void Zombie::SetRow(int theRow) {
 
     mRow = theRow;
     mRenderOrder = Board::MakeRenderOrder(RenderLayer::RENDER_LAYER_ZOMBIE, mRow, 4);
+    BoardStats::ZombieChanged(this);
 }
 
 // 0x531C90
@@ -6919,6 +6916,8 @@ void Zombie::ApplyButter() {
     if (aZombie) {
         aZombie->mRelatedZombieID = ZombieID::ZOMBIEID_NULL;
         mRelatedZombieID = ZombieID::ZOMBIEID_NULL;
+        BoardStats::ZombieChanged(aZombie);
+        BoardStats::ZombieChanged(this);
     }
 
     if (mZombieType == ZombieType::ZOMBIE_POGO) {
@@ -7011,6 +7010,7 @@ void Zombie::MowDown() {
     aMoweredReanim->mLoopType = ReanimLoopType::REANIM_PLAY_ONCE_AND_HOLD;
     mMoweredReanimID = mApp->ReanimationGetID(aMoweredReanim);
     mZombiePhase = ZombiePhase::PHASE_ZOMBIE_MOWERED;
+    BoardStats::ZombieChanged(this);
     DropLoot();
 }
 
@@ -7068,6 +7068,7 @@ void Zombie::ApplyBurn() {
         }
 
         mZombiePhase = ZombiePhase::PHASE_ZOMBIE_BURNED;
+        BoardStats::ZombieChanged(this);
         mPhaseCounter = 300;
         mJustGotShotCounter = 0;
         DropLoot();
@@ -7191,6 +7192,7 @@ void Zombie::DetachShield() {
 
     mShieldType = ShieldType::SHIELDTYPE_NONE;
     mShieldHealth = 0;
+    BoardStats::ZombieChanged(this);
 }
 
 // 0x5331C0
@@ -7269,6 +7271,7 @@ void Zombie::PlayDeathAnim(unsigned int theDamageFlags) {
 
     mVelX = 0.0f;
     mZombiePhase = ZombiePhase::PHASE_ZOMBIE_DYING;
+    BoardStats::ZombieChanged(this);
     if (mZombieHeight == ZombieHeight::HEIGHT_ZOMBIQUARIUM) {
         PlayZombieReanim("anim_aquarium_death", ReanimLoopType::REANIM_PLAY_ONCE_AND_HOLD, 20, 14.0f);
         return;
@@ -7764,6 +7767,7 @@ void Zombie::UpdateZombieChimney() {
 void Zombie::WalkIntoHouse() {
     AttachmentDetachCrossFadeParticleType(mAttachmentID, ParticleEffect::PARTICLE_ZAMBONI_SMOKE, nullptr);
     mFromWave = Zombie::ZOMBIE_WAVE_WINNER;
+    BoardStats::ZombieChanged(this);
     ReanimReenableClipping();
 
     if (mZombiePhase == ZombiePhase::PHASE_POLEVAULTER_PRE_VAULT) {
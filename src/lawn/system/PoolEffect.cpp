@@ -75,8 +75,7 @@ void PoolEffect::UpdateWaterEffect() {
     // if(!has_shown) printf("TODO:    write compute shader for updating the water effect.\n");
     // has_shown = true;
 
-    uint32_t *data;
-    vkMapMemory(Vk::device, mStagingBufferMemory, 0, CAUSTIC_SIZE_BYTES, 0, (void **)&data);
+    uint32_t *data = static_cast<uint32_t *>(mStagingBufferMemory.mapped);
 
     int idx = 0;
     for (int y = 0; y < CAUSTIC_IMAGE_HEIGHT * SCALE; y++) {
@@ -112,8 +111,6 @@ void PoolEffect::UpdateWaterEffect() {
         }
     }
 
-    vkUnmapMemory(Vk::device, mStagingBufferMemory);
-
     Vk::renderMutex.lock();
     mCausticImage->uploadNewData(mStagingBuffer);
     Vk::renderMutex.unlock();
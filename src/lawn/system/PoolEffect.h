@@ -21,7 +21,7 @@ public:
     std::unique_ptr<Vk::VkImage> mCausticImage;
 
     VkBuffer mStagingBuffer;
-    VkDeviceMemory mStagingBufferMemory;
+    Vk::MemoryAllocation mStagingBufferMemory;
 
     LawnApp *mApp;
     int mPoolCounter;
@@ -402,6 +402,11 @@ void FixBoardAfterLoad(Board *theBoard) {
             aGridItem->mBoard = theBoard;
         }
     }
+    // The stats' side tables, the grid item index and the timer wheel aren't saved, rebuild them from the loaded
+    // arrays.
+    theBoard->mStats.Rebuild();
+    theBoard->mGridIndex.Rebuild();
+    theBoard->mTimerWheel.Rebuild();
 
     theBoard->mAdvice->mApp = theBoard->mApp;
     theBoard->mCursorObject->mApp = theBoard->mApp;
@@ -460,6 +465,7 @@ bool LawnSaveGame(Board *theBoard, const std::string &theFilePath) {
     aHeader.mBuildDate = SAVE_FILE_DATE;
 
     aContext.SyncBytes(&aHeader, sizeof(aHeader));
+    theBoard->mTimerWheel.SyncCountdowns();
     SyncBoard(aContext, theBoard);
     return gSexyAppBase->WriteBufferToFile(theFilePath, &aContext.mBuffer);
 }
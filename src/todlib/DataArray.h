@@ -90,6 +90,13 @@ public:
         return aItem->mID;
     }
 
+    // Index of theItem in mBlock, or -1 for an object that doesn't live in this array.
+    int DataArrayGetSlot(const T *theItem) const {
+        const DataArrayItem *aItem = (const DataArrayItem *)theItem;
+        if (mBlock == nullptr || aItem < mBlock || aItem >= mBlock + mMaxSize) return -1;
+        return (int)(aItem - mBlock);
+    }
+
     bool IterateNext(T *&theItem) {
         DataArray<T>::DataArrayItem *aItem = (DataArray<T>::DataArrayItem *)theItem;
         if (aItem == nullptr) aItem = &mBlock[0];
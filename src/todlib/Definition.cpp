@@ -694,7 +694,7 @@ void DefinitionXmlErrorBase(XMLParser *theXmlParser, const std::string &theForma
 }
 
 bool DefinitionReadXMLString(XMLParser *theXmlParser, SexyString &theValue) {
-    XMLElement aXMLElement;
+    XMLElementView aXMLElement;
     if (!theXmlParser->NextElement(&aXMLElement)) // 读取下一个 XML 元素
     {
         DefinitionXmlError(theXmlParser, "Missing element value");
@@ -709,7 +709,7 @@ bool DefinitionReadXMLString(XMLParser *theXmlParser, SexyString &theValue) {
         return false;
     }
 
-    theValue = aXMLElement.mValue; // ☆ 赋值出参
+    theValue = aXMLElement.Decode(aXMLElement.mValue); // ☆ 赋值出参
 
     if (!theXmlParser->NextElement(&aXMLElement)) // 继续读取下一个 XML 元素
     {
@@ -1079,7 +1079,7 @@ bool DefinitionReadFontField(XMLParser *theXmlParser, _Font **theFont) {
 bool DefinitionReadField(XMLParser *theXmlParser, const DefMap *theDefMap, void *theDefinition, bool *theDone) {
     if (theXmlParser->HasFailed()) return false;
 
-    auto aXMLElement = XMLElement();
+    XMLElementView aXMLElement;
     if (!theXmlParser->NextElement(&aXMLElement) || aXMLElement.mType == XMLElement::TYPE_END) // 读取下一个 XML 元素
     {
         *theDone = true; // 没有下一个元素则表示读取完成
@@ -1092,17 +1092,20 @@ bool DefinitionReadField(XMLParser *theXmlParser, const DefMap *theDefMap, void
         return false;
     }
 
+    // The view only lasts until the field's value is read
+    const SexyString aElementName = aXMLElement.Decode(aXMLElement.mValue);
+
     for (const DefField *aField = theDefMap->mMapFields; *aField->mFieldName != '\0'; aField++) {
         const auto pVar = (void *)((uintptr_t)theDefinition + aField->mFieldOffset);
         // Missing pvar field for some reason!
         if (aField->mFieldType == DefFieldType::DT_FLAGS &&
             DefinitionReadFlagField(
-                theXmlParser, aXMLElement.mValue, static_cast<uint32_t *>(pVar),
+                theXmlParser, aElementName, static_cast<uint32_t *>(pVar),
                 static_cast<DefSymbol *>(aField->mExtraData)
             ))
             return true;
 
-        if (strcasecmp(aXMLElement.mValue.c_str(), aField->mFieldName) == 0)
+        if (strcasecmp(aElementName.c_str(), aField->mFieldName) == 0)
         // 判断 aXMLElement 定义的是否为该成员变量
         {
             bool aSuccess;
@@ -1141,11 +1144,11 @@ bool DefinitionReadField(XMLParser *theXmlParser, const DefMap *theDefMap, void
             }
             if (aSuccess) return true;
 
-            DefinitionXmlError(theXmlParser, "Failed to read '{}' field", aXMLElement.mValue);
+            DefinitionXmlError(theXmlParser, "Failed to read '{}' field", aElementName);
             return false;
         }
     }
-    DefinitionXmlError(theXmlParser, "Ignoring unknown element '{}'", aXMLElement.mValue);
+    DefinitionXmlError(theXmlParser, "Ignoring unknown element '{}'", aElementName);
     // aXMLElement 未定义任何成员变量时
     return false;
 }
@@ -1276,6 +1279,68 @@ bool DefinitionCompileFile(
     return DefinitionWriteCompiledFile(theCompiledFilePath, theDefMap, theDefinition);
 }
 
+template <typename T> static int DefinitionCountXMLElements(const SexyString &theXMLFilePath, const bool theScan) {
+    auto aXMLParser = XMLParser();
+    aXMLParser.AllowSourceBuffer(theScan);
+    if (!aXMLParser.OpenFile(theXMLFilePath)) return 0;
+
+    T aXMLElement;
+    int aCount = 0;
+    while (aXMLParser.NextElement(&aXMLElement))
+        aCount++;
+    return aCount;
+}
+
+static std::string DefinitionDumpXMLElements(const SexyString &theXMLFilePath, const bool theScan) {
+    auto aXMLParser = XMLParser();
+    aXMLParser.AllowSourceBuffer(theScan);
+    if (!aXMLParser.OpenFile(theXMLFilePath)) return {};
+
+    std::string aDump;
+    XMLElement aXMLElement;
+    while (aXMLParser.NextElement(&aXMLElement)) {
+        aDump += fmt::format(
+            "{}|{}|{}|{}|{}", aXMLElement.mType, aXMLElement.mSection, aXMLElement.mValue, aXMLElement.mInstruction,
+            aXMLParser.GetCurrentLineNum()
+        );
+        for (const auto &[aKey, aValue] : aXMLElement.mAttributes)
+            aDump += fmt::format("|{}={}", aKey, aValue);
+        aDump += '\n';
+    }
+    return aDump + aXMLParser.GetErrorText();
+}
+
+void DefinitionBenchmarkXMLParser() {
+    std::vector<SexyString> aFilePaths;
+    for (const ReanimationParams &aParams : gLawnReanimationArray)
+        aFilePaths.push_back(_S("reanim/") + SexyString(aParams.mReanimFileName));
+    for (const ParticleParams &aParams : gLawnParticleArray)
+        aFilePaths.emplace_back(aParams.mParticleFileName);
+    for (const TrailParams &aParams : gLawnTrailArray)
+        aFilePaths.emplace_back(aParams.mTrailFileName);
+
+    for (const SexyString &aFilePath : aFilePaths) {
+        if (DefinitionDumpXMLElements(aFilePath, false) != DefinitionDumpXMLElements(aFilePath, true))
+            fmt::println("warning: xmlbench: the scan reads '{}' differently", aFilePath);
+    }
+
+    auto aTime = [&](int (*theCount)(const SexyString &, bool), const bool theScan) {
+        const auto aTimer = std::chrono::high_resolution_clock::now();
+        int aCount = 0;
+        for (const SexyString &aFilePath : aFilePaths)
+            aCount += theCount(aFilePath, theScan);
+        const std::chrono::duration<double, std::milli> aDuration = std::chrono::high_resolution_clock::now() - aTimer;
+        return std::pair(aCount, aDuration.count());
+    };
+    const auto [aCount, aReaderTime] = aTime(DefinitionCountXMLElements<XMLElement>, false);
+    const double aScanTime = aTime(DefinitionCountXMLElements<XMLElement>, true).second;
+    const double aViewTime = aTime(DefinitionCountXMLElements<XMLElementView>, true).second;
+    fmt::println(
+        "xmlbench: {} files, {} elements: reader {:.1f} ms, scan {:.1f} ms, scan with views {:.1f} ms",
+        aFilePaths.size(), aCount, aReaderTime, aScanTime, aViewTime
+    );
+}
+
 // 0x4447F0 : (void* def, *defMap, string& xmlFilePath)  //esp -= 0xC
 bool DefinitionCompileAndLoad(const SexyString &theXMLFilePath, DefMap *theDefMap, void *theDefinition) {
     // #ifdef _DEBUG  // 内测版执行的内容
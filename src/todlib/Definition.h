@@ -171,6 +171,9 @@ bool DefinitionWriteCompiledFile(const SexyString &theCompiledFilePath, DefMap *
 bool DefinitionCompileFile(
     const SexyString &theXMLFilePath, const SexyString &theCompiledFilePath, DefMap *theDefMap, void *theDefinition
 );
+// Reads the source of every reanim, particle and trail with XMLParser's character reader and with its in-place scan,
+// checks both give the same elements and prints how long each took.
+void DefinitionBenchmarkXMLParser();
 
 void DefMapWriteToCache(void *&theWritePtr, const DefMap *theDefMap, void *theDefinition);
 void DefWriteToCacheString(void *&theWritePtr, char **theValue);
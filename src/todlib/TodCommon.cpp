@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <climits>
 #include <cstdarg>
 
 #include "Common.h"
@@ -144,6 +146,147 @@ TodWeightedGridArray *TodPickFromWeightedGridArray(const TodWeightedGridArray *t
     return nullptr;
 }
 
+void TodAliasTable::Build(const int theWeights[], const int theCount) {
+    mWeights.assign(theWeights, theWeights + std::max(theCount, 0));
+    mKeep.clear();
+    mAlias.clear();
+    mTotalWeight = 0;
+    if (theCount <= 0) return;
+
+    long long aTotalWeight = 0;
+    for (int i = 0; i < theCount; i++) {
+        TOD_ASSERT(theWeights[i] >= 0);
+        aTotalWeight += theWeights[i];
+    }
+    TOD_ASSERT(aTotalWeight > 0 && aTotalWeight * theCount <= INT_MAX, "Alias table weights out of range");
+    if (aTotalWeight <= 0 || aTotalWeight * theCount > INT_MAX) return;
+
+    mTotalWeight = static_cast<int>(aTotalWeight);
+    mKeep.resize(theCount);
+    mAlias.resize(theCount);
+
+    // Scaled by the count, so the column size is the total weight and every share stays an integer.
+    std::vector<long long> aShares(theCount);
+    std::vector<int> aSmall;
+    std::vector<int> aLarge;
+    for (int i = 0; i < theCount; i++) {
+        aShares[i] = static_cast<long long>(theWeights[i]) * theCount;
+        (aShares[i] < mTotalWeight ? aSmall : aLarge).push_back(i);
+        mAlias[i] = i;
+    }
+    while (!aSmall.empty() && !aLarge.empty()) {
+        const int aLess = aSmall.back();
+        aSmall.pop_back();
+        const int aMore = aLarge.back();
+
+        mKeep[aLess] = static_cast<int>(aShares[aLess]);
+        mAlias[aLess] = aMore;
+        aShares[aMore] -= mTotalWeight - aShares[aLess];
+        if (aShares[aMore] < mTotalWeight) {
+            aLarge.pop_back();
+            aSmall.push_back(aMore);
+        }
+    }
+    // With integer shares whatever is left is exactly full.
+    for (const int aFull : aLarge) {
+        mKeep[aFull] = mTotalWeight;
+    }
+    for (const int aFull : aSmall) {
+        TOD_ASSERT(aShares[aFull] == mTotalWeight);
+        mKeep[aFull] = mTotalWeight;
+    }
+}
+
+int TodAliasTable::PickFromDraw(const int theDraw) const {
+    TOD_ASSERT(theDraw >= 0 && theDraw < GetDrawRange());
+    const int aColumn = theDraw / mTotalWeight;
+    return theDraw % mTotalWeight < mKeep[aColumn] ? aColumn : mAlias[aColumn];
+}
+
+int TodAliasTable::Pick() const {
+    TOD_ASSERT(GetCount() > 0);
+    if (GetCount() <= 0) return -1;
+
+    return PickFromDraw(Sexy::Rand(GetDrawRange()));
+}
+
+void TodAliasTableSelfTest() {
+    constexpr int aRandomSets = 200;
+    constexpr int aPicks = 200000;
+
+    // A few fixed shapes, then random sets of up to 40 items with some zero weights, kept small enough to go through
+    // every draw.
+    std::vector<std::vector<int>> aWeightSets = {
+        {1}, {5, 5, 5, 5}, {1, 1000}, {0, 3, 0, 7}, {4000, 1, 1, 1, 1, 1, 1, 1, 1, 1}, {1, 2, 3, 4, 5, 6, 7, 8, 9}
+    };
+    for (int i = 0; i < aRandomSets; i++) {
+        std::vector<int> aWeights(1 + Sexy::Rand(40));
+        for (int &aWeight : aWeights) {
+            aWeight = Sexy::Rand(4) == 0 ? 0 : Sexy::Rand(400);
+        }
+        aWeights[Sexy::Rand(static_cast<int>(aWeights.size()))] += 1;
+        aWeightSets.push_back(aWeights);
+    }
+
+    int aExactFailures = 0;
+    int aChiSquareFailures = 0;
+    for (const std::vector<int> &aWeights : aWeightSets) {
+        const int aCount = static_cast<int>(aWeights.size());
+        TodAliasTable aTable;
+        aTable.Build(aWeights.data(), aCount);
+        int aTotalWeight = 0;
+        for (const int aWeight : aWeights) {
+            aTotalWeight += aWeight;
+        }
+
+        // Every draw once: each item must come up exactly count * weight times.
+        std::vector<long long> aHits(aCount);
+        for (int aDraw = 0; aDraw < aTable.GetDrawRange(); aDraw++) {
+            aHits[aTable.PickFromDraw(aDraw)]++;
+        }
+        for (int i = 0; i < aCount; i++) {
+            if (aHits[i] != static_cast<long long>(aWeights[i]) * aCount) {
+                aExactFailures++;
+                fmt::println(
+                    "warning: aliastest: item {} of {} drawn {} times, expected {}", i, aCount, aHits[i],
+                    static_cast<long long>(aWeights[i]) * aCount
+                );
+                break;
+            }
+        }
+
+        // And through Sexy::Rand, against the 99.9% point of the chi-square distribution (Wilson-Hilferty).
+        std::vector<int> aPicked(aCount);
+        for (int i = 0; i < aPicks; i++) {
+            aPicked[aTable.Pick()]++;
+        }
+        double aChiSquare = 0.0;
+        int aCells = 0;
+        for (int i = 0; i < aCount; i++) {
+            const double aExpected = static_cast<double>(aPicks) * aWeights[i] / aTotalWeight;
+            if (aExpected <= 0.0) {
+                if (aPicked[i] != 0) aChiSquare = INFINITY;
+                continue;
+            }
+            aChiSquare += (aPicked[i] - aExpected) * (aPicked[i] - aExpected) / aExpected;
+            aCells++;
+        }
+        const int aFreedom = std::max(aCells - 1, 1);
+        const double aTerm = 2.0 / (9.0 * aFreedom);
+        const double aLimit = aFreedom * std::pow(1.0 - aTerm + 3.09 * std::sqrt(aTerm), 3.0);
+        if (aCells > 1 && aChiSquare > aLimit) {
+            aChiSquareFailures++;
+            fmt::println("warning: aliastest: {} items, chi-square {:.1f} over {:.1f}", aCount, aChiSquare, aLimit);
+        }
+    }
+
+    fmt::println(
+        "aliastest: {} weight sets: {} off in the exact count, {} over the chi-square limit (a few in a thousand are "
+        "expected by chance)",
+        aWeightSets.size(), aExactFailures, aChiSquareFailures
+    );
+}
+
 // 0x5115C0
 float TodCalcSmoothWeight(float aWeight, float aLastPicked, float aSecondLastPicked) {
     if (aWeight < 1E-6f) {
@@ -834,9 +977,13 @@ bool TodResourceManager::TodLoadResources(const std::string &theGroup) {
     StartLoadResources(theGroup);
     while (!gSexyAppBase->mShutdown && TodLoadNextResource())
         ;
-    if (gSexyAppBase->mShutdown) return false;
+    if (gSexyAppBase->mShutdown) {
+        DiscardPreparedResources();
+        return false;
+    }
 
     if (HadError()) {
+        DiscardPreparedResources();
         gSexyAppBase->ShowResourceError(true);
         return false;
     }
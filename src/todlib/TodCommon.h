@@ -2,8 +2,10 @@
 #include "ConstEnums.h"
 #include "framework/misc/ResourceManager.h"
 #include "todlib/TodDebug.h"
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
+#include <vector>
 
 struct TodAllocator;
 
@@ -79,6 +81,46 @@ float TodCalcSmoothWeight(float aWeight, float aLastPicked, float aSecondLastPic
 void TodUpdateSmoothArrayPick(TodSmoothArray *theArray, int theCount, int thePickIndex);
 int TodPickFromSmoothArray(TodSmoothArray *theArray, int theCount);
 
+// Walker's alias method, with Vose's construction, over integer weights. It is meant for callers that pick from the
+// same weights many times, e.g. once per wave or per board state; the picks above stay the default. Building is
+// O(count); Pick() is O(1) and, like the linear picks, draws exactly one Sexy::Rand value. For the same draw it usually
+// picks a different item than they do, so a seeded run stays reproducible only within one mode.
+//
+// Every column holds the total weight, split between its own item and its alias, all in integers: of the
+// GetDrawRange() possible draws each item gets exactly count * weight.
+class TodAliasTable {
+protected:
+    std::vector<int> mWeights;
+    std::vector<int> mKeep;
+    std::vector<int> mAlias;
+    int mTotalWeight = 0;
+
+public:
+    void Build(const int theWeights[], int theCount);
+    template <typename T> void Build(const TodWeightedArray<T> theArray[], int theCount) {
+        std::vector<int> aWeights(theCount > 0 ? theCount : 0);
+        for (int i = 0; i < theCount; i++) {
+            aWeights[i] = theArray[i].mWeight;
+        }
+        Build(aWeights.data(), theCount);
+    }
+
+    // Whether the table was built from exactly these weights, so a caller whose weights rarely change can keep it.
+    bool HasWeights(const int theWeights[], const int theCount) const {
+        return std::equal(mWeights.begin(), mWeights.end(), theWeights, theWeights + theCount);
+    }
+
+    int GetCount() const { return static_cast<int>(mKeep.size()); }
+    int GetDrawRange() const { return GetCount() * mTotalWeight; }
+    // The index for theDraw in [0, GetDrawRange()).
+    int PickFromDraw(int theDraw) const;
+    // The index of a random item, -1 when the table is empty.
+    int Pick() const;
+};
+
+// -aliastest: TodAliasTable against its weights, exactly over all draws and by a chi-square test of random picks.
+void TodAliasTableSelfTest();
+
 // #################################################################################################### //
 
 class TodResourceManager : public ResourceManager {
@@ -0,0 +1,200 @@
+// Converts an original pak into the pak2 format read by PakInterface (see PakInterface.cpp for the layout).
+//
+//   cc repak.c -lz -o repak
+//   ./repak main.pak main.pak2
+//
+// Files go in aligned to 4 KiB, so they can be used straight from the mapping, and are stored as a zlib stream
+// when that saves at least an eighth of their size.
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#define FILEFLAGS_END 0x80
+
+#define PAK1_MAGIC 0xBAC04AC0
+#define PAK2_MAGIC 0x324B4150
+#define PAK2_VERSION 1
+#define PAK2_ALIGNMENT 4096
+
+#define PAK2_STORED 0
+#define PAK2_ZLIB 1
+
+typedef struct Pak2Header {
+    uint32_t mMagic;
+    uint32_t mVersion;
+    uint32_t mEntryCount;
+    uint32_t mNamesSize;
+} Pak2Header;
+
+typedef struct Pak2Entry {
+    uint64_t mOffset;
+    uint64_t mNameHash;
+    uint32_t mSize;
+    uint32_t mStoredSize;
+    uint32_t mChecksum;
+    uint32_t mNameOffset;
+    uint16_t mNameLength;
+    uint8_t mCompression;
+    uint8_t mPad[5];
+    uint64_t mFileTime;
+} Pak2Entry;
+
+typedef struct PakDef {
+    char *aName;
+    int aNameWidth;
+    int aSrcSize;
+    uint64_t aFileTime;
+    size_t offset;
+} PakDef;
+
+// Must match PakNameTable::Hash: FNV-1a over the uppercased bytes
+uint64_t NameHash(const char *name, int length) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (int i = 0; i < length; i++) {
+        hash ^= (uint8_t)toupper((uint8_t)name[i]);
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+void WritePadding(FILE *fp, size_t *pos) {
+    static const uint8_t zeros[PAK2_ALIGNMENT] = {0};
+    size_t pad = (PAK2_ALIGNMENT - *pos % PAK2_ALIGNMENT) % PAK2_ALIGNMENT;
+    fwrite(zeros, 1, pad, fp);
+    *pos += pad;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        printf("Usage: %s <main.pak> <output.pak2>\n", argv[0]);
+        return 1;
+    }
+
+    FILE *fp = fopen(argv[1], "rb");
+    if (!fp) {
+        printf("Failed to open %s\n", argv[1]);
+        return 1;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    size_t size = ftell(fp);
+    rewind(fp);
+
+    uint8_t *b_ptr = malloc(size);
+    if (fread(b_ptr, 1, size, fp) != size) {
+        printf("Failed to read %s\n", argv[1]);
+        return 1;
+    }
+    fclose(fp);
+
+    for (size_t i = 0; i < size; i++)
+        b_ptr[i] ^= 0xF7; // 'Decrypt'
+
+    if (size < 8 || *(uint32_t *)b_ptr != PAK1_MAGIC || *(uint32_t *)(b_ptr + 4) != 0) {
+        printf("%s is not a pak file\n", argv[1]);
+        return 1;
+    }
+
+    // Parse the index, as tools/metadata.c does
+    uint8_t *ptr = b_ptr + 8;
+    uint8_t *end = b_ptr + size;
+    size_t aPos = 0;
+    size_t namesSize = 0;
+    int count = 0;
+    int capacity = 1024;
+    PakDef *defs = malloc(capacity * sizeof(PakDef));
+    for (;;) {
+        if (ptr >= end) break;
+        uint8_t aFlags = *ptr++;
+        if (aFlags & FILEFLAGS_END) break;
+
+        if (count == capacity) {
+            capacity *= 2;
+            defs = realloc(defs, capacity * sizeof(PakDef));
+        }
+        PakDef *def = &defs[count++];
+
+        def->aNameWidth = *ptr++;
+        def->aName = malloc(def->aNameWidth + 1);
+        memcpy(def->aName, ptr, def->aNameWidth);
+        def->aName[def->aNameWidth] = 0;
+        ptr += def->aNameWidth;
+
+        memcpy(&def->aSrcSize, ptr, sizeof(int));
+        ptr += sizeof(int);
+        memcpy(&def->aFileTime, ptr, sizeof(uint64_t));
+        ptr += sizeof(uint64_t);
+
+        def->offset = aPos;
+        aPos += def->aSrcSize;
+        namesSize += def->aNameWidth + 1;
+    }
+
+    size_t offset = ptr - b_ptr;
+    if (offset + aPos > size) {
+        printf("%s is truncated\n", argv[1]);
+        return 1;
+    }
+
+    FILE *wp = fopen(argv[2], "wb");
+    if (!wp) {
+        printf("Failed to open %s\n", argv[2]);
+        return 1;
+    }
+
+    // Header, entries and names first, the entries get rewritten once the data offsets are known
+    Pak2Header header = {PAK2_MAGIC, PAK2_VERSION, (uint32_t)count, (uint32_t)namesSize};
+    Pak2Entry *entries = calloc(count, sizeof(Pak2Entry));
+    fwrite(&header, sizeof(header), 1, wp);
+    fwrite(entries, sizeof(Pak2Entry), count, wp);
+
+    uint32_t nameOffset = 0;
+    for (int i = 0; i < count; ++i) {
+        entries[i].mNameOffset = nameOffset;
+        entries[i].mNameLength = (uint16_t)defs[i].aNameWidth;
+        entries[i].mNameHash = NameHash(defs[i].aName, defs[i].aNameWidth);
+        entries[i].mFileTime = defs[i].aFileTime;
+        fwrite(defs[i].aName, 1, defs[i].aNameWidth + 1, wp);
+        nameOffset += defs[i].aNameWidth + 1;
+    }
+
+    size_t pos = sizeof(header) + count * sizeof(Pak2Entry) + namesSize;
+    size_t storedTotal = 0;
+    for (int i = 0; i < count; ++i) {
+        const uint8_t *src = b_ptr + offset + defs[i].offset;
+        uLong srcSize = (uLong)defs[i].aSrcSize;
+
+        uLongf compressedSize = compressBound(srcSize);
+        uint8_t *compressed = malloc(compressedSize);
+        int useZlib = compress2(compressed, &compressedSize, src, srcSize, Z_BEST_COMPRESSION) == Z_OK &&
+                      compressedSize <= srcSize - srcSize / 8;
+
+        WritePadding(wp, &pos);
+        entries[i].mOffset = pos;
+        entries[i].mSize = (uint32_t)srcSize;
+        entries[i].mChecksum = (uint32_t)crc32(0, src, srcSize);
+        entries[i].mCompression = useZlib ? PAK2_ZLIB : PAK2_STORED;
+        entries[i].mStoredSize = useZlib ? (uint32_t)compressedSize : (uint32_t)srcSize;
+        fwrite(useZlib ? compressed : src, 1, entries[i].mStoredSize, wp);
+        pos += entries[i].mStoredSize;
+        storedTotal += entries[i].mStoredSize;
+        free(compressed);
+    }
+
+    fseek(wp, sizeof(header), SEEK_SET);
+    fwrite(entries, sizeof(Pak2Entry), count, wp);
+    fclose(wp);
+
+    printf("%d files, %zu bytes of data stored in %zu, %s is %zu bytes\n", count, aPos, storedTotal, argv[2], pos);
+
+    for (int i = 0; i < count; ++i) {
+        free(defs[i].aName);
+    }
+    free(defs);
+    free(entries);
+    free(b_ptr);
+    return 0;
+}